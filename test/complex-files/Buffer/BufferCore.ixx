@@ -208,67 +208,168 @@ public:
         BufferResourcePtr buffer;
         VkDeviceSize offset;
         VkDeviceSize size;
-        
+
         bool IsValid() const { return buffer != nullptr; }
     };
-    
+
+    // Generational handle to a pool allocation. Unlike a raw Allocation,
+    // the handle does not pin a (buffer, offset) pair - compaction may
+    // migrate the storage, after which Resolve returns the new placement.
+    // The generation catches use-after-free: FreeHandle bumps it, so a
+    // stale handle resolves to an invalid Allocation instead of aliasing
+    // whatever reused the slot.
+    struct AllocationHandle {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool IsValid() const { return index != UINT32_MAX; }
+    };
+
+    // Executes a transfer-queue copy during compaction. Provided by the
+    // renderer (the pool has no queue or command pool of its own); the
+    // callback must have completed the copy - including any barriers -
+    // before returning, because the old storage is freed immediately after.
+    using TransferCopyFn = std::function<void(VkBuffer src, VkBuffer dst, const VkBufferCopy& region)>;
+
     Allocation Allocate(VkDeviceSize size, VkDeviceSize alignment = 256) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        size = (size + alignment - 1) & ~(alignment - 1);
-        for (auto& block : m_blocks) {
-            for (auto it = block.freeRanges.begin(); it != block.freeRanges.end(); ++it) {
-                auto& range = *it;
-                VkDeviceSize alignedOffset = (range.first + alignment - 1) & ~(alignment - 1);
-                VkDeviceSize endOffset = alignedOffset + size;
-                
-                if (endOffset <= range.first + range.second) {
-                    Allocation alloc;
-                    alloc.buffer = block.buffer;
-                    alloc.offset = alignedOffset;
-                    alloc.size = size;
-                    VkDeviceSize beforeSize = alignedOffset - range.first;
-                    VkDeviceSize afterOffset = endOffset;
-                    VkDeviceSize afterSize = (range.first + range.second) - endOffset;
-                    it = block.freeRanges.erase(it);
-                    if (beforeSize > 0) {
-                        block.freeRanges.emplace_back(range.first, beforeSize);
-                    }
-                    if (afterSize > 0) {
-                        block.freeRanges.emplace_back(afterOffset, afterSize);
-                    }
-                    
-                    block.freeSpace -= size;
-                    return alloc;
-                }
-            }
-        }
-        CreateNewBlock();
-        return Allocate(size, alignment);
+        return AllocateLocked(size, alignment, nullptr);
     }
-    
+
     void Free(const Allocation& allocation) {
         if (!allocation.IsValid()) return;
-        
+
         std::lock_guard<std::mutex> lock(m_mutex);
-        for (auto& block : m_blocks) {
-            if (block.buffer == allocation.buffer) {
-                block.freeRanges.emplace_back(allocation.offset, allocation.size);
-                block.freeSpace += allocation.size;
-                MergeFreeRanges(block);
-                if (block.freeSpace == m_blockSize && m_blocks.size() > 1) {
-                    block.markedForRemoval = true;
+        FreeLocked(allocation);
+    }
+
+    // Handle-based allocation: same placement policy as Allocate, but the
+    // result is relocatable by CompactStep. Prefer this for long-lived
+    // suballocations; raw Allocations cannot be migrated because their
+    // clients hold the offset directly.
+    AllocationHandle AllocateHandle(VkDeviceSize size, VkDeviceSize alignment = 256) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Allocation allocation = AllocateLocked(size, alignment, nullptr);
+        if (!allocation.IsValid()) {
+            return {};
+        }
+
+        uint32_t index;
+        if (!m_freeSlots.empty()) {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        } else {
+            index = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        Slot& slot = m_slots[index];
+        slot.allocation = std::move(allocation);
+        slot.live = true;
+        return {index, slot.generation};
+    }
+
+    // Current placement for a handle; invalid Allocation if the handle is
+    // stale. The placement is only stable until the next CompactStep, so
+    // resolve per use (typically per frame) rather than caching the offset.
+    Allocation Resolve(const AllocationHandle& handle) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (handle.index >= m_slots.size()) return {};
+        const Slot& slot = m_slots[handle.index];
+        if (!slot.live || slot.generation != handle.generation) return {};
+        return slot.allocation;
+    }
+
+    void FreeHandle(const AllocationHandle& handle) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (handle.index >= m_slots.size()) return;
+        Slot& slot = m_slots[handle.index];
+        if (!slot.live || slot.generation != handle.generation) return;
+
+        FreeLocked(slot.allocation);
+        slot.allocation = {};
+        slot.live = false;
+        ++slot.generation;  // Invalidate outstanding copies of this handle
+        m_freeSlots.push_back(handle.index);
+    }
+
+    void SetTransferExecutor(TransferCopyFn fn) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_transferCopy = std::move(fn);
+    }
+
+    // Fraction of free space unusable for a largest-fit allocation:
+    // 0 = one contiguous free range, approaching 1 = free space shredded
+    // across many small ranges. Drives when the manager schedules compaction.
+    float GetFragmentation() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        VkDeviceSize totalFree = 0;
+        VkDeviceSize largestFree = 0;
+        for (const auto& block : m_blocks) {
+            totalFree += block.freeSpace;
+            for (const auto& range : block.freeRanges) {
+                largestFree = std::max(largestFree, range.second);
+            }
+        }
+        if (totalFree == 0) return 0.0f;
+        return 1.0f - static_cast<float>(largestFree) / static_cast<float>(totalFree);
+    }
+
+    // One incremental compaction pass: migrates handle-tracked allocations
+    // out of the least-utilized block into denser ones via transfer-queue
+    // copies, up to byteBudget per call so a frame never absorbs a full
+    // defragmentation. Returns bytes migrated. Without a transfer executor
+    // only fully-empty blocks are reclaimed.
+    VkDeviceSize CompactStep(VkDeviceSize byteBudget = 4 * 1024 * 1024) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        VkDeviceSize migrated = 0;
+
+        if (m_transferCopy && m_blocks.size() > 1) {
+            // Evacuate the block with the most free space that is not
+            // already empty - it has the least live data to move
+            Block* source = nullptr;
+            for (auto& block : m_blocks) {
+                if (block.freeSpace == m_blockSize) continue;
+                if (!source || block.freeSpace > source->freeSpace) {
+                    source = &block;
+                }
+            }
+
+            if (source) {
+                for (Slot& slot : m_slots) {
+                    if (!slot.live || slot.allocation.buffer != source->buffer) continue;
+                    if (migrated + slot.allocation.size > byteBudget) break;
+
+                    Allocation target = AllocateLocked(slot.allocation.size, 256, source);
+                    if (!target.IsValid()) break;  // No room elsewhere; stop this pass
+
+                    VkBufferCopy region{};
+                    region.srcOffset = slot.allocation.offset;
+                    region.dstOffset = target.offset;
+                    region.size = slot.allocation.size;
+                    m_transferCopy(slot.allocation.buffer->GetBuffer(),
+                                   target.buffer->GetBuffer(), region);
+
+                    FreeLocked(slot.allocation);
+                    slot.allocation = std::move(target);
+                    migrated += region.size;
                 }
-                
-                break;
             }
         }
+
+        m_blocks.erase(
+            std::remove_if(m_blocks.begin(), m_blocks.end(),
+                          [](const Block& block) { return block.markedForRemoval; }),
+            m_blocks.end()
+        );
+        return migrated;
     }
-    
+
     void DefragmentAsync() {
         auto& jobSystem = Core::Threading::JobSystem::Instance();
-        
+
         jobSystem.CreateAndSchedule<void>([this]() {
-            Defragment();
+            CompactStep();
         }, "BufferPool::Defragment");
     }
     
@@ -360,15 +461,83 @@ private:
         std::vector<std::pair<VkDeviceSize, VkDeviceSize>> freeRanges; // offset, size
         bool markedForRemoval = false;
     };
-    
+
+    // Backing entry for an AllocationHandle
+    struct Slot {
+        Allocation allocation;
+        uint32_t generation = 0;
+        bool live = false;
+    };
+
     VkDevice m_device;
     VkPhysicalDevice m_physicalDevice;
     BufferCategory m_category;
     VkDeviceSize m_blockSize;
-    
+
     mutable std::mutex m_mutex;
     std::vector<Block> m_blocks;
-    
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    TransferCopyFn m_transferCopy;
+
+    // First-fit across blocks (optionally excluding one, so compaction
+    // never migrates an allocation back into the block being evacuated).
+    // Caller holds m_mutex.
+    Allocation AllocateLocked(VkDeviceSize size, VkDeviceSize alignment, const Block* exclude) {
+        size = (size + alignment - 1) & ~(alignment - 1);
+        for (auto& block : m_blocks) {
+            if (&block == exclude) continue;
+            for (auto it = block.freeRanges.begin(); it != block.freeRanges.end(); ++it) {
+                auto& range = *it;
+                VkDeviceSize alignedOffset = (range.first + alignment - 1) & ~(alignment - 1);
+                VkDeviceSize endOffset = alignedOffset + size;
+
+                if (endOffset <= range.first + range.second) {
+                    Allocation alloc;
+                    alloc.buffer = block.buffer;
+                    alloc.offset = alignedOffset;
+                    alloc.size = size;
+                    VkDeviceSize beforeSize = alignedOffset - range.first;
+                    VkDeviceSize afterOffset = endOffset;
+                    VkDeviceSize afterSize = (range.first + range.second) - endOffset;
+                    it = block.freeRanges.erase(it);
+                    if (beforeSize > 0) {
+                        block.freeRanges.emplace_back(range.first, beforeSize);
+                    }
+                    if (afterSize > 0) {
+                        block.freeRanges.emplace_back(afterOffset, afterSize);
+                    }
+
+                    block.freeSpace -= size;
+                    return alloc;
+                }
+            }
+        }
+
+        if (exclude) {
+            // Compaction must not grow the pool it is trying to shrink
+            return {};
+        }
+        CreateNewBlock();
+        return AllocateLocked(size, alignment, nullptr);
+    }
+
+    // Caller holds m_mutex
+    void FreeLocked(const Allocation& allocation) {
+        for (auto& block : m_blocks) {
+            if (block.buffer == allocation.buffer) {
+                block.freeRanges.emplace_back(allocation.offset, allocation.size);
+                block.freeSpace += allocation.size;
+                MergeFreeRanges(block);
+                if (block.freeSpace == m_blockSize && m_blocks.size() > 1) {
+                    block.markedForRemoval = true;
+                }
+
+                break;
+            }
+        }
+    }
+
     void CreateNewBlock() {
         VkBufferCreateInfo bufferInfo{};
         bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -474,32 +643,112 @@ private:
         
         block.freeRanges = std::move(merged);
     }
-    
-    void Defragment() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        
-        m_blocks.erase(
-            std::remove_if(m_blocks.begin(), m_blocks.end(),
-                          [](const Block& block) { return block.markedForRemoval; }),
-            m_blocks.end()
-        );
-    }
 };
 
 struct MultiBufferedResource {
+    static constexpr uint32_t kInvalidSlot = UINT32_MAX;
+
     std::vector<BufferResourcePtr> buffers;
     std::atomic<uint32_t> currentIndex{0};
-    
-    BufferResourcePtr GetCurrent() { 
-        return buffers[currentIndex.load(std::memory_order_acquire)]; 
+
+    // Per-slot synchronization: each slot remembers the fence of the submit
+    // that last read it, so the CPU can poll for a writable slot instead of
+    // waiting for the whole device. Fences are owned by the submitting code;
+    // this struct only polls them. MarkSlotInFlight / TryAcquireWriteSlot /
+    // UpdateFramesInFlightPolicy are meant to be called from the single
+    // thread that drives the frame (matching NextFrame's usage).
+    struct SlotSync {
+        VkFence fence = VK_NULL_HANDLE;
+        std::chrono::steady_clock::time_point submitted{};
+    };
+    VkDevice device = VK_NULL_HANDLE;  // Needed for fence polling; set by the creator
+    std::vector<SlotSync> slotSync;
+    uint32_t activeBufferCount = 0;    // Slots in rotation; 0 means all of them
+    float gpuLatencyEmaMs = 0.0f;      // Smoothed submit-to-signal latency
+
+    BufferResourcePtr GetCurrent() {
+        return buffers[currentIndex.load(std::memory_order_acquire)];
     }
-    
-    void NextFrame() { 
+
+    void NextFrame() {
         uint32_t next = (currentIndex.load(std::memory_order_acquire) + 1) % buffers.size();
         currentIndex.store(next, std::memory_order_release);
     }
-    
+
     size_t GetBufferCount() const { return buffers.size(); }
+
+    // Record that the GPU reads this slot until fence signals
+    void MarkSlotInFlight(uint32_t slot, VkFence fence) {
+        EnsureSlotSync();
+        if (slot >= slotSync.size()) return;
+        slotSync[slot].fence = fence;
+        slotSync[slot].submitted = std::chrono::steady_clock::now();
+    }
+
+    // True when the GPU is done with the slot (or it was never submitted).
+    // Observing a signalled fence also feeds the latency estimate that
+    // drives the frames-in-flight policy
+    bool IsSlotAvailable(uint32_t slot) {
+        EnsureSlotSync();
+        if (slot >= slotSync.size()) return false;
+        SlotSync& sync = slotSync[slot];
+        if (sync.fence == VK_NULL_HANDLE) return true;
+        if (device == VK_NULL_HANDLE) {
+            // No device to poll against - preserve the legacy assumption
+            // that the caller synchronized externally
+            return true;
+        }
+        if (vkGetFenceStatus(device, sync.fence) != VK_SUCCESS) {
+            return false;
+        }
+        float latencyMs = std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(
+            std::chrono::steady_clock::now() - sync.submitted).count();
+        gpuLatencyEmaMs = gpuLatencyEmaMs == 0.0f
+            ? latencyMs
+            : gpuLatencyEmaMs * 0.9f + latencyMs * 0.1f;
+        sync.fence = VK_NULL_HANDLE;
+        return true;
+    }
+
+    // Non-blocking: advance to the next slot whose fence has signalled and
+    // return it, or kInvalidSlot when every active slot is still in flight
+    // (caller skips the update or falls back to waiting)
+    uint32_t TryAcquireWriteSlot() {
+        uint32_t count = ActiveCount();
+        if (count == 0) return kInvalidSlot;
+        uint32_t start = currentIndex.load(std::memory_order_acquire);
+        for (uint32_t i = 1; i <= count; ++i) {
+            uint32_t slot = (start + i) % count;
+            if (IsSlotAvailable(slot)) {
+                currentIndex.store(slot, std::memory_order_release);
+                return slot;
+            }
+        }
+        return kInvalidSlot;
+    }
+
+    // Frames-in-flight policy: when the GPU signals well inside a frame,
+    // double buffering is enough and saves a frame of latency (and a slot
+    // of memory traffic); otherwise rotate through every allocated slot.
+    // Extra slots simply drop out of rotation once their fences retire
+    void UpdateFramesInFlightPolicy(float frameIntervalMs = 16.6f) {
+        if (buffers.size() < 3 || gpuLatencyEmaMs <= 0.0f) return;
+        activeBufferCount = gpuLatencyEmaMs < frameIntervalMs * 0.5f
+            ? 2
+            : static_cast<uint32_t>(buffers.size());
+    }
+
+    uint32_t ActiveCount() const {
+        uint32_t total = static_cast<uint32_t>(buffers.size());
+        return activeBufferCount == 0 ? total : std::min(activeBufferCount, total);
+    }
+
+private:
+    void EnsureSlotSync() {
+        if (slotSync.size() != buffers.size()) {
+            slotSync.resize(buffers.size());
+        }
+    }
 };
 
 using MultiBufferedResourcePtr = std::shared_ptr<MultiBufferedResource>;
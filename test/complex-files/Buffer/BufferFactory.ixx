@@ -1,11 +1,14 @@
 module;
 
 #include <vulkan/vulkan.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 
 export module BufferFactory;
 
+import BufferCore;
+
 export namespace PlanetGen::Rendering {
 
 // Forward declarations
@@ -98,6 +101,91 @@ public:
     static std::vector<bool> CreateBuffers(
         VulkanUniformManager& uniformManager,
         const std::vector<BufferSpec>& specs);
+
+    /**
+     * Memory domain selected from BufferUsageHints
+     *
+     * - DeviceLocal: GPU-only access, no CPU visibility needed
+     * - BarVisible: device-local but CPU-writable (resizable BAR / upload
+     *   heap) for small frequently-written GPU data
+     * - HostVisible: CPU-side staging and readback
+     */
+    enum class MemoryDomain {
+        DeviceLocal,
+        BarVisible,
+        HostVisible
+    };
+
+    // Allocations at or below this size go through per-category slabs;
+    // anything larger gets its own allocation as before
+    static constexpr VkDeviceSize kMaxSlabAllocationSize = 1 * 1024 * 1024;
+    static constexpr VkDeviceSize kMinSizeClass = 256;
+
+    /**
+     * Round a request up to its size class (power of two, at least
+     * kMinSizeClass). Returns 0 for requests too large for slab
+     * suballocation - those take the dedicated-allocation path.
+     */
+    static VkDeviceSize SelectSizeClass(VkDeviceSize size) {
+        if (size == 0 || size > kMaxSlabAllocationSize) {
+            return 0;
+        }
+        VkDeviceSize sizeClass = kMinSizeClass;
+        while (sizeClass < size) {
+            sizeClass <<= 1;
+        }
+        return sizeClass;
+    }
+
+    /**
+     * Pick the memory domain from the access pattern the hints describe
+     */
+    static MemoryDomain SelectMemoryDomain(const BufferUsageHints& hints) {
+        if (hints.cpuWriteOften || hints.persistentMapped) {
+            // Frequent CPU writes consumed by the GPU want BAR memory;
+            // CPU-side scratch that the GPU never reads stays host-visible
+            return hints.gpuReadWrite || hints.gpuWriteOnly
+                ? MemoryDomain::BarVisible
+                : MemoryDomain::HostVisible;
+        }
+        if (hints.cpuWriteOnce) {
+            return MemoryDomain::BarVisible;
+        }
+        return MemoryDomain::DeviceLocal;
+    }
+
+    static VkMemoryPropertyFlags MemoryDomainProperties(MemoryDomain domain) {
+        switch (domain) {
+            case MemoryDomain::BarVisible:
+                return VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                       VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+            case MemoryDomain::HostVisible:
+                return VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                       VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+            case MemoryDomain::DeviceLocal:
+            default:
+                return VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        }
+    }
+
+    /**
+     * Create a buffer through the size-class slab allocator
+     *
+     * Small and short-lived buffers suballocate from a slab per
+     * (BufferCategory, size class) instead of making an individual
+     * vkAllocateMemory call; freed slots recycle within their size class.
+     * Memory type comes from SelectMemoryDomain(hints); requests above
+     * kMaxSlabAllocationSize fall through to a dedicated allocation.
+     * Avoids the thousands of small device allocations (and driver
+     * allocation-count limits) the loading phase hits otherwise.
+     */
+    static BufferResourcePtr CreateSizeClassedBuffer(
+        BufferManagementSystem& bufferManager,
+        VkDeviceSize size,
+        VkBufferUsageFlags usage,
+        BufferCategory category,
+        const BufferUsageHints& hints);
 };
 
 } // namespace PlanetGen::Rendering
\ No newline at end of file
@@ -57,7 +57,8 @@ public:
         vkGetPhysicalDeviceProperties(physicalDevice, &deviceProps);
         m_deviceLimits = deviceProps.limits;
         InitializePools();
-        
+        InitializeStagingRing();
+
         LOG_INFO("BufferManagement", "Initialized with device: {}", deviceProps.deviceName);
     }
     BufferResourcePtr CreateBuffer(VkDeviceSize size,
@@ -124,6 +125,23 @@ public:
     BufferResourcePtr CreateVertexBuffer(const void* data, VkDeviceSize size, BufferPoolType poolType) {
         BufferUsageHints hints;
         hints.cpuWriteOnce = true;
+        auto vertexBuffer = CreateBuffer(
+            size,
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            BufferCategory::VertexBuffer,
+            poolType,
+            hints
+        );
+
+        // Hot path: memcpy into the persistently-mapped staging ring plus a
+        // recorded copy - no buffer creation, no map/unmap syscalls
+        if (StageUpload(data, size, vertexBuffer)) {
+            return vertexBuffer;
+        }
+
+        // Fallback: ring disabled, full, or the upload exceeds its capacity -
+        // use the legacy per-upload staging buffer
         auto stagingBuffer = CreateBuffer(
             size,
             VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
@@ -133,23 +151,15 @@ public:
             hints
         );
         stagingBuffer->UpdateData(data, size);
-        auto vertexBuffer = CreateBuffer(
-            size,
-            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-            BufferCategory::VertexBuffer,
-            poolType,
-            hints
-        );
         CopyBuffer(stagingBuffer, vertexBuffer, size);
-        
+
         // Staging buffer is no longer needed after copy - it will be cleaned up when it goes out of scope
         // but we should trigger garbage collection if memory pressure is high
         if (m_currentMemoryUsage.load() > m_memoryBudget * 0.8) {
             LOG_DEBUG("BufferManagementSystem", "High memory pressure detected, triggering GC");
             CollectGarbage(0); // Collect all unused buffers immediately
         }
-        
+
         return vertexBuffer;
     }
     
@@ -159,6 +169,20 @@ public:
     BufferResourcePtr CreateIndexBuffer(const void* data, VkDeviceSize size, BufferPoolType poolType) {
         BufferUsageHints hints;
         hints.cpuWriteOnce = true;
+        auto indexBuffer = CreateBuffer(
+            size,
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            BufferCategory::IndexBuffer,
+            poolType,
+            hints
+        );
+
+        // Hot path through the staging ring - same as vertex buffer
+        if (StageUpload(data, size, indexBuffer)) {
+            return indexBuffer;
+        }
+
         auto stagingBuffer = CreateBuffer(
             size,
             VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
@@ -168,16 +192,8 @@ public:
             hints
         );
         stagingBuffer->UpdateData(data, size);
-        auto indexBuffer = CreateBuffer(
-            size,
-            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-            BufferCategory::IndexBuffer,
-            poolType,
-            hints
-        );
         CopyBuffer(stagingBuffer, indexBuffer, size);
-        
+
         // Staging buffer cleanup - same as vertex buffer
         if (m_currentMemoryUsage.load() > m_memoryBudget * 0.8) {
             LOG_DEBUG("BufferManagementSystem", "High memory pressure detected, triggering GC");
@@ -245,6 +261,7 @@ public:
         uint32_t count = 3) {
         
         auto multiBuffered = std::make_shared<MultiBufferedResource>();
+        multiBuffered->device = m_device;  // Enables per-slot fence polling
         multiBuffered->buffers.reserve(count);
         
         BufferUsageHints hints;
@@ -331,13 +348,16 @@ public:
             }
         }
     }
-    
+
+    // Fragmentation above this triggers a compaction pass for the pool
+    static constexpr float kCompactionThreshold = 0.3f;
+
     void DefragmentMemory() {
         using namespace Core::Threading;
-        
+
         auto& jobSystem = JobSystem::Instance();
         for (const auto& pair : m_pools) {
-            if (pair.second) {
+            if (pair.second && pair.second->GetFragmentation() >= kCompactionThreshold) {
                 auto poolPtr = pair.second.get();
                 jobSystem.CreateAndSchedule<void>([poolPtr]() {
                     poolPtr->DefragmentAsync();
@@ -352,14 +372,44 @@ public:
         std::unordered_map<BufferCategory, VkDeviceSize> memoryByCategory;
         size_t activeBuffers = 0;
         size_t cachedBuffers = 0;
+
+        // Pool fragmentation (see BufferPool::GetFragmentation); the max is
+        // what DefragmentMemory compares against kCompactionThreshold
+        std::unordered_map<BufferCategory, float> fragmentationByCategory;
+        float maxPoolFragmentation = 0.0f;
+
+        // Staging ring occupancy at the time of the query - occupancy that
+        // hovers near 1.0 means uploads are spilling to the fallback path
+        // and the ring should be sized up
+        VkDeviceSize stagingRingCapacity = 0;
+        VkDeviceSize stagingRingUsed = 0;
+        size_t stagingRingInFlight = 0;
+        float stagingRingOccupancy = 0.0f;
     };
-    
+
     BufferStats GetStatistics() const {
         std::shared_lock<std::shared_mutex> lock(m_bufferMutex);
-        
+
         BufferStats stats;
         stats.totalMemory = m_currentMemoryUsage.load(std::memory_order_acquire);
-        
+
+        for (const auto& [category, pool] : m_pools) {
+            if (!pool) continue;
+            float fragmentation = pool->GetFragmentation();
+            stats.fragmentationByCategory[category] = fragmentation;
+            stats.maxPoolFragmentation = std::max(stats.maxPoolFragmentation, fragmentation);
+        }
+
+        {
+            std::lock_guard<std::mutex> ringLock(m_stagingRingMutex);
+            stats.stagingRingCapacity = m_stagingRing.capacity;
+            stats.stagingRingUsed = m_stagingRing.used;
+            stats.stagingRingInFlight = m_stagingRing.inFlight.size();
+            stats.stagingRingOccupancy = m_stagingRing.capacity > 0
+                ? static_cast<float>(m_stagingRing.used) / static_cast<float>(m_stagingRing.capacity)
+                : 0.0f;
+        }
+
         for (const auto& [category, buffers] : m_buffersByCategory) {
             stats.buffersByCategory[category] = buffers.size();
             
@@ -408,6 +458,12 @@ public:
     }
     void BeginFrame(uint32_t frameIndex) {
         BufferResource::IncrementFrameCounter();
+        {
+            // Non-blocking: reclaim ring space for uploads whose fences have
+            // already signalled so the frame starts with maximum headroom
+            std::lock_guard<std::mutex> ringLock(m_stagingRingMutex);
+            RetireCompletedUploadsLocked();
+        }
         for (auto& [category, buffers] : m_buffersByCategory) {
             for (auto& buffer : buffers) {
                 if (buffer && buffer->GetHints().frameInFlightCount > 1) {
@@ -426,9 +482,31 @@ public:
             OptimizeMemoryUsage();
         }
     }
+
+    // Block until every ring upload has completed on the transfer queue.
+    // Ring uploads are submitted without waiting, so callers that need the
+    // destination contents on the GPU this frame (or before teardown) must
+    // flush; normal frame-to-frame uploads are retired lazily in BeginFrame.
+    void FlushStagingUploads() {
+        std::lock_guard<std::mutex> ringLock(m_stagingRingMutex);
+        for (auto& region : m_stagingRing.inFlight) {
+            if (region.fence != VK_NULL_HANDLE) {
+                vkWaitForFences(m_device, 1, &region.fence, VK_TRUE, UINT64_MAX);
+            }
+        }
+        RetireCompletedUploadsLocked();
+    }
     void Shutdown() {
         LOG_DEBUG("BufferManagementSystem", "Shutting down BufferManagementSystem...");
-        
+
+        // Drain the staging ring before buffers are torn down - in-flight
+        // uploads still reference the ring buffer and their command pools
+        FlushStagingUploads();
+        {
+            std::lock_guard<std::mutex> ringLock(m_stagingRingMutex);
+            m_stagingRing = StagingRing{};
+        }
+
         // Check if we're in a valid state for shutdown
         if (m_device == VK_NULL_HANDLE) {
             LOG_DEBUG("BufferManagementSystem", "Device already invalid, skipping device operations");
@@ -804,6 +882,253 @@ private:
         VkDeviceSize currentUsage = m_currentMemoryUsage.load(std::memory_order_acquire);
         return (currentUsage + requestedSize) <= m_memoryBudget;
     }
+
+    // ============ Persistent-mapped staging ring ============
+    // One large host-visible allocation mapped once at Initialize and
+    // suballocated as a FIFO ring, so the per-frame upload hot path is a
+    // memcpy plus a recorded copy command - no buffer creation and no
+    // map/unmap syscalls per upload. Each upload's ring region stays
+    // reserved until its transfer fence signals; regions retire in
+    // submission order, so head/tail accounting reduces to a byte count
+    // per region (wrap-around waste is folded into the region that wraps).
+
+    static constexpr VkDeviceSize kStagingRingSize = 64ULL * 1024 * 1024;
+    static constexpr VkDeviceSize kStagingRingAlignment = 256; // Covers optimalBufferCopyOffsetAlignment on common hardware
+
+    struct StagingRingRegion {
+        VkDeviceSize bytes = 0;                       // Reserved ring bytes (aligned size + wrap waste)
+        VkFence fence = VK_NULL_HANDLE;               // Signals when the copy has completed
+        VkCommandPool commandPool = VK_NULL_HANDLE;   // Owns the copy command buffer; freed on retire
+    };
+
+    struct StagingRing {
+        BufferResourcePtr buffer;
+        uint8_t* mapped = nullptr;
+        VkDeviceSize capacity = 0;
+        VkDeviceSize head = 0;  // Next write offset
+        VkDeviceSize used = 0;  // Reserved bytes awaiting fence retirement
+        std::vector<StagingRingRegion> inFlight;  // FIFO, submission order
+    };
+
+    StagingRing m_stagingRing;
+    mutable std::mutex m_stagingRingMutex;
+
+    void InitializeStagingRing() {
+        if (m_transferQueue == VK_NULL_HANDLE) {
+            LOG_DEBUG("BufferManagementSystem", "No transfer queue - staging ring disabled, uploads use per-upload staging");
+            return;
+        }
+
+        BufferUsageHints ringHints;
+        ringHints.cpuWriteOften = true;
+        ringHints.persistentMapped = true;
+        try {
+            m_stagingRing.buffer = CreateBuffer(
+                kStagingRingSize,
+                VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                BufferCategory::StagingBuffer,
+                ringHints
+            );
+        } catch (const std::exception& e) {
+            LOG_WARN("BufferManagementSystem", "Failed to create staging ring: {} - uploads use per-upload staging", e.what());
+            return;
+        }
+
+        m_stagingRing.mapped = static_cast<uint8_t*>(m_stagingRing.buffer->GetMappedPtr());
+        if (!m_stagingRing.mapped) {
+            LOG_WARN("BufferManagementSystem", "Failed to persistently map staging ring - uploads use per-upload staging");
+            m_stagingRing.buffer.reset();
+            return;
+        }
+        m_stagingRing.capacity = kStagingRingSize;
+        LOG_INFO("BufferManagement", "Staging ring initialized: {} MB persistently mapped", kStagingRingSize / (1024 * 1024));
+    }
+
+    // Reserve an aligned ring region; returns false when the upload does not
+    // fit until in-flight fences retire (caller falls back to legacy staging)
+    bool RingAllocateLocked(VkDeviceSize size, VkDeviceSize& outOffset, VkDeviceSize& outReserved) {
+        VkDeviceSize alignedSize = (size + kStagingRingAlignment - 1) & ~(kStagingRingAlignment - 1);
+        if (alignedSize > m_stagingRing.capacity) {
+            return false;
+        }
+
+        // Empty ring: restart at zero for maximum contiguous space
+        if (m_stagingRing.used == 0) {
+            m_stagingRing.head = 0;
+        }
+
+        VkDeviceSize offset = m_stagingRing.head;
+        VkDeviceSize wasted = 0;
+        if (offset + alignedSize > m_stagingRing.capacity) {
+            // Wrap: the unusable bytes at the end stay reserved as part of
+            // this region and come back when its fence retires
+            wasted = m_stagingRing.capacity - offset;
+            offset = 0;
+        }
+        if (m_stagingRing.used + wasted + alignedSize > m_stagingRing.capacity) {
+            return false;
+        }
+
+        m_stagingRing.head = offset + alignedSize;
+        if (m_stagingRing.head == m_stagingRing.capacity) {
+            m_stagingRing.head = 0;
+        }
+        m_stagingRing.used += wasted + alignedSize;
+        outOffset = offset;
+        outReserved = wasted + alignedSize;
+        return true;
+    }
+
+    // Pop completed uploads off the front of the FIFO, releasing their ring
+    // bytes and per-submit command pools. Non-blocking: stops at the first
+    // fence that has not signalled (regions retire in submission order)
+    void RetireCompletedUploadsLocked() {
+        size_t retired = 0;
+        for (const auto& region : m_stagingRing.inFlight) {
+            if (region.fence != VK_NULL_HANDLE &&
+                vkGetFenceStatus(m_device, region.fence) != VK_SUCCESS) {
+                break;
+            }
+            if (region.fence != VK_NULL_HANDLE) {
+                vkDestroyFence(m_device, region.fence, nullptr);
+            }
+            if (region.commandPool != VK_NULL_HANDLE) {
+                vkDestroyCommandPool(m_device, region.commandPool, nullptr);
+            }
+            m_stagingRing.used -= region.bytes;
+            ++retired;
+        }
+        if (retired > 0) {
+            m_stagingRing.inFlight.erase(m_stagingRing.inFlight.begin(),
+                                         m_stagingRing.inFlight.begin() + retired);
+        }
+    }
+
+    // Record and submit the ring->destination copy without waiting; the
+    // returned fence tracks the region. Mirrors CopyDeviceLocalBuffer's
+    // transient pool + release barrier, minus the synchronous fence wait
+    bool SubmitRingCopyLocked(VkDeviceSize srcOffset, VkDeviceSize size,
+                              const BufferResourcePtr& dst, StagingRingRegion& region) {
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = m_transferQueueFamily;
+
+        VkCommandPool commandPool;
+        if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &commandPool) != VK_SUCCESS) {
+            LOG_ERROR("BufferManagementSystem", "Failed to create command pool for ring upload");
+            return false;
+        }
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandPool = commandPool;
+        allocInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commandBuffer;
+        if (vkAllocateCommandBuffers(m_device, &allocInfo, &commandBuffer) != VK_SUCCESS) {
+            vkDestroyCommandPool(m_device, commandPool, nullptr);
+            LOG_ERROR("BufferManagementSystem", "Failed to allocate command buffer for ring upload");
+            return false;
+        }
+
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        VkFence fence;
+        if (vkCreateFence(m_device, &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+            vkDestroyCommandPool(m_device, commandPool, nullptr);
+            LOG_ERROR("BufferManagementSystem", "Failed to create fence for ring upload");
+            return false;
+        }
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+        VkBufferCopy copyRegion{};
+        copyRegion.srcOffset = srcOffset;
+        copyRegion.dstOffset = 0;
+        copyRegion.size = size;
+        vkCmdCopyBuffer(commandBuffer, m_stagingRing.buffer->GetBuffer(), dst->GetBuffer(), 1, &copyRegion);
+
+        // Release barrier when the transfer queue family differs from the
+        // graphics family - same policy as CopyDeviceLocalBuffer
+        if (m_transferQueueFamily != 0) {
+            VkBufferMemoryBarrier releaseBarrier{};
+            releaseBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            releaseBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            releaseBarrier.dstAccessMask = 0;
+            releaseBarrier.srcQueueFamilyIndex = m_transferQueueFamily;
+            releaseBarrier.dstQueueFamilyIndex = 0; // Graphics queue family
+            releaseBarrier.buffer = dst->GetBuffer();
+            releaseBarrier.offset = 0;
+            releaseBarrier.size = size;
+
+            vkCmdPipelineBarrier(commandBuffer,
+                VK_PIPELINE_STAGE_TRANSFER_BIT,
+                VK_PIPELINE_STAGE_TRANSFER_BIT,
+                0, 0, nullptr, 1, &releaseBarrier, 0, nullptr);
+        }
+
+        vkEndCommandBuffer(commandBuffer);
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+
+        if (vkQueueSubmit(m_transferQueue, 1, &submitInfo, fence) != VK_SUCCESS) {
+            vkDestroyFence(m_device, fence, nullptr);
+            vkDestroyCommandPool(m_device, commandPool, nullptr);
+            LOG_ERROR("BufferManagementSystem", "Failed to submit ring upload");
+            return false;
+        }
+
+        region.fence = fence;
+        region.commandPool = commandPool;
+        return true;
+    }
+
+    // Upload through the ring: retire what has completed, reserve a region,
+    // memcpy (ring memory is HOST_COHERENT, no flush needed) and submit the
+    // copy. Returns false when the ring is unavailable or cannot fit the
+    // upload, in which case the caller takes the per-upload staging path
+    bool StageUpload(const void* data, VkDeviceSize size, const BufferResourcePtr& dst) {
+        if (!m_stagingRing.mapped || !dst || size == 0) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> ringLock(m_stagingRingMutex);
+        RetireCompletedUploadsLocked();
+
+        VkDeviceSize previousHead = m_stagingRing.head;
+        VkDeviceSize previousUsed = m_stagingRing.used;
+        VkDeviceSize offset = 0;
+        VkDeviceSize reserved = 0;
+        if (!RingAllocateLocked(size, offset, reserved)) {
+            LOG_DEBUG("BufferManagementSystem", "Staging ring cannot fit {} bytes ({} in flight) - falling back to per-upload staging",
+                     size, m_stagingRing.used);
+            return false;
+        }
+
+        std::memcpy(m_stagingRing.mapped + offset, data, size);
+
+        StagingRingRegion region;
+        region.bytes = reserved;
+        if (!SubmitRingCopyLocked(offset, size, dst, region)) {
+            // Roll the reservation back; nothing references the region
+            m_stagingRing.head = previousHead;
+            m_stagingRing.used = previousUsed;
+            return false;
+        }
+
+        m_stagingRing.inFlight.push_back(region);
+        return true;
+    }
 public:
     void* MapBuffer(const BufferResourcePtr& buffer, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE) {
         if (!buffer) return nullptr;
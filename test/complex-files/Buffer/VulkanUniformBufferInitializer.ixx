@@ -55,6 +55,17 @@ public:
      * Create compute-specific uniform buffers
      */
     bool CreateComputeBuffers();
+
+    /**
+     * Create a batched per-object uniform buffer (dynamic offsets)
+     *
+     * Sizes one large dynamic uniform buffer for maxObjects elements per
+     * frame in flight and registers it with the uniform manager, so the
+     * hundreds of per-patch uniform buffers collapse into a single
+     * allocation addressed by dynamic offset at bind time.
+     */
+    bool CreateBatchedBuffer(const std::string& name, size_t elementSize,
+                             uint32_t maxObjects);
     
     /**
      * Validate that all requested buffers were created successfully
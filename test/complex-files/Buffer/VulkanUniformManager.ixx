@@ -44,6 +44,17 @@ export namespace PlanetGen::Rendering
     VkBuffer GetBuffer() const;
   };
 
+  // Batched per-object uniforms: one large dynamic uniform buffer holding
+  // maxObjects elements per frame in flight, bound once per frame with
+  // VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC and addressed per draw via a
+  // dynamic offset instead of per-object buffers and descriptor updates
+  struct BatchedUniformConfig
+  {
+    VkDeviceSize elementSize = 0;   // Unaligned per-object payload size
+    uint32_t maxObjects = 0;        // Elements reserved per frame in flight
+    uint32_t framesInFlight = 3;
+  };
+
   class VulkanUniformManager
   {
   public:
@@ -72,9 +83,42 @@ export namespace PlanetGen::Rendering
     bool UpdatePushConstants(VulkanCommandBuffer *cmdBuffer,
                              VkPipelineLayout pipelineLayout,
                              const PushConstantConfig &config, const void *data);
+    // Batched mode: element stride is elementSize aligned up to
+    // minUniformBufferOffsetAlignment; total allocation is
+    // stride * maxObjects * framesInFlight (sized through
+    // VulkanUniformBufferInitializer so the standard buffers and the batch
+    // share one creation path)
+    bool CreateBatchedUniformBuffer(const std::string &name,
+                                    const BatchedUniformConfig &config);
+    // Writes one object's payload into its slot for the given frame and
+    // returns the dynamic offset to pass at bind time; UINT32_MAX on failure
+    uint32_t WriteBatchedElement(const std::string &name, uint32_t objectIndex,
+                                 const void *data, VkDeviceSize size,
+                                 uint32_t currentFrame);
+    uint32_t GetBatchedDynamicOffset(const std::string &name,
+                                     uint32_t objectIndex,
+                                     uint32_t currentFrame) const;
+    // Descriptor write coalescing: queued writes accumulate (buffer infos are
+    // kept stable alongside them) and FlushDescriptorWrites issues a single
+    // vkUpdateDescriptorSets for everything queued this frame
+    bool QueueDescriptorWrite(const std::string &bufferName,
+                              VkDescriptorSet descriptorSet, uint32_t binding,
+                              VkDescriptorType descriptorType,
+                              uint32_t currentFrame = 0);
+    void FlushDescriptorWrites();
   private:
+    struct BatchedUniformBuffer
+    {
+      UniformBuffer buffer;
+      VkDeviceSize elementStride = 0;  // elementSize aligned to device minimum
+      uint32_t maxObjects = 0;
+      uint32_t framesInFlight = 0;
+    };
     VulkanBase *m_base;
     std::unordered_map<std::string, UniformBuffer> m_uniformBuffers;
+    std::unordered_map<std::string, BatchedUniformBuffer> m_batchedBuffers;
+    std::vector<VkWriteDescriptorSet> m_pendingDescriptorWrites;
+    std::vector<VkDescriptorBufferInfo> m_pendingBufferInfos;
     VkDeviceSize GetAlignedSize(VkDeviceSize size, VkDeviceSize alignment) const;
   };
 
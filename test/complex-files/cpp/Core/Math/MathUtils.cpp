@@ -1,9 +1,56 @@
 #include "Core/Math/MathUtils.h"
+#include <cassert>
 
 namespace PlanetGen {
 namespace Core {
 namespace Math {
 namespace MathUtils {
+
+void fastSinSpan(std::span<const float> input, std::span<float> output) {
+    assert(output.size() >= input.size());
+    const size_t count = input.size();
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(&output[i], fastSin8(_mm256_loadu_ps(&input[i])));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = fastSin(input[i]);
+    }
+}
+
+void fastCosSpan(std::span<const float> input, std::span<float> output) {
+    assert(output.size() >= input.size());
+    const size_t count = input.size();
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(&output[i], fastCos8(_mm256_loadu_ps(&input[i])));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = fastCos(input[i]);
+    }
+}
+
+void fastExpSpan(std::span<const float> input, std::span<float> output) {
+    assert(output.size() >= input.size());
+    const size_t count = input.size();
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(&output[i], fastExp8(_mm256_loadu_ps(&input[i])));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = fastExp(input[i]);
+    }
+}
+
 float sphericalHarmonicY00(const Vector3& dir) {
     return 0.28209479177387814f;
 }
@@ -1,9 +1,71 @@
-#include "Core/Math/Matrix4.h"
-
-namespace PlanetGen {
-namespace Core {
-namespace Math {
-
-} // namespace Math
-} // namespace Core
-} // namespace PlanetGen 
+#include "Core/Math/Matrix4.h"
+#include "Core/Math/SimdUtils.h"
+#include <cassert>
+
+namespace PlanetGen {
+namespace Core {
+namespace Math {
+
+void TransformPoints(const Matrix4& transform,
+                     std::span<const glm::vec3> input,
+                     std::span<glm::vec3> output) {
+    assert(output.size() >= input.size());
+
+    const glm::mat4 m = transform;  // Column-major: m[col][row]
+    const size_t count = input.size();
+    size_t i = 0;
+
+#if defined(PLANETGEN_MATH_SSE)
+    const __m128 m00 = _mm_set1_ps(m[0][0]), m10 = _mm_set1_ps(m[1][0]);
+    const __m128 m20 = _mm_set1_ps(m[2][0]), m30 = _mm_set1_ps(m[3][0]);
+    const __m128 m01 = _mm_set1_ps(m[0][1]), m11 = _mm_set1_ps(m[1][1]);
+    const __m128 m21 = _mm_set1_ps(m[2][1]), m31 = _mm_set1_ps(m[3][1]);
+    const __m128 m02 = _mm_set1_ps(m[0][2]), m12 = _mm_set1_ps(m[1][2]);
+    const __m128 m22 = _mm_set1_ps(m[2][2]), m32 = _mm_set1_ps(m[3][2]);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        detail::LoadVec3SoA4(&input[i].x, x, y, z);
+
+        __m128 rx = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)),
+            _mm_add_ps(_mm_mul_ps(z, m20), m30));
+        __m128 ry = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)),
+            _mm_add_ps(_mm_mul_ps(z, m21), m31));
+        __m128 rz = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)),
+            _mm_add_ps(_mm_mul_ps(z, m22), m32));
+
+        detail::StoreVec3SoA4(&output[i].x, rx, ry, rz);
+    }
+#elif defined(PLANETGEN_MATH_NEON)
+    const float32x4_t m00 = vdupq_n_f32(m[0][0]), m10 = vdupq_n_f32(m[1][0]);
+    const float32x4_t m20 = vdupq_n_f32(m[2][0]), m30 = vdupq_n_f32(m[3][0]);
+    const float32x4_t m01 = vdupq_n_f32(m[0][1]), m11 = vdupq_n_f32(m[1][1]);
+    const float32x4_t m21 = vdupq_n_f32(m[2][1]), m31 = vdupq_n_f32(m[3][1]);
+    const float32x4_t m02 = vdupq_n_f32(m[0][2]), m12 = vdupq_n_f32(m[1][2]);
+    const float32x4_t m22 = vdupq_n_f32(m[2][2]), m32 = vdupq_n_f32(m[3][2]);
+
+    for (; i + 4 <= count; i += 4) {
+        float32x4x3_t v = vld3q_f32(&input[i].x);
+
+        float32x4x3_t r;
+        r.val[0] = vmlaq_f32(vmlaq_f32(vmlaq_f32(m30, v.val[0], m00), v.val[1], m10), v.val[2], m20);
+        r.val[1] = vmlaq_f32(vmlaq_f32(vmlaq_f32(m31, v.val[0], m01), v.val[1], m11), v.val[2], m21);
+        r.val[2] = vmlaq_f32(vmlaq_f32(vmlaq_f32(m32, v.val[0], m02), v.val[1], m12), v.val[2], m22);
+
+        vst3q_f32(&output[i].x, r);
+    }
+#endif
+
+    // Scalar tail (and full path without SIMD support)
+    for (; i < count; ++i) {
+        glm::vec4 result = m * glm::vec4(input[i], 1.0f);
+        output[i] = glm::vec3(result);
+    }
+}
+
+}  // namespace Math
+}  // namespace Core
+}  // namespace PlanetGen
@@ -1,9 +1,59 @@
-#include "Core/Math/Vector3.h"
-
-namespace PlanetGen {
-namespace Core {
-namespace Math {
-
-}  // namespace Math
-}  // namespace Core
-}  // namespace PlanetGen
+#include "Core/Math/Vector3.h"
+#include "Core/Math/SimdUtils.h"
+#include <cassert>
+
+namespace PlanetGen {
+namespace Core {
+namespace Math {
+
+void NormalizeBatch(std::span<const glm::vec3> input, std::span<glm::vec3> output) {
+    assert(output.size() >= input.size());
+
+    const size_t count = input.size();
+    size_t i = 0;
+
+#if defined(PLANETGEN_MATH_SSE)
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        detail::LoadVec3SoA4(&input[i].x, x, y, z);
+
+        __m128 lengthSq = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+            _mm_mul_ps(z, z));
+
+        // Full-precision sqrt/div; rsqrt's ~12-bit estimate drifts surface
+        // normals visibly at planet scale
+        __m128 invLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lengthSq));
+
+        detail::StoreVec3SoA4(&output[i].x,
+                              _mm_mul_ps(x, invLength),
+                              _mm_mul_ps(y, invLength),
+                              _mm_mul_ps(z, invLength));
+    }
+#elif defined(PLANETGEN_MATH_NEON)
+    for (; i + 4 <= count; i += 4) {
+        // vld3/vst3 de-interleave packed vec3s into x/y/z lanes directly
+        float32x4x3_t v = vld3q_f32(&input[i].x);
+
+        float32x4_t lengthSq = vmlaq_f32(
+            vmlaq_f32(vmulq_f32(v.val[0], v.val[0]), v.val[1], v.val[1]),
+            v.val[2], v.val[2]);
+
+        float32x4_t invLength = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(lengthSq));
+
+        v.val[0] = vmulq_f32(v.val[0], invLength);
+        v.val[1] = vmulq_f32(v.val[1], invLength);
+        v.val[2] = vmulq_f32(v.val[2], invLength);
+        vst3q_f32(&output[i].x, v);
+    }
+#endif
+
+    // Scalar tail (and full path without SIMD support)
+    for (; i < count; ++i) {
+        output[i] = glm::normalize(input[i]);
+    }
+}
+
+}  // namespace Math
+}  // namespace Core
+}  // namespace PlanetGen
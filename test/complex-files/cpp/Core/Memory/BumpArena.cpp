@@ -0,0 +1,80 @@
+#include "Core/Memory/BumpArena.h"
+
+namespace PlanetGen {
+namespace Core {
+namespace Memory {
+
+BumpArena::BumpArena(size_t chunkSize)
+    : m_chunkSize(chunkSize)
+{
+    assert(chunkSize > 0);
+}
+
+void* BumpArena::Allocate(size_t bytes, size_t alignment) {
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+    if (bytes == 0) {
+        bytes = 1;
+    }
+
+    if (!m_chunks.empty()) {
+        Chunk& chunk = m_chunks.back();
+        size_t aligned = (chunk.offset + alignment - 1) & ~(alignment - 1);
+        if (aligned + bytes <= chunk.size) {
+            chunk.offset = aligned + bytes;
+            return chunk.data.get() + aligned;
+        }
+    }
+
+    AddChunk(bytes + alignment);
+
+    Chunk& chunk = m_chunks.back();
+    uintptr_t base = reinterpret_cast<uintptr_t>(chunk.data.get());
+    size_t aligned = ((base + alignment - 1) & ~(alignment - 1)) - base;
+    chunk.offset = aligned + bytes;
+    return chunk.data.get() + aligned;
+}
+
+void BumpArena::Reset() {
+    if (m_chunks.empty()) {
+        return;
+    }
+
+    // Chunks grow geometrically, so the newest chunk is the largest; keep it
+    // and rewind so the next run allocates nothing in steady state
+    Chunk retained = std::move(m_chunks.back());
+    retained.offset = 0;
+    m_chunks.clear();
+    m_chunks.push_back(std::move(retained));
+}
+
+size_t BumpArena::GetUsedBytes() const {
+    size_t used = 0;
+    for (const Chunk& chunk : m_chunks) {
+        used += chunk.offset;
+    }
+    return used;
+}
+
+size_t BumpArena::GetCapacityBytes() const {
+    size_t capacity = 0;
+    for (const Chunk& chunk : m_chunks) {
+        capacity += chunk.size;
+    }
+    return capacity;
+}
+
+void BumpArena::AddChunk(size_t minBytes) {
+    size_t newSize = m_chunks.empty() ? m_chunkSize : m_chunks.back().size * 2;
+    while (newSize < minBytes) {
+        newSize *= 2;
+    }
+
+    Chunk chunk;
+    chunk.data = std::make_unique<uint8_t[]>(newSize);
+    chunk.size = newSize;
+    m_chunks.push_back(std::move(chunk));
+}
+
+} // namespace Memory
+} // namespace Core
+} // namespace PlanetGen
@@ -1,84 +1,162 @@
-#include "Core/Memory/MemoryPool.h"
-#include <stdexcept>
-
-namespace PlanetGen {
-namespace Core {
-namespace Memory {
-
-MemoryPool::MemoryPool(size_t blockSize, size_t initialCapacity, float growthFactor)
-    : m_blockSize(blockSize)
-    , m_growthFactor(growthFactor)
-{
-    assert(blockSize >= sizeof(void*));
-    assert(growthFactor > 1.0f);
-    assert(initialCapacity > 0);
-    Reserve(initialCapacity);
-}
-
-void* MemoryPool::Allocate() {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (!m_freeList) {
-        if (!Grow()) {
-            return nullptr;
-        }
-    }
-    void* block = m_freeList;
-    m_freeList = *reinterpret_cast<void**>(block);
-    ++m_usedBlocks;
-    
-    return block;
-}
-
-void MemoryPool::Deallocate(void* block) {
-    if (!block) {
-        return;
-    }
-    
-    std::lock_guard<std::mutex> lock(m_mutex);
-    *reinterpret_cast<void**>(block) = m_freeList;
-    m_freeList = block;
-    --m_usedBlocks;
-}
-
-size_t MemoryPool::GetTotalBlocks() const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_blocks.size() * m_blocksPerChunk;
-}
-
-size_t MemoryPool::GetUsedBlocks() const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_usedBlocks;
-}
-
-void MemoryPool::Reserve(size_t minCapacity) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    while (GetTotalBlocks() < minCapacity) {
-        if (!Grow()) {
-            break;
-        }
-    }
-}
-
-bool MemoryPool::Grow() {
-    const size_t newChunkSize = m_blocks.empty() 
-        ? m_initialChunkSize 
-        : static_cast<size_t>(m_blocks.back().size() * m_growthFactor);
-    std::vector<uint8_t> newChunk(newChunkSize * m_blockSize);
-    if (newChunk.empty()) {
-        return false;
-    }
-    for (size_t i = 0; i < newChunkSize; ++i) {
-        void* const block = &newChunk[i * m_blockSize];
-        *reinterpret_cast<void**>(block) = m_freeList;
-        m_freeList = block;
-    }
-    m_blocks.push_back(std::move(newChunk));
-    m_blocksPerChunk = newChunkSize;
-    
-    return true;
-}
-
-} // namespace Memory
-} // namespace Core
-} // namespace PlanetGen 
+#include "Core/Memory/MemoryPool.h"
+#include <atomic>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace PlanetGen {
+namespace Core {
+namespace Memory {
+
+namespace {
+// Distinguishes pools that happen to reuse the same address, so a stale
+// thread-cache entry is never mistaken for a live binding
+std::atomic<uint64_t> s_nextPoolId{1};
+} // namespace
+
+// Per-thread map from pool to magazine. Outstanding blocks are flushed back
+// to their pool when the thread exits, which is why a pool must outlive the
+// threads that allocate from it.
+struct MemoryPool::ThreadCache {
+    struct Entry {
+        MemoryPool* pool = nullptr;
+        uint64_t poolId = 0;
+        Magazine magazine;
+    };
+
+    std::unordered_map<const void*, Entry> entries;
+
+    ~ThreadCache() {
+        for (auto& [key, entry] : entries) {
+            if (entry.pool && entry.magazine.count > 0) {
+                entry.pool->FlushMagazine(entry.magazine, 0);
+            }
+        }
+    }
+};
+
+MemoryPool::MemoryPool(size_t blockSize, size_t initialCapacity, float growthFactor)
+    : m_blockSize(blockSize)
+    , m_growthFactor(growthFactor)
+    , m_poolId(s_nextPoolId.fetch_add(1, std::memory_order_relaxed))
+{
+    assert(blockSize >= sizeof(void*));
+    assert(growthFactor > 1.0f);
+    assert(initialCapacity > 0);
+    Reserve(initialCapacity);
+}
+
+void* MemoryPool::Allocate() {
+    Magazine& magazine = GetMagazine();
+    if (magazine.count == 0) {
+        if (!RefillMagazine(magazine)) {
+            return nullptr;
+        }
+    }
+    return magazine.blocks[--magazine.count];
+}
+
+void MemoryPool::Deallocate(void* block) {
+    if (!block) {
+        return;
+    }
+
+    Magazine& magazine = GetMagazine();
+    if (magazine.count == kMagazineSize) {
+        // Keep half so the next few allocations stay thread-local
+        FlushMagazine(magazine, kMagazineSize / 2);
+    }
+    magazine.blocks[magazine.count++] = block;
+}
+
+size_t MemoryPool::GetTotalBlocks() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return TotalBlocksLocked();
+}
+
+size_t MemoryPool::GetUsedBlocks() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_usedBlocks;
+}
+
+void MemoryPool::Reserve(size_t minCapacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    while (TotalBlocksLocked() < minCapacity) {
+        if (!GrowLocked()) {
+            break;
+        }
+    }
+}
+
+MemoryPool::Magazine& MemoryPool::GetMagazine() {
+    thread_local ThreadCache t_cache;
+
+    ThreadCache::Entry& entry = t_cache.entries[this];
+    if (entry.pool != this || entry.poolId != m_poolId) {
+        // First use on this thread, or a stale entry from a destroyed pool
+        // that reused this address; its blocks died with that pool
+        entry.pool = this;
+        entry.poolId = m_poolId;
+        entry.magazine.count = 0;
+    }
+    return entry.magazine;
+}
+
+bool MemoryPool::RefillMagazine(Magazine& magazine) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    while (magazine.count < kMagazineSize) {
+        if (!m_freeList) {
+            if (magazine.count > 0) {
+                break; // Partial refill is fine
+            }
+            if (!GrowLocked()) {
+                return false;
+            }
+            continue;
+        }
+        void* block = m_freeList;
+        m_freeList = *reinterpret_cast<void**>(block);
+        magazine.blocks[magazine.count++] = block;
+        ++m_usedBlocks;
+    }
+    return true;
+}
+
+void MemoryPool::FlushMagazine(Magazine& magazine, size_t keepCount) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    while (magazine.count > keepCount) {
+        void* block = magazine.blocks[--magazine.count];
+        *reinterpret_cast<void**>(block) = m_freeList;
+        m_freeList = block;
+        --m_usedBlocks;
+    }
+}
+
+size_t MemoryPool::TotalBlocksLocked() const {
+    return m_blocks.size() * m_blocksPerChunk;
+}
+
+bool MemoryPool::GrowLocked() {
+    const size_t newChunkSize = m_blocks.empty()
+        ? m_initialChunkSize
+        : static_cast<size_t>(m_blocks.back().size() * m_growthFactor);
+    std::vector<uint8_t> newChunk(newChunkSize * m_blockSize);
+    if (newChunk.empty()) {
+        return false;
+    }
+    for (size_t i = 0; i < newChunkSize; ++i) {
+        void* const block = &newChunk[i * m_blockSize];
+        *reinterpret_cast<void**>(block) = m_freeList;
+        m_freeList = block;
+    }
+    m_blocks.push_back(std::move(newChunk));
+    m_blocksPerChunk = newChunkSize;
+
+    return true;
+}
+
+} // namespace Memory
+} // namespace Core
+} // namespace PlanetGen
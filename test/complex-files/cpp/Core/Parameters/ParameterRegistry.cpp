@@ -13,6 +13,128 @@ module Core.Parameters.Registry;
 
 namespace PlanetGen::Core::Parameters {
 
+namespace {
+
+// Validate a staged override against a parameter definition. Mirrors the
+// type coverage of ParameterRegistry::Validate; a type mismatch between the
+// override and the definition counts as a failure.
+bool ValidateStagedValue(const std::type_index& type, const std::any& paramAny,
+                         const std::any& value) {
+    try {
+        if (type == std::type_index(typeid(uint32_t))) {
+            auto param = std::any_cast<std::shared_ptr<Parameter<uint32_t>>>(paramAny);
+            return param->validate(std::any_cast<uint32_t>(value));
+        } else if (type == std::type_index(typeid(float))) {
+            auto param = std::any_cast<std::shared_ptr<Parameter<float>>>(paramAny);
+            return param->validate(std::any_cast<float>(value));
+        }
+        // Add other types as needed
+        return true;
+    } catch (const std::bad_any_cast&) {
+        return false;
+    }
+}
+
+} // namespace
+
+void ParameterRegistry::RepublishSnapshotLocked() {
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->entries.resize(m_idNames.size());
+
+    for (ParameterId id = 0; id < m_idNames.size(); ++id) {
+        const std::string& name = m_idNames[id];
+
+        // Effective value: runtime override wins over the registered default
+        auto overrideIt = m_runtimeOverrides.find(name);
+        if (overrideIt != m_runtimeOverrides.end()) {
+            snapshot->entries[id] = overrideIt->second;
+            continue;
+        }
+
+        auto paramIt = m_parameters.find(name);
+        if (paramIt != m_parameters.end()) {
+            snapshot->entries[id] = paramIt->second;
+        }
+    }
+
+    m_snapshot.store(std::move(snapshot), std::memory_order_release);
+}
+
+ParameterId ParameterRegistry::GetParameterId(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_idMap.find(name);
+    return it != m_idMap.end() ? it->second : kInvalidParameterId;
+}
+
+bool ParameterRegistry::ImportBatch(ParameterBatch&& batch, ParameterMergeStrategy strategy) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    LOG_TRACE("ParameterRegistry", "ImportBatch called");
+
+    // Pass 1: validate the whole batch before touching any state, so a
+    // rejected import leaves the registry exactly as it was
+    for (const auto& [name, value] : batch.m_overrides) {
+        // Constraints come from the batch's own definition when it has one,
+        // otherwise from the already-registered parameter
+        auto batchIt = batch.m_parameters.find(name);
+        if (batchIt != batch.m_parameters.end()) {
+            if (!ValidateStagedValue(batch.m_typeMap.at(name), batchIt->second, value)) {
+                LOG_WARN("ParameterRegistry", "Batch import rejected: override '{}' failed validation", name);
+                return false;
+            }
+            continue;
+        }
+
+        auto paramIt = m_parameters.find(name);
+        if (paramIt != m_parameters.end()) {
+            if (!ValidateStagedValue(m_typeMap.at(name), paramIt->second, value)) {
+                LOG_WARN("ParameterRegistry", "Batch import rejected: override '{}' failed validation", name);
+                return false;
+            }
+        }
+    }
+
+    // Pass 2: publish. The lock is held across the whole splice, so other
+    // threads observe either none of the batch or all of it
+    size_t definitionCount = batch.m_parameters.size();
+    size_t overrideCount = batch.m_overrides.size();
+
+    for (auto& [name, param] : batch.m_parameters) {
+        if (strategy == ParameterMergeStrategy::KeepExisting &&
+            m_parameters.find(name) != m_parameters.end()) {
+            continue;
+        }
+        m_parameters[name] = std::move(param);
+        m_typeMap.insert_or_assign(name, batch.m_typeMap.at(name));
+        InternLocked(name);
+    }
+
+    for (auto& [name, value] : batch.m_overrides) {
+        if (strategy == ParameterMergeStrategy::KeepExisting &&
+            m_runtimeOverrides.find(name) != m_runtimeOverrides.end()) {
+            continue;
+        }
+        m_runtimeOverrides[name] = value;
+
+        // Trigger change callbacks
+        auto callbackIt = m_changeCallbacks.find(name);
+        if (callbackIt != m_changeCallbacks.end()) {
+            for (const auto& callback : callbackIt->second) {
+                callback(value);
+            }
+        }
+    }
+
+    batch.Clear();
+    RepublishSnapshotLocked();
+
+    LOG_INFO("ParameterRegistry", "Imported batch: {} definitions, {} overrides",
+             definitionCount, overrideCount);
+
+    return true;
+}
+
 void ParameterRegistry::LoadFromJson(const ::nlohmann::json& config) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
@@ -169,6 +291,12 @@ void ParameterRegistry::MergeFrom(const ParameterRegistry& other, ParameterMerge
             }
             break;
     }
+
+    // Merged-in parameters need IDs before the snapshot can cover them
+    for (const auto& [name, _] : m_parameters) {
+        InternLocked(name);
+    }
+    RepublishSnapshotLocked();
 }
 
 bool ParameterRegistry::Validate() const {
@@ -34,6 +34,10 @@ std::shared_ptr<ParameterRegistry> ParameterSystemAdapter::GetRegistry() {
     return s_globalRegistry;
 }
 
+ParameterId ParameterSystemAdapter::GetParameterId(const std::string& name) {
+    return GetRegistry()->GetParameterId(name);
+}
+
 void ParameterSystemAdapter::ApplyQualityPreset(const std::string& preset) {
     PlanetParams::ApplyQualityPreset(*GetRegistry(), preset);
 }
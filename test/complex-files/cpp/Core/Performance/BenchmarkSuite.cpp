@@ -0,0 +1,125 @@
+module;
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+module BenchmarkSuite;
+
+namespace PlanetGen::Core::Performance {
+
+namespace {
+
+double NowMs() {
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+void BenchmarkRegistry::Register(std::string name, std::string category,
+                                 uint64_t itemsPerIteration, BenchmarkFn fn) {
+    m_entries.push_back({std::move(name), std::move(category), itemsPerIteration, std::move(fn)});
+}
+
+std::vector<BenchmarkResult> BenchmarkRegistry::RunAll(const BenchmarkOptions& options) const {
+    std::vector<BenchmarkResult> results;
+    results.reserve(m_entries.size());
+
+    for (const auto& entry : m_entries) {
+        if (!options.filter.empty() &&
+            entry.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < options.warmupIterations; ++i) {
+            entry.fn();
+        }
+
+        std::vector<double> samplesMs;
+        samplesMs.reserve(options.measuredIterations);
+        for (uint32_t i = 0; i < options.measuredIterations; ++i) {
+            double begin = NowMs();
+            entry.fn();
+            samplesMs.push_back(NowMs() - begin);
+        }
+
+        BenchmarkResult result;
+        result.name = entry.name;
+        result.category = entry.category;
+        result.iterations = options.measuredIterations;
+        result.itemsPerIteration = entry.itemsPerIteration;
+
+        if (!samplesMs.empty()) {
+            double sum = 0.0;
+            result.minMs = samplesMs.front();
+            result.maxMs = samplesMs.front();
+            for (double sample : samplesMs) {
+                sum += sample;
+                result.minMs = std::min(result.minMs, sample);
+                result.maxMs = std::max(result.maxMs, sample);
+            }
+            result.meanMs = sum / samplesMs.size();
+
+            double variance = 0.0;
+            for (double sample : samplesMs) {
+                double delta = sample - result.meanMs;
+                variance += delta * delta;
+            }
+            result.stdDevMs = std::sqrt(variance / samplesMs.size());
+
+            if (result.meanMs > 0.0) {
+                result.itemsPerSecond =
+                    static_cast<double>(entry.itemsPerIteration) * 1000.0 / result.meanMs;
+            }
+        }
+
+        results.push_back(std::move(result));
+    }
+
+    return results;
+}
+
+bool BenchmarkRegistry::ExportJSON(const std::vector<BenchmarkResult>& results,
+                                   const BenchmarkOptions& options,
+                                   const std::string& filepath) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) return false;
+
+    auto unixSeconds = std::chrono::duration_cast<std::chrono::seconds>(
+                           std::chrono::system_clock::now().time_since_epoch())
+                           .count();
+
+    file << "{\n";
+    file << "  \"timestamp\": " << unixSeconds << ",\n";
+    file << "  \"seed\": " << options.seed << ",\n";
+    file << "  \"warmupIterations\": " << options.warmupIterations << ",\n";
+    file << "  \"measuredIterations\": " << options.measuredIterations << ",\n";
+    file << "  \"benchmarks\": [\n";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        file << "    {\n";
+        file << "      \"name\": \"" << result.name << "\",\n";
+        file << "      \"category\": \"" << result.category << "\",\n";
+        file << "      \"iterations\": " << result.iterations << ",\n";
+        file << "      \"itemsPerIteration\": " << result.itemsPerIteration << ",\n";
+        file << "      \"meanMs\": " << result.meanMs << ",\n";
+        file << "      \"minMs\": " << result.minMs << ",\n";
+        file << "      \"maxMs\": " << result.maxMs << ",\n";
+        file << "      \"stdDevMs\": " << result.stdDevMs << ",\n";
+        file << "      \"itemsPerSecond\": " << result.itemsPerSecond << "\n";
+        file << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    file << "  ]\n";
+    file << "}\n";
+    return true;
+}
+
+} // namespace PlanetGen::Core::Performance
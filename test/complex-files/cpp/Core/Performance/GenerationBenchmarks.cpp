@@ -0,0 +1,300 @@
+// Microbenchmark driver for the generation hot paths. Workloads use fixed
+// seeds and deterministic input streams so two runs of the same binary are
+// directly comparable; results print as a table and optionally export to
+// JSON (see BenchmarkRegistry::ExportJSON) for regression tracking.
+//
+// Usage:
+//   generation_benchmarks [--warmup N] [--iterations N] [--seed N]
+//                         [--filter substring] [--json results.json]
+
+#include "Core/Memory/MemoryPool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import BenchmarkSuite;
+import BiomeClassifier;
+import HeightGenerator;
+import IGPUNoiseAccelerator;
+import NoiseTypes;
+import SimpleNoise;
+import ThreadPool;
+import WorleyNoise;
+
+namespace {
+
+using namespace PlanetGen;
+
+// Keeps the optimizer from discarding benchmark computations
+volatile float g_sink = 0.0f;
+
+// Deterministic input stream (LCG) so every run sees identical positions
+// regardless of platform random sources
+struct DeterministicStream {
+    explicit DeterministicStream(uint32_t seed) : state(seed | 1u) {}
+
+    float NextFloat(float min, float max) {
+        state = state * 1664525u + 1013904223u;
+        float unit = static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+        return min + unit * (max - min);
+    }
+
+    uint32_t state;
+};
+
+// CPU reference accelerator so HeightGenerator::GenerateHeightmap can be
+// benchmarked without a Vulkan device. Evaluates the layer stack with
+// NoiseProvider; the grid-dispatch and async entry points are not needed
+// by the heightmap path and report unsupported.
+class CpuNoiseAccelerator : public Generation::IGPUNoiseAccelerator {
+public:
+    bool Initialize(Rendering::Noise::NoiseType) override { return true; }
+    void Cleanup() override {}
+    bool IsInitialized() const override { return true; }
+
+    bool GenerateNoise2D(const Rendering::Noise::GPUNoiseParameters&, float*,
+                         uint32_t, uint32_t) override {
+        return false;
+    }
+
+    bool GenerateNoise3D(const Rendering::Noise::GPUNoiseParameters&, float*,
+                         uint32_t, uint32_t, uint32_t) override {
+        return false;
+    }
+
+    std::optional<AsyncNoiseHandle> BeginNoiseGeneration2D(
+        const Rendering::Noise::GPUNoiseParameters&, uint32_t, uint32_t) override {
+        return std::nullopt;
+    }
+
+    std::optional<AsyncNoiseHandle> BeginNoiseGeneration3D(
+        const Rendering::Noise::GPUNoiseParameters&, uint32_t, uint32_t, uint32_t) override {
+        return std::nullopt;
+    }
+
+    bool EndNoiseGeneration(const AsyncNoiseHandle&, float*) override { return false; }
+
+    bool GeneratePlanetaryElevation(
+        const std::vector<std::pair<float, float>>& coordinates,
+        const std::vector<Rendering::Noise::SimpleNoiseLayer>& layers,
+        float /*worldScale*/, float /*seaLevel*/, float elevationScale,
+        std::vector<float>& outElevation) override {
+        outElevation.assign(coordinates.size(), 0.0f);
+
+        for (const auto& layer : layers) {
+            SimpleNoise::NoiseProvider provider(layer.persistence, layer.lacunarity,
+                                                layer.octaves);
+            provider.SetSeed(layer.seed);
+
+            for (size_t i = 0; i < coordinates.size(); ++i) {
+                float sample = provider.GetNoise(coordinates[i].first * layer.frequency,
+                                                 coordinates[i].second * layer.frequency,
+                                                 0.0f) *
+                               layer.amplitude * layer.weight;
+                if (layer.additive) {
+                    outElevation[i] += sample;
+                } else {
+                    outElevation[i] *= sample;
+                }
+            }
+        }
+
+        for (float& elevation : outElevation) {
+            elevation *= elevationScale;
+        }
+        return true;
+    }
+
+    std::string GetAcceleratorName() const override { return "CpuReferenceAccelerator"; }
+    bool SupportsAsyncCompute() const override { return false; }
+    size_t GetAvailableMemory() const override { return 0; }
+
+    bool SupportsNoiseType(Rendering::Noise::NoiseType type) const override {
+        return type == Rendering::Noise::NoiseType::Simplex;
+    }
+
+    std::vector<Rendering::Noise::NoiseType> GetSupportedNoiseTypes() const override {
+        return {Rendering::Noise::NoiseType::Simplex};
+    }
+};
+
+void RegisterGenerationBenchmarks(Core::Performance::BenchmarkRegistry& registry,
+                                  uint32_t seed) {
+    constexpr size_t kNoiseSamples = 1 << 16;
+    constexpr uint32_t kHeightmapSize = 256;
+    constexpr size_t kClassifyPoints = 1 << 16;
+    constexpr size_t kPoolOperations = 1 << 16;
+    constexpr size_t kEnqueueTasks = 1 << 14;
+
+    // Shared deterministic sample positions for the per-point noise paths
+    auto positions = std::make_shared<std::vector<glm::vec3>>();
+    {
+        DeterministicStream stream(seed);
+        positions->reserve(kNoiseSamples);
+        for (size_t i = 0; i < kNoiseSamples; ++i) {
+            positions->emplace_back(stream.NextFloat(-1000.0f, 1000.0f),
+                                    stream.NextFloat(-1000.0f, 1000.0f),
+                                    stream.NextFloat(-1000.0f, 1000.0f));
+        }
+    }
+
+    registry.Register("NoiseProvider/GetNoise", "noise", kNoiseSamples,
+                      [positions] {
+                          SimpleNoise::NoiseProvider provider(0.5f, 2.0f, 4);
+                          float sum = 0.0f;
+                          for (const auto& p : *positions) {
+                              sum += provider.GetNoise(p.x, p.y, p.z);
+                          }
+                          g_sink = sum;
+                      });
+
+    registry.Register("WorleyNoise/GetNoise", "noise", kNoiseSamples,
+                      [positions, seed] {
+                          Rendering::Noise::WorleyNoise worley(static_cast<int>(seed),
+                                                               0.01f, 1);
+                          float sum = 0.0f;
+                          for (const auto& p : *positions) {
+                              sum += worley.GetNoise(p.x, p.y, p.z);
+                          }
+                          g_sink = sum;
+                      });
+
+    registry.Register("HeightGenerator/GenerateHeightmap", "heightmaps",
+                      static_cast<uint64_t>(kHeightmapSize) * kHeightmapSize,
+                      [seed] {
+                          Generation::HeightGenerator generator(
+                              std::make_shared<CpuNoiseAccelerator>());
+
+                          Rendering::Noise::SimpleNoiseLayer layer;
+                          layer.seed = static_cast<int>(seed);
+
+                          std::vector<float> heights;
+                          generator.GenerateHeightmap(kHeightmapSize, kHeightmapSize,
+                                                      {layer}, 100.0f, 0.0f, heights);
+                          g_sink = heights.empty() ? 0.0f : heights.front();
+                      });
+
+    // Synthetic climate inputs, fixed seed - exercises the full classify
+    // path including the LUT fast path when it is enabled by default
+    auto classifyInputs = std::make_shared<std::tuple<
+        std::vector<float>, std::vector<float>, std::vector<float>,
+        std::vector<float>, std::vector<std::pair<float, float>>>>();
+    {
+        DeterministicStream stream(seed ^ 0x9E3779B9u);
+        auto& [elevations, temperatures, precipitations, slopes, coordinates] =
+            *classifyInputs;
+        for (size_t i = 0; i < kClassifyPoints; ++i) {
+            elevations.push_back(stream.NextFloat(-4000.0f, 8000.0f));
+            temperatures.push_back(stream.NextFloat(-40.0f, 45.0f));
+            precipitations.push_back(stream.NextFloat(0.0f, 3000.0f));
+            slopes.push_back(stream.NextFloat(0.0f, 60.0f));
+            coordinates.emplace_back(stream.NextFloat(-90.0f, 90.0f),
+                                     stream.NextFloat(-180.0f, 180.0f));
+        }
+    }
+
+    registry.Register("BiomeClassifier/ClassifyPoints", "analysis", kClassifyPoints,
+                      [classifyInputs] {
+                          Generation::Analysis::BiomeClassifier classifier;
+                          const auto& [elevations, temperatures, precipitations,
+                                       slopes, coordinates] = *classifyInputs;
+                          auto biomes = classifier.ClassifyPoints(
+                              elevations, temperatures, precipitations, slopes,
+                              coordinates);
+                          g_sink = static_cast<float>(biomes.size());
+                      });
+
+    registry.Register("MemoryPool/AllocateDeallocate", "memory", kPoolOperations,
+                      [] {
+                          PlanetGen::Core::Memory::MemoryPool pool(256, 1024);
+                          std::vector<void*> blocks;
+                          blocks.reserve(64);
+                          for (size_t i = 0; i < kPoolOperations / 64; ++i) {
+                              for (size_t j = 0; j < 64; ++j) {
+                                  blocks.push_back(pool.Allocate());
+                              }
+                              for (void* block : blocks) {
+                                  pool.Deallocate(block);
+                              }
+                              blocks.clear();
+                          }
+                      });
+
+    registry.Register("ThreadPool/Enqueue", "threading", kEnqueueTasks,
+                      [] {
+                          Core::Threading::ThreadPool pool(
+                              std::thread::hardware_concurrency());
+                          std::atomic<size_t> completed{0};
+                          for (size_t i = 0; i < kEnqueueTasks; ++i) {
+                              pool.Submit([&completed] {
+                                  completed.fetch_add(1, std::memory_order_relaxed);
+                              });
+                          }
+                          while (completed.load(std::memory_order_acquire) <
+                                 kEnqueueTasks) {
+                              std::this_thread::yield();
+                          }
+                      });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    PlanetGen::Core::Performance::BenchmarkOptions options;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; ++i) {
+        auto hasValue = [&](const char* flag) {
+            return std::strcmp(argv[i], flag) == 0 && i + 1 < argc;
+        };
+        if (hasValue("--warmup")) {
+            options.warmupIterations = static_cast<uint32_t>(std::atoi(argv[++i]));
+        } else if (hasValue("--iterations")) {
+            options.measuredIterations = static_cast<uint32_t>(std::atoi(argv[++i]));
+        } else if (hasValue("--seed")) {
+            options.seed = static_cast<uint32_t>(std::atoi(argv[++i]));
+        } else if (hasValue("--filter")) {
+            options.filter = argv[++i];
+        } else if (hasValue("--json")) {
+            jsonPath = argv[++i];
+        } else {
+            std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    PlanetGen::Core::Performance::BenchmarkRegistry registry;
+    RegisterGenerationBenchmarks(registry, options.seed);
+
+    auto results = registry.RunAll(options);
+
+    std::printf("%-40s %12s %12s %12s %16s\n", "benchmark", "mean ms", "min ms",
+                "stddev ms", "items/s");
+    for (const auto& result : results) {
+        std::printf("%-40s %12.3f %12.3f %12.3f %16.0f\n", result.name.c_str(),
+                    result.meanMs, result.minMs, result.stdDevMs,
+                    result.itemsPerSecond);
+    }
+
+    if (!jsonPath.empty()) {
+        if (!PlanetGen::Core::Performance::BenchmarkRegistry::ExportJSON(results, options,
+                                                              jsonPath)) {
+            std::fprintf(stderr, "Failed to write %s\n", jsonPath.c_str());
+            return 1;
+        }
+    }
+
+    return 0;
+}
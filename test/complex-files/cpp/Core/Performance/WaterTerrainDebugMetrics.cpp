@@ -1,16 +1,175 @@
-module;
-
-#include <chrono>
-#include <memory>
-#include <string>
-#include <unordered_map>
-#include <vector>
-
-module WaterTerrainDebugMetrics;
-
-namespace PlanetGen::Core::Performance {
-
-// Implementation will be added based on the interface requirements
-// This is a placeholder implementation file
-
-} // namespace PlanetGen::Core::Performance
\ No newline at end of file
+module;
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+module WaterTerrainDebugMetrics;
+
+namespace PlanetGen::Core::Performance {
+
+namespace {
+
+// Cheap per-sample hash so the subset selection is deterministic for a
+// given (sample index, frame) pair but decorrelated between frames -
+// over time every sample gets visited without storing any per-sample state
+uint32_t SampleHash(uint64_t index, uint64_t frame) {
+    uint64_t x = index * 0x9E3779B97F4A7C15ull + frame * 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 31;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 29;
+    return static_cast<uint32_t>(x);
+}
+
+} // namespace
+
+double WaterTerrainDebugMetrics::StreamingEstimate::ConfidenceHalfWidth(double z) const {
+    if (count < 2) return 0.0;
+    return z * std::sqrt(Variance() / static_cast<double>(count));
+}
+
+void WaterTerrainDebugMetrics::SetSamplingConfig(const SamplingConfig& config) {
+    m_samplingConfig = config;
+
+    // Resizing the strata grid invalidates accumulated per-tile state
+    size_t tileCount = static_cast<size_t>(config.latitudeBands) * config.longitudeBands;
+    m_tileEstimates.assign(tileCount, TileEstimate{});
+    m_globalWaterFraction = StreamingEstimate{};
+    m_globalWaterDepth = StreamingEstimate{};
+    m_samplingFrame = 0;
+}
+
+uint32_t WaterTerrainDebugMetrics::GetDenseTileCount() const {
+    uint32_t dense = 0;
+    for (const auto& tile : m_tileEstimates) {
+        if (tile.denseEvaluation) ++dense;
+    }
+    return dense;
+}
+
+WaterTerrainDebugMetrics::WaterTerrainAnalysis WaterTerrainDebugMetrics::AnalyzeSampled(
+    const float* elevations,
+    const std::pair<float, float>* coordinates,
+    size_t count,
+    float seaLevel) {
+    auto analysisStart = std::chrono::steady_clock::now();
+
+    WaterTerrainAnalysis analysis;
+    analysis.timestamp = analysisStart;
+    analysis.totalVertices = static_cast<uint32_t>(count);
+
+    if (count == 0 || m_tileEstimates.empty()) {
+        return analysis;
+    }
+
+    const auto& config = m_samplingConfig;
+    ++m_samplingFrame;
+
+    // Selection threshold on the 32-bit hash; dense tiles bypass it
+    const uint32_t acceptThreshold = static_cast<uint32_t>(
+        std::clamp(config.sampleFraction, 0.0f, 1.0f) * 4294967295.0f);
+
+    const float latBandScale = config.latitudeBands / 180.0f;
+    const float lonBandScale = config.longitudeBands / 360.0f;
+
+    float minDepth = 0.0f;
+    float maxDepth = 0.0f;
+    uint64_t evaluated = 0;
+    uint64_t sampledWater = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        // Stratum for this sample: latitude row x longitude column
+        uint32_t latBand = std::min(config.latitudeBands - 1,
+            static_cast<uint32_t>(std::max(0.0f, (coordinates[i].first + 90.0f) * latBandScale)));
+        uint32_t lonBand = std::min(config.longitudeBands - 1,
+            static_cast<uint32_t>(std::max(0.0f, (coordinates[i].second + 180.0f) * lonBandScale)));
+        TileEstimate& tile = m_tileEstimates[latBand * config.longitudeBands + lonBand];
+
+        if (!tile.denseEvaluation && SampleHash(i, m_samplingFrame) > acceptThreshold) {
+            continue;
+        }
+
+        ++evaluated;
+        bool isWater = elevations[i] <= seaLevel;
+        tile.waterFraction.Add(isWater ? 1.0 : 0.0);
+        m_globalWaterFraction.Add(isWater ? 1.0 : 0.0);
+
+        if (isWater) {
+            float depth = seaLevel - elevations[i];
+            tile.waterDepth.Add(depth);
+            m_globalWaterDepth.Add(depth);
+            if (sampledWater == 0) {
+                minDepth = maxDepth = depth;
+            } else {
+                minDepth = std::min(minDepth, depth);
+                maxDepth = std::max(maxDepth, depth);
+            }
+            ++sampledWater;
+        }
+
+        // Escalation: only when the whole confidence interval is past the
+        // threshold, so a few unlucky samples don't flip a tile to dense.
+        // De-escalate symmetrically once the interval is clear of it.
+        if (tile.waterFraction.count >= config.minSamplesForAlert) {
+            double coverageHalf = tile.waterFraction.ConfidenceHalfWidth(config.confidenceZ);
+            double coveragePercent = tile.waterFraction.mean * 100.0;
+            double depthHalf = tile.waterDepth.ConfidenceHalfWidth(config.confidenceZ);
+
+            bool coverageAlert =
+                coveragePercent - coverageHalf * 100.0 > config.waterCoverageAlertPercent;
+            bool depthAlert = tile.waterDepth.count >= config.minSamplesForAlert &&
+                tile.waterDepth.mean - depthHalf > config.waterDepthAlertMeters;
+            bool allClear =
+                coveragePercent + coverageHalf * 100.0 < config.waterCoverageAlertPercent &&
+                (tile.waterDepth.count < config.minSamplesForAlert ||
+                 tile.waterDepth.mean + depthHalf < config.waterDepthAlertMeters);
+
+            if (coverageAlert || depthAlert) {
+                tile.denseEvaluation = true;
+            } else if (tile.denseEvaluation && allClear) {
+                tile.denseEvaluation = false;
+            }
+        }
+    }
+
+    // Extrapolate the full-population analysis from the streaming estimates
+    analysis.waterCoverage = static_cast<float>(m_globalWaterFraction.mean * 100.0);
+    analysis.terrainCoverage = 100.0f - analysis.waterCoverage;
+    analysis.waterVertices =
+        static_cast<uint32_t>(m_globalWaterFraction.mean * static_cast<double>(count));
+    analysis.terrainVertices = analysis.totalVertices - analysis.waterVertices;
+    analysis.avgWaterDepth = static_cast<float>(m_globalWaterDepth.mean);
+    analysis.minWaterDepth = minDepth;
+    analysis.maxWaterDepth = maxDepth;
+    analysis.analysisCount = ++m_totalAnalysisCount;
+
+    auto analysisEnd = std::chrono::steady_clock::now();
+    analysis.lastAnalysisTime = std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(
+        analysisEnd - analysisStart).count();
+    m_totalAnalysisTime += analysis.lastAnalysisTime;
+    analysis.totalAnalysisTime = m_totalAnalysisTime;
+
+    m_latestAnalysis = analysis;
+    m_analysisHistory.push_back(analysis);
+    if (m_analysisHistory.size() > m_maxHistorySize) {
+        m_analysisHistory.erase(m_analysisHistory.begin());
+    }
+
+    if (m_analysisCallback) {
+        m_analysisCallback(analysis);
+    }
+
+    // Unused in sampling mode but kept for interface symmetry with the
+    // dense path: evaluated counts what this frame actually paid for
+    (void)evaluated;
+
+    return analysis;
+}
+
+} // namespace PlanetGen::Core::Performance
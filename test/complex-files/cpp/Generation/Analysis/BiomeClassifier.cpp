@@ -5,7 +5,15 @@ module;
 #include <unordered_map>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <functional>
+#include <future>
+
+#include "Core/Math/MathUtils.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -15,9 +23,52 @@ module BiomeClassifier;
 
 import GLMModule;
 import TerrainAnalysisTypes;
+import ThreadPool;
 
 namespace PlanetGen::Generation::Analysis {
 
+namespace {
+
+// Classification LUT quantization. Latitude and slope are banded exactly on
+// the thresholds the default algorithm tests (25/70 degrees absolute
+// latitude, 0.3 slope), so those two axes lose no information for it; the
+// three continuous axes are quantized to fixed-width bins. Samples outside
+// the continuous ranges take the exact per-point path instead.
+constexpr float kLUTElevMin = -8000.0f;
+constexpr float kLUTElevMax = 8000.0f;
+constexpr int kLUTElevBins = 64;
+constexpr float kLUTTempMin = -50.0f;
+constexpr float kLUTTempMax = 50.0f;
+constexpr int kLUTTempBins = 64;
+constexpr float kLUTPrecipMin = 0.0f;
+constexpr float kLUTPrecipMax = 4000.0f;
+constexpr int kLUTPrecipBins = 64;
+constexpr int kLUTLatBands = 3;   // |lat| < 25, 25..70, > 70
+constexpr int kLUTSlopeBands = 2; // slope <= 0.3, > 0.3
+constexpr float kLUTSlopeThreshold = 0.3f;
+
+// Representative inputs used when precompiling each band
+constexpr float kLUTLatBandSamples[kLUTLatBands] = {12.5f, 47.5f, 80.0f};
+constexpr float kLUTSlopeBandSamples[kLUTSlopeBands] = {0.15f, 0.45f};
+
+inline int QuantizeToBin(float value, float minValue, float maxValue, int bins) {
+    float normalized = (value - minValue) / (maxValue - minValue);
+    int bin = static_cast<int>(normalized * bins);
+    return std::max(0, std::min(bins - 1, bin));
+}
+
+inline int LatitudeBand(float latitude) {
+    float absLat = std::abs(latitude);
+    return (absLat >= 25.0f ? 1 : 0) + (absLat >= 70.0f ? 1 : 0);
+}
+
+inline size_t LUTIndex(int latBand, int slopeBand, int elevBin, int tempBin, int precipBin) {
+    return ((((static_cast<size_t>(latBand) * kLUTSlopeBands + slopeBand) * kLUTElevBins + elevBin) *
+             kLUTTempBins + tempBin) * kLUTPrecipBins) + precipBin;
+}
+
+} // namespace
+
 BiomeClassifier::BiomeClassifier() {
     m_classificationAlgorithm = [this](float elevation, float temperature, float precipitation, 
                                      float slope, float latitude, float longitude) {
@@ -135,12 +186,17 @@ std::vector<BiomeType> BiomeClassifier::ClassifyPoints(
     const std::vector<std::pair<float, float>>& coordinates) const {
     
     std::vector<BiomeType> results(elevations.size());
-    
+
+    if (m_useLUTClassification && !m_classificationLUT.empty()) {
+        ClassifyPointsLUT(elevations, temperatures, precipitations, slopes, coordinates, results);
+        return results;
+    }
+
     if (!m_useParallelProcessing || elevations.size() < m_chunkSize) {
         // Sequential processing for small datasets
         for (size_t i = 0; i < elevations.size(); ++i) {
             auto [lat, lon] = coordinates[i];
-            results[i] = ClassifyPoint(elevations[i], temperatures[i], precipitations[i], 
+            results[i] = ClassifyPoint(elevations[i], temperatures[i], precipitations[i],
                                      slopes[i], lat, lon);
         }
     } else {
@@ -148,14 +204,153 @@ std::vector<BiomeType> BiomeClassifier::ClassifyPoints(
         // The TerrainAnalysisProcessor will handle parallel processing at a higher level
         for (size_t i = 0; i < elevations.size(); ++i) {
             auto [lat, lon] = coordinates[i];
-            results[i] = ClassifyPoint(elevations[i], temperatures[i], precipitations[i], 
+            results[i] = ClassifyPoint(elevations[i], temperatures[i], precipitations[i],
                                      slopes[i], lat, lon);
         }
     }
-    
+
     return results;
 }
 
+void BiomeClassifier::BuildClassificationLUT() {
+    constexpr size_t totalEntries = static_cast<size_t>(kLUTLatBands) * kLUTSlopeBands *
+                                    kLUTElevBins * kLUTTempBins * kLUTPrecipBins;
+    m_classificationLUT.resize(totalEntries);
+
+    const float elevStep = (kLUTElevMax - kLUTElevMin) / kLUTElevBins;
+    const float tempStep = (kLUTTempMax - kLUTTempMin) / kLUTTempBins;
+    const float precipStep = (kLUTPrecipMax - kLUTPrecipMin) / kLUTPrecipBins;
+
+    size_t idx = 0;
+    for (int latBand = 0; latBand < kLUTLatBands; ++latBand) {
+        for (int slopeBand = 0; slopeBand < kLUTSlopeBands; ++slopeBand) {
+            for (int e = 0; e < kLUTElevBins; ++e) {
+                float elevation = kLUTElevMin + (e + 0.5f) * elevStep;
+                for (int t = 0; t < kLUTTempBins; ++t) {
+                    float temperature = kLUTTempMin + (t + 0.5f) * tempStep;
+                    for (int p = 0; p < kLUTPrecipBins; ++p) {
+                        float precipitation = kLUTPrecipMin + (p + 0.5f) * precipStep;
+                        // Longitude is not consulted by the default algorithm;
+                        // custom algorithms that depend on it should keep the
+                        // LUT path disabled.
+                        m_classificationLUT[idx++] = static_cast<int32_t>(
+                            m_classificationAlgorithm(elevation, temperature, precipitation,
+                                                      kLUTSlopeBandSamples[slopeBand],
+                                                      kLUTLatBandSamples[latBand], 0.0f));
+                    }
+                }
+            }
+        }
+    }
+}
+
+void BiomeClassifier::ClassifyPointsLUT(
+    const std::vector<float>& elevations,
+    const std::vector<float>& temperatures,
+    const std::vector<float>& precipitations,
+    const std::vector<float>& slopes,
+    const std::vector<std::pair<float, float>>& coordinates,
+    std::vector<BiomeType>& results) const {
+
+    const size_t count = elevations.size();
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 elevMin = _mm256_set1_ps(kLUTElevMin);
+    const __m256 elevMax = _mm256_set1_ps(kLUTElevMax);
+    const __m256 tempMin = _mm256_set1_ps(kLUTTempMin);
+    const __m256 tempMax = _mm256_set1_ps(kLUTTempMax);
+    const __m256 precipMin = _mm256_set1_ps(kLUTPrecipMin);
+    const __m256 precipMax = _mm256_set1_ps(kLUTPrecipMax);
+    const __m256 invElevStep = _mm256_set1_ps(kLUTElevBins / (kLUTElevMax - kLUTElevMin));
+    const __m256 invTempStep = _mm256_set1_ps(kLUTTempBins / (kLUTTempMax - kLUTTempMin));
+    const __m256 invPrecipStep = _mm256_set1_ps(kLUTPrecipBins / (kLUTPrecipMax - kLUTPrecipMin));
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256i zeroI = _mm256_setzero_si256();
+    // Latitudes sit at even float offsets inside the (lat, lon) pair array
+    const __m256i latStride = _mm256_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14);
+
+    alignas(32) int32_t lutValues[8];
+    alignas(32) int32_t inRange[8];
+
+    for (; i + 8 <= count; i += 8) {
+        __m256 e = _mm256_loadu_ps(elevations.data() + i);
+        __m256 t = _mm256_loadu_ps(temperatures.data() + i);
+        __m256 p = _mm256_loadu_ps(precipitations.data() + i);
+        __m256 s = _mm256_loadu_ps(slopes.data() + i);
+        __m256 lat = _mm256_i32gather_ps(&coordinates[i].first, latStride, 4);
+
+        __m256 ok = _mm256_and_ps(
+            _mm256_and_ps(_mm256_cmp_ps(e, elevMin, _CMP_GE_OQ),
+                          _mm256_cmp_ps(e, elevMax, _CMP_LE_OQ)),
+            _mm256_and_ps(
+                _mm256_and_ps(_mm256_cmp_ps(t, tempMin, _CMP_GE_OQ),
+                              _mm256_cmp_ps(t, tempMax, _CMP_LE_OQ)),
+                _mm256_and_ps(_mm256_cmp_ps(p, precipMin, _CMP_GE_OQ),
+                              _mm256_cmp_ps(p, precipMax, _CMP_LE_OQ))));
+
+        // Bins are clamped so even out-of-range lanes gather a valid address
+        __m256i eBin = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_sub_ps(e, elevMin), invElevStep));
+        eBin = _mm256_min_epi32(_mm256_max_epi32(eBin, zeroI), _mm256_set1_epi32(kLUTElevBins - 1));
+        __m256i tBin = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_sub_ps(t, tempMin), invTempStep));
+        tBin = _mm256_min_epi32(_mm256_max_epi32(tBin, zeroI), _mm256_set1_epi32(kLUTTempBins - 1));
+        __m256i pBin = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_sub_ps(p, precipMin), invPrecipStep));
+        pBin = _mm256_min_epi32(_mm256_max_epi32(pBin, zeroI), _mm256_set1_epi32(kLUTPrecipBins - 1));
+
+        // Comparison masks are -1, so subtracting them counts crossed thresholds
+        __m256 absLat = _mm256_andnot_ps(signMask, lat);
+        __m256i latBand = _mm256_sub_epi32(zeroI,
+            _mm256_add_epi32(
+                _mm256_castps_si256(_mm256_cmp_ps(absLat, _mm256_set1_ps(25.0f), _CMP_GE_OQ)),
+                _mm256_castps_si256(_mm256_cmp_ps(absLat, _mm256_set1_ps(70.0f), _CMP_GE_OQ))));
+        __m256i slopeBand = _mm256_sub_epi32(zeroI,
+            _mm256_castps_si256(_mm256_cmp_ps(s, _mm256_set1_ps(kLUTSlopeThreshold), _CMP_GT_OQ)));
+
+        __m256i idx = _mm256_add_epi32(
+            _mm256_mullo_epi32(latBand, _mm256_set1_epi32(kLUTSlopeBands)), slopeBand);
+        idx = _mm256_add_epi32(_mm256_mullo_epi32(idx, _mm256_set1_epi32(kLUTElevBins)), eBin);
+        idx = _mm256_add_epi32(_mm256_mullo_epi32(idx, _mm256_set1_epi32(kLUTTempBins)), tBin);
+        idx = _mm256_add_epi32(_mm256_mullo_epi32(idx, _mm256_set1_epi32(kLUTPrecipBins)), pBin);
+
+        __m256i values = _mm256_i32gather_epi32(m_classificationLUT.data(), idx, 4);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lutValues), values);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(inRange), _mm256_castps_si256(ok));
+
+        for (int lane = 0; lane < 8; ++lane) {
+            if (inRange[lane]) {
+                results[i + lane] = static_cast<BiomeType>(lutValues[lane]);
+            } else {
+                auto [pointLat, pointLon] = coordinates[i + lane];
+                results[i + lane] = ClassifyPoint(elevations[i + lane], temperatures[i + lane],
+                                                  precipitations[i + lane], slopes[i + lane],
+                                                  pointLat, pointLon);
+            }
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        auto [lat, lon] = coordinates[i];
+        float elevation = elevations[i];
+        float temperature = temperatures[i];
+        float precipitation = precipitations[i];
+
+        if (elevation < kLUTElevMin || elevation > kLUTElevMax ||
+            temperature < kLUTTempMin || temperature > kLUTTempMax ||
+            precipitation < kLUTPrecipMin || precipitation > kLUTPrecipMax) {
+            results[i] = ClassifyPoint(elevation, temperature, precipitation, slopes[i], lat, lon);
+            continue;
+        }
+
+        size_t index = LUTIndex(LatitudeBand(lat),
+                                slopes[i] > kLUTSlopeThreshold ? 1 : 0,
+                                QuantizeToBin(elevation, kLUTElevMin, kLUTElevMax, kLUTElevBins),
+                                QuantizeToBin(temperature, kLUTTempMin, kLUTTempMax, kLUTTempBins),
+                                QuantizeToBin(precipitation, kLUTPrecipMin, kLUTPrecipMax, kLUTPrecipBins));
+        results[i] = static_cast<BiomeType>(m_classificationLUT[index]);
+    }
+}
+
 TerrainAnalysisPoint BiomeClassifier::AnalyzePoint(float elevation, float temperature, float precipitation,
                                                   float slope, float latitude, float longitude, 
                                                   const TerrainAnalysisParams& params) const {
@@ -169,11 +364,13 @@ TerrainAnalysisPoint BiomeClassifier::AnalyzePoint(float elevation, float temper
     point.temperature = temperature;
     point.precipitation = precipitation;
     
-    // Calculate humidity (from existing algorithm)
+    // Calculate humidity (from existing algorithm); the argument stays in
+    // [0, PI], inside fastSin's valid range
     float baseHumidity = std::min(1.0f, precipitation / 1500.0f);
     float tempEffect = 1.0f;
     if (temperature > 0.0f && temperature < 40.0f) {
-        tempEffect = 0.5f + 0.5f * std::sin(temperature / 40.0f * M_PI);
+        tempEffect = 0.5f + 0.5f * Core::Math::MathUtils::fastSin(
+                                       temperature / 40.0f * Core::Math::MathUtils::PI);
     } else if (temperature <= 0.0f) {
         tempEffect = 0.3f;
     } else {
@@ -232,43 +429,111 @@ std::vector<TerrainAnalysisPoint> BiomeClassifier::AnalyzePoints(
     const std::vector<std::pair<float, float>>& coordinates,
     const TerrainAnalysisParams& params) const {
     
-    std::vector<TerrainAnalysisPoint> results;
-    results.reserve(elevations.size());
-    
-    // Calculate temperatures and precipitations based on coordinates and elevation
-    std::vector<float> temperatures(elevations.size());
-    std::vector<float> precipitations(elevations.size());
-    std::vector<float> humidities(elevations.size());
-    
-    for (size_t i = 0; i < elevations.size(); ++i) {
-        auto [lat, lon] = coordinates[i];
-        CalculateClimate(lat, lon, elevations[i], params, 
-                        temperatures[i], precipitations[i], humidities[i]);
-    }
-    
-    if (!m_useParallelProcessing || elevations.size() < m_chunkSize) {
-        // Sequential processing
-        for (size_t i = 0; i < elevations.size(); ++i) {
+    const size_t count = elevations.size();
+    std::vector<TerrainAnalysisPoint> results(count);
+
+    // Climate is fused into the analysis traversal - no separate
+    // temperature/precipitation staging arrays
+    auto analyzeRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
             auto [lat, lon] = coordinates[i];
-            float slope = 0.0f; // Will be calculated by CalculateTopography if needed
-            results.push_back(AnalyzePoint(elevations[i], temperatures[i], precipitations[i],
-                                         slope, lat, lon, params));
+            float temperature, precipitation, humidity;
+            CalculateClimate(lat, lon, elevations[i], params, temperature, precipitation, humidity);
+
+            float slope = 0.0f; // No grid topology in this overload; see AnalyzePointsGrid
+            results[i] = AnalyzePoint(elevations[i], temperature, precipitation,
+                                      slope, lat, lon, params);
+        }
+    };
+
+    if (m_threadPool && m_useParallelProcessing && count >= m_chunkSize * 2) {
+        std::vector<std::future<void>> pending;
+        pending.reserve((count + m_chunkSize - 1) / m_chunkSize);
+        for (size_t begin = 0; begin < count; begin += m_chunkSize) {
+            size_t end = std::min(count, begin + m_chunkSize);
+            pending.push_back(m_threadPool->Enqueue([&analyzeRange, begin, end] {
+                analyzeRange(begin, end);
+            }));
+        }
+        for (auto& future : pending) {
+            future.get();
         }
     } else {
-        // Parallel processing
-        results.resize(elevations.size());
-        auto processedResults = ProcessChunk(elevations, coordinates, params, 0, elevations.size());
-        results = std::move(processedResults);
+        analyzeRange(0, count);
     }
-    
+
+    return results;
+}
+
+std::vector<TerrainAnalysisPoint> BiomeClassifier::AnalyzePointsGrid(
+    const std::vector<float>& elevations,
+    const std::vector<std::pair<float, float>>& coordinates,
+    uint32_t width, uint32_t height,
+    const TerrainAnalysisParams& params) const {
+
+    std::vector<TerrainAnalysisPoint> results(elevations.size());
+
+    // One blocked stencil pass per row band: each point's slope comes from
+    // the Sobel gradients of its row neighbors, so adjacent points in a band
+    // share the rows already in cache, and climate plus full analysis happen
+    // in the same traversal instead of separate scans.
+    auto analyzeRows = [&](uint32_t rowBegin, uint32_t rowEnd) {
+        for (uint32_t y = rowBegin; y < rowEnd; ++y) {
+            const bool interiorRow = (y > 0 && y < height - 1);
+            const float* rowAbove = elevations.data() + static_cast<size_t>(y - (y > 0 ? 1 : 0)) * width;
+            const float* row = elevations.data() + static_cast<size_t>(y) * width;
+            const float* rowBelow = elevations.data() + static_cast<size_t>(y + (y < height - 1 ? 1 : 0)) * width;
+
+            for (uint32_t x = 0; x < width; ++x) {
+                size_t idx = static_cast<size_t>(y) * width + x;
+
+                // Border points keep slope 0, matching CalculateTopography
+                float slope = 0.0f;
+                if (interiorRow && x > 0 && x < width - 1) {
+                    float dzdx = (row[x + 1] - row[x - 1]) / 2.0f;
+                    float dzdy = (rowBelow[x] - rowAbove[x]) / 2.0f;
+                    slope = std::sqrt(dzdx * dzdx + dzdy * dzdy);
+                }
+
+                auto [lat, lon] = coordinates[idx];
+                float temperature, precipitation, humidity;
+                CalculateClimate(lat, lon, row[x], params, temperature, precipitation, humidity);
+
+                results[idx] = AnalyzePoint(row[x], temperature, precipitation,
+                                            slope, lat, lon, params);
+            }
+        }
+    };
+
+    const uint32_t rowsPerChunk = std::max(1u, m_chunkSize / std::max(1u, width));
+    if (m_threadPool && m_useParallelProcessing && height >= rowsPerChunk * 2) {
+        std::vector<std::future<void>> pending;
+        pending.reserve((height + rowsPerChunk - 1) / rowsPerChunk);
+        for (uint32_t rowBegin = 0; rowBegin < height; rowBegin += rowsPerChunk) {
+            uint32_t rowEnd = std::min(height, rowBegin + rowsPerChunk);
+            pending.push_back(m_threadPool->Enqueue([&analyzeRows, rowBegin, rowEnd] {
+                analyzeRows(rowBegin, rowEnd);
+            }));
+        }
+        for (auto& future : pending) {
+            future.get();
+        }
+    } else {
+        analyzeRows(0, height);
+    }
+
     return results;
 }
 
 void BiomeClassifier::CalculateClimate(float latitude, float longitude, float elevation,
                                      const TerrainAnalysisParams& params,
                                      float& temperature, float& precipitation, float& humidity) const {
-    // Temperature calculation based on latitude and elevation
-    float latitudeFactor = std::cos(latitude * M_PI / 180.0f);
+    using namespace Core::Math;
+
+    // Temperature calculation based on latitude and elevation. The climate
+    // curves tolerate the fast approximations' ~1e-3 error, and libm trig
+    // dominated flat profiles of this per-point pass.
+    float latitudeFactor = MathUtils::fastCos(latitude * MathUtils::DEG_TO_RAD);
     float baseTemp = params.equatorTemperature * latitudeFactor + 
                      params.poleTemperature * (1.0f - latitudeFactor);
     
@@ -281,15 +546,17 @@ void BiomeClassifier::CalculateClimate(float latitude, float longitude, float el
     float latEffect = std::max(0.0f, 1.0f - std::abs(latitude) / 90.0f); // More rain near equator
     float elevationPrecip = std::max(0.0f, elevation / 2000.0f); // Orographic precipitation
     
-    precipitation = basePrecip * (0.5f + latEffect + elevationPrecip * 0.5f) * 
-                   (1.0f + params.precipitationVariability * (std::sin(longitude * M_PI / 180.0f) - 0.5f));
+    precipitation = basePrecip * (0.5f + latEffect + elevationPrecip * 0.5f) *
+                   (1.0f + params.precipitationVariability *
+                               (MathUtils::fastSin(MathUtils::wrapPi(longitude * MathUtils::DEG_TO_RAD)) - 0.5f));
     precipitation = std::max(50.0f, std::min(4000.0f, precipitation));
     
     // Humidity (reusing existing algorithm)
     float baseHumidity = std::min(1.0f, precipitation / 1500.0f);
     float tempEffect = 1.0f;
     if (temperature > 0.0f && temperature < 40.0f) {
-        tempEffect = 0.5f + 0.5f * std::sin(temperature / 40.0f * M_PI);
+        // temperature/40*PI stays in [0, PI], inside fastSin's valid range
+        tempEffect = 0.5f + 0.5f * MathUtils::fastSin(temperature / 40.0f * MathUtils::PI);
     } else if (temperature <= 0.0f) {
         tempEffect = 0.3f;
     } else {
@@ -361,6 +628,9 @@ TerrainColor BiomeClassifier::GetBiomeColor(BiomeType primaryBiome, BiomeType se
 
 void BiomeClassifier::SetClassificationAlgorithm(std::function<BiomeType(float, float, float, float, float, float)> algorithm) {
     m_classificationAlgorithm = algorithm;
+    // The precompiled table reflects the previous algorithm; drop it until
+    // the caller rebuilds
+    m_classificationLUT.clear();
 }
 
 std::unordered_map<BiomeType, uint32_t> BiomeClassifier::GetBiomeStatistics(const std::vector<BiomeType>& biomes) const {
@@ -568,27 +838,6 @@ float BiomeClassifier::CalculateVegetation(BiomeType biome, float temperature, f
     }
 }
 
-std::vector<TerrainAnalysisPoint> BiomeClassifier::ProcessChunk(
-    const std::vector<float>& elevations,
-    const std::vector<std::pair<float, float>>& coordinates,
-    const TerrainAnalysisParams& params,
-    uint32_t startIndex, uint32_t endIndex) const {
-    
-    std::vector<TerrainAnalysisPoint> results;
-    results.reserve(endIndex - startIndex);
-    
-    for (uint32_t i = startIndex; i < endIndex; ++i) {
-        auto [lat, lon] = coordinates[i];
-        float temperature, precipitation, humidity;
-        CalculateClimate(lat, lon, elevations[i], params, temperature, precipitation, humidity);
-        
-        float slope = 0.0f; // Simplified for chunk processing
-        results.push_back(AnalyzePoint(elevations[i], temperature, precipitation, slope, lat, lon, params));
-    }
-    
-    return results;
-}
-
 // Factory implementations
 std::unique_ptr<BiomeClassifier> BiomeClassifierFactory::CreateEarthLikeClassifier() {
     auto classifier = std::make_unique<BiomeClassifier>();
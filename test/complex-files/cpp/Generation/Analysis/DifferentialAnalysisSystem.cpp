@@ -121,9 +121,16 @@ void DifferentialAnalysisSystem::ClearPipelineStages() {
 }
 
 PipelineAnalysisResult DifferentialAnalysisSystem::AnalyzePipelineTransition(
-    uint32_t fromStageId, 
+    uint32_t fromStageId,
     uint32_t toStageId) {
-    
+    return AnalyzeTransitionTask(fromStageId, toStageId, true);
+}
+
+PipelineAnalysisResult DifferentialAnalysisSystem::AnalyzeTransitionTask(
+    uint32_t fromStageId,
+    uint32_t toStageId,
+    bool allowParallelMetrics) {
+
     const auto startTime = std::chrono::steady_clock::now();
     PipelineAnalysisResult result;
     result.fromStageId = fromStageId;
@@ -178,7 +185,7 @@ PipelineAnalysisResult DifferentialAnalysisSystem::AnalyzePipelineTransition(
     }
     
     // Execute metrics in parallel if configured
-    if (m_pImpl->configuration.enableParallelAnalysis && enabledMetrics.size() > 2) {
+    if (allowParallelMetrics && m_pImpl->configuration.enableParallelAnalysis && enabledMetrics.size() > 2) {
         result.metricResults = RunMetricsParallel(enabledMetrics, *beforeSnapshot, *afterSnapshot);
     } else {
         result.metricResults = RunMetricsSequential(enabledMetrics, *beforeSnapshot, *afterSnapshot);
@@ -244,19 +251,62 @@ PipelineAnalysisResult DifferentialAnalysisSystem::AnalyzePipelineTransition(
 }
 
 std::vector<PipelineAnalysisResult> DifferentialAnalysisSystem::AnalyzeFullPipeline() {
-    std::vector<PipelineAnalysisResult> results;
-    
-    std::shared_lock<std::shared_mutex> lock(m_pImpl->stagesMutex);
-    
-    if (m_pImpl->stageOrder.size() < 2) {
-        return results;
+    // Snapshot the consecutive transitions up front so the stages mutex is
+    // not held across the analyses themselves
+    std::vector<std::pair<uint32_t, uint32_t>> transitions;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_pImpl->stagesMutex);
+        if (m_pImpl->stageOrder.size() < 2) {
+            return {};
+        }
+        transitions.reserve(m_pImpl->stageOrder.size() - 1);
+        for (size_t i = 0; i < m_pImpl->stageOrder.size() - 1; ++i) {
+            transitions.emplace_back(m_pImpl->stageOrder[i], m_pImpl->stageOrder[i + 1]);
+        }
     }
-    
-    // Analyze each consecutive stage transition
-    for (size_t i = 0; i < m_pImpl->stageOrder.size() - 1; ++i) {
-        results.push_back(AnalyzePipelineTransition(m_pImpl->stageOrder[i], m_pImpl->stageOrder[i + 1]));
+
+    std::vector<PipelineAnalysisResult> results(transitions.size());
+
+    if (m_pImpl->configuration.enableParallelAnalysis && transitions.size() > 1) {
+        // Transitions are independent: fan them out across the JobSystem,
+        // one result slot per job. Metric execution inside each job stays on
+        // the fused sequential path so transition jobs never block workers
+        // waiting on nested metric batches.
+        std::vector<Job*> jobs;
+        jobs.reserve(transitions.size());
+
+        std::vector<std::string> jobNames;
+        jobNames.reserve(transitions.size());
+
+        for (const auto& [fromId, toId] : transitions) {
+            jobNames.push_back("Transition_" + std::to_string(fromId) + "_" + std::to_string(toId));
+            auto* job = JobSystem::Instance().CreateJob<PipelineAnalysisResult>(
+                [this, fromId = fromId, toId = toId]() -> PipelineAnalysisResult {
+                    return AnalyzeTransitionTask(fromId, toId, false);
+                },
+                jobNames.back().c_str()
+            );
+            jobs.push_back(job);
+        }
+
+        auto handles = JobSystem::Instance().ScheduleBatch(jobs);
+        for (auto& handle : handles) {
+            handle.Wait();
+        }
+
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            if (auto* typedJob = static_cast<TypedJob<PipelineAnalysisResult>*>(jobs[i])) {
+                results[i] = typedJob->GetResult();
+            }
+            delete jobs[i];
+        }
+    } else {
+        // Analyze each consecutive stage transition
+        for (size_t i = 0; i < transitions.size(); ++i) {
+            results[i] = AnalyzeTransitionTask(transitions[i].first, transitions[i].second, true);
+        }
     }
-    
+
     return results;
 }
 
@@ -397,27 +447,22 @@ std::vector<TerrainMetricResult> DifferentialAnalysisSystem::RunMetricsSequentia
     const TerrainDataSnapshot& beforeSnapshot,
     const TerrainDataSnapshot& afterSnapshot) const {
     
-    std::vector<TerrainMetricResult> results;
-    results.reserve(metricNames.size());
-    
     std::shared_lock<std::shared_mutex> lock(m_pImpl->metricsMutex);
-    
+
+    // Collect the enabled metrics and let the fused executor share one
+    // traversal between every metric that opts into per-sample accumulation;
+    // the rest still run their own AnalyzeTransition pass (with the same
+    // per-metric error capture as before).
+    std::vector<ITerrainMetric*> enabledMetrics;
+    enabledMetrics.reserve(metricNames.size());
     for (const auto& name : metricNames) {
         auto it = m_pImpl->metrics.find(name);
         if (it != m_pImpl->metrics.end() && it->second.enabled) {
-            try {
-                results.push_back(it->second.metric->AnalyzeTransition(beforeSnapshot, afterSnapshot));
-            } catch (const std::exception& e) {
-                TerrainMetricResult errorResult;
-                errorResult.metricName = name;
-                errorResult.errorMessage = e.what();
-                errorResult.isSuccessful = false;
-                results.push_back(errorResult);
-            }
+            enabledMetrics.push_back(it->second.metric.get());
         }
     }
-    
-    return results;
+
+    return FusedMetricExecutor::Run(enabledMetrics, beforeSnapshot, afterSnapshot);
 }
 
 std::vector<TerrainMetricResult> DifferentialAnalysisSystem::RunMetricsParallel(
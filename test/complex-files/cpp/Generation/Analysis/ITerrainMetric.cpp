@@ -3,6 +3,9 @@ module;
 #include <numeric>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <memory>
+#include <utility>
 #include <vector>
 
 module ITerrainMetric;
@@ -11,6 +14,128 @@ import AnalysisTypes;
 
 namespace PlanetGen::Generation::Analysis {
 
+std::vector<TerrainMetricResult> FusedMetricExecutor::Run(
+    const std::vector<ITerrainMetric*>& metrics,
+    const TerrainDataSnapshot& beforeSnapshot,
+    const TerrainDataSnapshot& afterSnapshot) {
+
+    std::vector<TerrainMetricResult> results(metrics.size());
+
+    // Split metrics into fused accumulators and classic full-pass metrics
+    struct FusedEntry {
+        size_t resultIndex;
+        std::unique_ptr<IFusedMetricAccumulator> accumulator;
+    };
+    std::vector<FusedEntry> fused;
+    uint32_t combinedMask = 0;
+
+    for (size_t i = 0; i < metrics.size(); ++i) {
+        try {
+            auto accumulator = metrics[i]->CreateFusedAccumulator(beforeSnapshot, afterSnapshot);
+            if (accumulator) {
+                combinedMask |= metrics[i]->GetRequiredSampleQuantities();
+                fused.push_back({i, std::move(accumulator)});
+            } else {
+                results[i] = metrics[i]->AnalyzeTransition(beforeSnapshot, afterSnapshot);
+            }
+        } catch (const std::exception& e) {
+            results[i].metricName = metrics[i]->GetMetricName();
+            results[i].errorMessage = e.what();
+            results[i].isSuccessful = false;
+        }
+    }
+
+    if (fused.empty()) {
+        return results;
+    }
+
+    const auto& beforeData = beforeSnapshot.GetElevationData();
+    const auto& afterData = afterSnapshot.GetElevationData();
+    const size_t count = std::min(beforeData.size(), afterData.size());
+
+    // Square grids are the processor convention; fall back to a 1D layout
+    // (x-gradients only, linear neighborhoods) when the resolution disagrees
+    uint32_t width = beforeSnapshot.GetMetadata().dataResolution;
+    uint32_t height;
+    if (width != 0 && static_cast<size_t>(width) * width == count) {
+        height = width;
+    } else {
+        width = static_cast<uint32_t>(count);
+        height = count > 0 ? 1 : 0;
+    }
+
+    const bool needGradient = (combinedMask & static_cast<uint32_t>(SampleQuantity::Gradient)) != 0;
+    const bool needNeighborhood = (combinedMask & static_cast<uint32_t>(SampleQuantity::Neighborhood)) != 0;
+
+    // One blocked traversal: shared intermediates are computed once per
+    // sample and fanned out to every accumulator while the neighbor rows are
+    // still cache-resident.
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            size_t idx = static_cast<size_t>(y) * width + x;
+
+            FusedSample sample;
+            sample.index = idx;
+            sample.before = beforeData[idx];
+            sample.after = afterData[idx];
+
+            if (needGradient && x > 0 && x < width - 1) {
+                sample.beforeGradX = (beforeData[idx + 1] - beforeData[idx - 1]) * 0.5f;
+                sample.afterGradX = (afterData[idx + 1] - afterData[idx - 1]) * 0.5f;
+                if (y > 0 && y < height - 1) {
+                    sample.beforeGradY = (beforeData[idx + width] - beforeData[idx - width]) * 0.5f;
+                    sample.afterGradY = (afterData[idx + width] - afterData[idx - width]) * 0.5f;
+                }
+            }
+
+            if (needNeighborhood) {
+                float beforeSum = 0.0f, beforeSumSq = 0.0f;
+                float afterSum = 0.0f, afterSumSq = 0.0f;
+                int neighborCount = 0;
+                uint32_t yLo = (y > 0) ? y - 1 : y;
+                uint32_t yHi = (y < height - 1) ? y + 1 : y;
+                uint32_t xLo = (x > 0) ? x - 1 : x;
+                uint32_t xHi = (x < width - 1) ? x + 1 : x;
+                for (uint32_t ny = yLo; ny <= yHi; ++ny) {
+                    for (uint32_t nx = xLo; nx <= xHi; ++nx) {
+                        size_t nIdx = static_cast<size_t>(ny) * width + nx;
+                        float b = beforeData[nIdx];
+                        float a = afterData[nIdx];
+                        beforeSum += b;
+                        beforeSumSq += b * b;
+                        afterSum += a;
+                        afterSumSq += a * a;
+                        ++neighborCount;
+                    }
+                }
+                float invCount = 1.0f / static_cast<float>(neighborCount);
+                sample.beforeNeighborhoodMean = beforeSum * invCount;
+                sample.beforeNeighborhoodVariance =
+                    std::max(0.0f, beforeSumSq * invCount - sample.beforeNeighborhoodMean * sample.beforeNeighborhoodMean);
+                sample.afterNeighborhoodMean = afterSum * invCount;
+                sample.afterNeighborhoodVariance =
+                    std::max(0.0f, afterSumSq * invCount - sample.afterNeighborhoodMean * sample.afterNeighborhoodMean);
+            }
+
+            for (auto& entry : fused) {
+                entry.accumulator->Accumulate(sample);
+            }
+        }
+    }
+
+    for (auto& entry : fused) {
+        try {
+            results[entry.resultIndex] = entry.accumulator->Finalize();
+        } catch (const std::exception& e) {
+            results[entry.resultIndex].metricName = metrics[entry.resultIndex]->GetMetricName();
+            results[entry.resultIndex].errorMessage = e.what();
+            results[entry.resultIndex].isSuccessful = false;
+        }
+    }
+
+    return results;
+}
+
 float TerrainMetricBase::CalculateVariance(const std::vector<float>& data) {
     if (data.empty()) return 0.0f;
     
@@ -6,6 +6,7 @@ module;
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <limits>
 #include <queue>
 #include <numeric>
 #include <string>
@@ -22,8 +23,117 @@ import GenerationTypes;
 
 namespace PlanetGen::Generation::Analysis {
 
+namespace {
+
+// Coarse level used for candidate rejection: ~32x32-sample footprints keep
+// the mask small while each rejected texel skips a whole block of samples
+constexpr uint32_t kCoarseLevelShift = 5;
+
+// A strict local minimum needs strictly higher neighbors, so a coarse
+// neighborhood with zero relief (ocean floor, clamped plains) cannot
+// contain a valley point
+bool CoarseRegionIsFlat(const ElevationPyramid::Level& level, uint32_t cx, uint32_t cy) {
+    float lo = std::numeric_limits<float>::max();
+    float hi = std::numeric_limits<float>::lowest();
+
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            uint32_t nx = static_cast<uint32_t>(std::clamp(static_cast<int>(cx) + dx, 0, static_cast<int>(level.width) - 1));
+            uint32_t ny = static_cast<uint32_t>(std::clamp(static_cast<int>(cy) + dy, 0, static_cast<int>(level.height) - 1));
+            size_t idx = static_cast<size_t>(ny) * level.width + nx;
+            lo = std::min(lo, level.minData[idx]);
+            hi = std::max(hi, level.maxData[idx]);
+        }
+    }
+
+    return hi - lo <= 0.0f;
+}
+
+// First sample-lattice position at or past the right edge of coarse texel cx,
+// minus one step so the loop increment lands exactly on it
+uint32_t SkipPastCoarseTexel(uint32_t cx, uint32_t coarseShift, uint32_t sampleStep) {
+    uint32_t blockEnd = (cx + 1) << coarseShift;
+    return ((blockEnd + sampleStep - 1) / sampleStep) * sampleStep - sampleStep;
+}
+
+} // namespace
+
+std::shared_ptr<const ElevationPyramid> ElevationPyramid::Build(
+    const std::vector<float>& elevation, uint32_t width, uint32_t height) {
+    auto pyramid = std::make_shared<ElevationPyramid>();
+    pyramid->sourceWidth = width;
+    pyramid->sourceHeight = height;
+    pyramid->sourceData = elevation.data();
+
+    if (width < 2 || height < 2 || elevation.size() < static_cast<size_t>(width) * height) {
+        return pyramid;
+    }
+
+    constexpr uint32_t kMaxLevels = 6;
+    constexpr uint32_t kMinDimension = 8;
+
+    // Reserve up front so the src pointers below stay valid across push_back
+    pyramid->levels.reserve(kMaxLevels);
+
+    const std::vector<float>* srcMin = &elevation;
+    const std::vector<float>* srcMax = &elevation;
+    uint32_t srcWidth = width;
+    uint32_t srcHeight = height;
+
+    while (pyramid->levels.size() < kMaxLevels &&
+           srcWidth / 2 >= kMinDimension && srcHeight / 2 >= kMinDimension) {
+        Level level;
+        level.width = (srcWidth + 1) / 2;
+        level.height = (srcHeight + 1) / 2;
+        level.minData.resize(static_cast<size_t>(level.width) * level.height);
+        level.maxData.resize(static_cast<size_t>(level.width) * level.height);
+
+        for (uint32_t y = 0; y < level.height; ++y) {
+            for (uint32_t x = 0; x < level.width; ++x) {
+                float lo = std::numeric_limits<float>::max();
+                float hi = std::numeric_limits<float>::lowest();
+
+                for (uint32_t dy = 0; dy <= 1; ++dy) {
+                    for (uint32_t dx = 0; dx <= 1; ++dx) {
+                        uint32_t sx = std::min(2 * x + dx, srcWidth - 1);
+                        uint32_t sy = std::min(2 * y + dy, srcHeight - 1);
+                        size_t idx = static_cast<size_t>(sy) * srcWidth + sx;
+                        lo = std::min(lo, (*srcMin)[idx]);
+                        hi = std::max(hi, (*srcMax)[idx]);
+                    }
+                }
+
+                size_t outIdx = static_cast<size_t>(y) * level.width + x;
+                level.minData[outIdx] = lo;
+                level.maxData[outIdx] = hi;
+            }
+        }
+
+        pyramid->levels.push_back(std::move(level));
+        const Level& built = pyramid->levels.back();
+        srcMin = &built.minData;
+        srcMax = &built.maxData;
+        srcWidth = built.width;
+        srcHeight = built.height;
+    }
+
+    return pyramid;
+}
+
 MountainStructureAnalyzer::MountainStructureAnalyzer() = default;
 
+const ElevationPyramid* MountainStructureAnalyzer::EnsurePyramid(const PlanetaryData& data) {
+    if (m_pyramid &&
+        m_pyramid->sourceWidth == data.elevation.width &&
+        m_pyramid->sourceHeight == data.elevation.height &&
+        m_pyramid->sourceData == data.elevation.data.data()) {
+        return m_pyramid.get();
+    }
+
+    m_pyramid = ElevationPyramid::Build(data.elevation.data, data.elevation.width, data.elevation.height);
+    return m_pyramid.get();
+}
+
 TectonicActivity MountainStructureAnalyzer::AnalyzeTectonicRealism(const PlanetaryData& data) {
     TectonicActivity activity;
     
@@ -121,12 +231,36 @@ std::vector<size_t> MountainStructureAnalyzer::FindPeaks(const PlanetaryData& da
     std::vector<size_t> peaks;
     
     float elevationThreshold = data.seaLevel + 500.0f; // At least 500m above sea level
-    
+
     // Use sampling for faster analysis - check every 4th pixel
     const uint32_t sampleStep = 4;
-    
+
+    // Coarse candidate mask: a pyramid texel whose footprint max is below the
+    // threshold cannot contain a qualifying peak, so its whole block of
+    // samples is skipped without touching full-resolution data
+    const ElevationPyramid::Level* coarse = nullptr;
+    uint32_t coarseShift = 0;
+    if (m_usePyramid) {
+        const ElevationPyramid* pyramid = EnsurePyramid(data);
+        if (pyramid && !pyramid->levels.empty()) {
+            uint32_t levelIndex = std::min<uint32_t>(kCoarseLevelShift - 1,
+                static_cast<uint32_t>(pyramid->levels.size()) - 1);
+            coarse = &pyramid->levels[levelIndex];
+            coarseShift = levelIndex + 1;
+        }
+    }
+
     for (uint32_t y = sampleStep; y < data.elevation.height - sampleStep; y += sampleStep) {
         for (uint32_t x = sampleStep; x < data.elevation.width - sampleStep; x += sampleStep) {
+            if (coarse) {
+                uint32_t cx = std::min(x >> coarseShift, coarse->width - 1);
+                uint32_t cy = std::min(y >> coarseShift, coarse->height - 1);
+                if (coarse->maxData[static_cast<size_t>(cy) * coarse->width + cx] < elevationThreshold) {
+                    x = SkipPastCoarseTexel(cx, coarseShift, sampleStep);
+                    continue;
+                }
+            }
+
             size_t idx = y * data.elevation.width + x;
             float currentElevation = data.elevation.data[idx];
             
@@ -264,14 +398,37 @@ float MountainStructureAnalyzer::EvaluateValleyCarving(const PlanetaryData& data
     // Analyze valley patterns - realistic terrain has valleys between mountains
     float valleyScore = 0.0f;
     int valleyCount = 0;
-    
+
     // Use sampling for faster analysis
     const uint32_t sampleStep = 4;
-    
+
+    // Coarse flatness mask: zero-relief coarse neighborhoods cannot contain
+    // strict local minima, so those blocks are skipped wholesale
+    const ElevationPyramid::Level* coarse = nullptr;
+    uint32_t coarseShift = 0;
+    if (m_usePyramid) {
+        const ElevationPyramid* pyramid = EnsurePyramid(data);
+        if (pyramid && !pyramid->levels.empty()) {
+            uint32_t levelIndex = std::min<uint32_t>(kCoarseLevelShift - 1,
+                static_cast<uint32_t>(pyramid->levels.size()) - 1);
+            coarse = &pyramid->levels[levelIndex];
+            coarseShift = levelIndex + 1;
+        }
+    }
+
     for (uint32_t y = sampleStep; y < data.elevation.height - sampleStep; y += sampleStep) {
         for (uint32_t x = sampleStep; x < data.elevation.width - sampleStep; x += sampleStep) {
+            if (coarse) {
+                uint32_t cx = std::min(x >> coarseShift, coarse->width - 1);
+                uint32_t cy = std::min(y >> coarseShift, coarse->height - 1);
+                if (CoarseRegionIsFlat(*coarse, cx, cy)) {
+                    x = SkipPastCoarseTexel(cx, coarseShift, sampleStep);
+                    continue;
+                }
+            }
+
             size_t idx = y * data.elevation.width + x;
-            
+
             // Look for valley patterns (low points surrounded by higher elevation)
             if (IsValleyPoint(idx, data)) {
                 valleyScore += AnalyzeValleyDepth(idx, data);
@@ -8,6 +8,7 @@ module;
 #include <chrono>
 #include <mutex>
 #include <thread>
+#include <cstdint>
 
 module PipelineIntegration;
 
@@ -49,6 +50,9 @@ bool TerrainPipelineMonitor::Initialize(const DifferentialAnalysisConfig& config
 }
 
 void TerrainPipelineMonitor::Shutdown() {
+    // Stop the capture thread first (drains any queued captures)
+    EnableAsyncCapture(false);
+
     if (m_analysisSystem) {
         m_analysisSystem.reset();
     }
@@ -61,6 +65,8 @@ void TerrainPipelineMonitor::Shutdown() {
     std::lock_guard<std::mutex> lock(m_snapshotMutex);
     m_snapshots.clear();
     m_snapshotIndices.clear();
+    m_modalityBlockCache.clear();
+    m_coordinateBlockCache.clear();
 }
 
 void TerrainPipelineMonitor::RegisterPlanetaryGenerator(std::shared_ptr<PlanetGen::Generation::PlanetaryGenerator> generator) {
@@ -104,78 +110,28 @@ void TerrainPipelineMonitor::RegisterTerrainOrchestrator(std::shared_ptr<PlanetG
 }
 
 void TerrainPipelineMonitor::CapturePreGenerationSnapshot(const PlanetaryData& initialData, const std::string& preset) {
-    auto snapshot = CreateSnapshotFromPlanetaryData(initialData, "PreGeneration", 0);
-    
-    std::lock_guard<std::mutex> lock(m_snapshotMutex);
-    m_snapshotIndices["PreGeneration"] = m_snapshots.size();
-    m_snapshots.push_back(std::move(snapshot));
+    SubmitCapture(CreateSnapshotFromPlanetaryData(initialData, "PreGeneration", 0), "PreGeneration");
 }
 
 void TerrainPipelineMonitor::CapturePostGenerationSnapshot(const PlanetaryData& generatedData) {
     // Ensure all GPU operations are complete before accessing planetary data
     EnsureDeviceSynchronization();
-    
-    auto snapshot = CreateSnapshotFromPlanetaryData(generatedData, "PostGeneration", 1);
-    
-    if (m_generatorAdapter) {
-        m_generatorAdapter->SetOutputSnapshot(CopySnapshot(*snapshot));
-    }
-    
-    bool hasPreGenerationSnapshot = false;
-    {
-        std::lock_guard<std::mutex> lock(m_snapshotMutex);
-        m_snapshotIndices["PostGeneration"] = m_snapshots.size();
-        m_snapshots.push_back(std::move(snapshot));
-        
-        // Check if we have pre-generation snapshot while we have the lock
-        hasPreGenerationSnapshot = (m_snapshotIndices.find("PreGeneration") != m_snapshotIndices.end());
-    } // Release lock before calling ProcessPipelineTransition
-    
-    // Analyze generation step if we have pre-generation data
-    if (hasPreGenerationSnapshot) {
-        ProcessPipelineTransition("PreGeneration", "PostGeneration");
-    }
+
+    SubmitCapture(CreateSnapshotFromPlanetaryData(generatedData, "PostGeneration", 1), "PostGeneration");
 }
 
 void TerrainPipelineMonitor::CapturePrePhysicsSnapshot(const PlanetaryData& prePhysicsData) {
-    auto snapshot = CreateSnapshotFromPlanetaryData(prePhysicsData, "PrePhysics", 2);
-    
-    if (m_physicsAdapter) {
-        m_physicsAdapter->SetInputSnapshot(CopySnapshot(*snapshot));
-    }
-    
-    std::lock_guard<std::mutex> lock(m_snapshotMutex);
-    m_snapshotIndices["PrePhysics"] = m_snapshots.size();
-    m_snapshots.push_back(std::move(snapshot));
+    SubmitCapture(CreateSnapshotFromPlanetaryData(prePhysicsData, "PrePhysics", 2), "PrePhysics");
 }
 
 void TerrainPipelineMonitor::CapturePostPhysicsSnapshot(const PlanetaryData& postPhysicsData) {
-    
+
     try {
         // Ensure all GPU operations are complete before accessing planetary data
         EnsureDeviceSynchronization();
-        
-        auto snapshot = CreateSnapshotFromPlanetaryData(postPhysicsData, "PostPhysics", 3);
-        
-        if (m_physicsAdapter) {
-            m_physicsAdapter->SetOutputSnapshot(CopySnapshot(*snapshot));
-        }
-        
-        bool hasPrePhysicsSnapshot = false;
-        {
-            std::lock_guard<std::mutex> lock(m_snapshotMutex);
-            m_snapshotIndices["PostPhysics"] = m_snapshots.size();
-            m_snapshots.push_back(std::move(snapshot));
-            
-            // Check if we have pre-physics snapshot while we have the lock
-            hasPrePhysicsSnapshot = (m_snapshotIndices.find("PrePhysics") != m_snapshotIndices.end());
-        } // Release lock before calling ProcessPipelineTransition
-        
-        // Analyze physics step
-        if (hasPrePhysicsSnapshot) {
-            ProcessPipelineTransition("PrePhysics", "PostPhysics");
-        }
-        
+
+        SubmitCapture(CreateSnapshotFromPlanetaryData(postPhysicsData, "PostPhysics", 3), "PostPhysics");
+
     } catch (const std::exception& e) {
         std::cerr << "[ERROR] Exception in CapturePostPhysicsSnapshot: " << e.what() << std::endl;
         throw;
@@ -186,52 +142,166 @@ void TerrainPipelineMonitor::CapturePostPhysicsSnapshot(const PlanetaryData& pos
 }
 
 void TerrainPipelineMonitor::CapturePreCoherenceSnapshot(const PlanetaryData& preCoherenceData) {
-    auto snapshot = CreateSnapshotFromPlanetaryData(preCoherenceData, "PreCoherence", 4);
-    
-    std::lock_guard<std::mutex> lock(m_snapshotMutex);
-    m_snapshotIndices["PreCoherence"] = m_snapshots.size();
-    m_snapshots.push_back(std::move(snapshot));
+    SubmitCapture(CreateSnapshotFromPlanetaryData(preCoherenceData, "PreCoherence", 4), "PreCoherence");
 }
 
 void TerrainPipelineMonitor::CapturePostCoherenceSnapshot(const PlanetaryData& postCoherenceData) {
     // Ensure all GPU operations are complete before accessing planetary data
     EnsureDeviceSynchronization();
-    
-    auto snapshot = CreateSnapshotFromPlanetaryData(postCoherenceData, "PostCoherence", 5);
-    
-    bool hasPreCoherenceSnapshot = false;
+
+    SubmitCapture(CreateSnapshotFromPlanetaryData(postCoherenceData, "PostCoherence", 5), "PostCoherence");
+}
+
+void TerrainPipelineMonitor::CaptureFinalSnapshot(const PlanetaryData& finalData) {
+    SubmitCapture(CreateSnapshotFromPlanetaryData(finalData, "Final", 6), "Final");
+}
+
+std::string TerrainPipelineMonitor::PreviousStageFor(const std::string& stageName) {
+    // Stage pairs whose transition is analyzed as soon as both ends exist
+    if (stageName == "PostGeneration") return "PreGeneration";
+    if (stageName == "PostPhysics") return "PrePhysics";
+    if (stageName == "PostCoherence") return "PreCoherence";
+    return {};
+}
+
+void TerrainPipelineMonitor::FinalizeCapture(
+    std::unique_ptr<ConcreteTerrainDataSnapshot> snapshot,
+    const std::string& stageName
+) {
+    // Compute statistics deferred by async capture (no-op for sync captures)
+    snapshot->EnsureStatistics();
+
+    // Hash 64x64 blocks on the capture thread so transition analysis can
+    // detect unchanged tiles without re-reading the data
+    snapshot->EnsureBlockHashes();
+
+    if (stageName == "PostGeneration" && m_generatorAdapter) {
+        m_generatorAdapter->SetOutputSnapshot(CopySnapshot(*snapshot));
+    } else if (stageName == "PrePhysics" && m_physicsAdapter) {
+        m_physicsAdapter->SetInputSnapshot(CopySnapshot(*snapshot));
+    } else if (stageName == "PostPhysics" && m_physicsAdapter) {
+        m_physicsAdapter->SetOutputSnapshot(CopySnapshot(*snapshot));
+    }
+
+    const std::string previousStage = PreviousStageFor(stageName);
+    bool hasPreviousSnapshot = false;
     {
         std::lock_guard<std::mutex> lock(m_snapshotMutex);
-        m_snapshotIndices["PostCoherence"] = m_snapshots.size();
+        m_snapshotIndices[stageName] = m_snapshots.size();
         m_snapshots.push_back(std::move(snapshot));
-        
-        // Check if we have pre-coherence snapshot while we have the lock
-        hasPreCoherenceSnapshot = (m_snapshotIndices.find("PreCoherence") != m_snapshotIndices.end());
+
+        // Check for the matching pre-stage snapshot while we have the lock
+        hasPreviousSnapshot = !previousStage.empty() &&
+            (m_snapshotIndices.find(previousStage) != m_snapshotIndices.end());
     } // Release lock before calling ProcessPipelineTransition
-    
-    // Analyze coherence step
-    if (hasPreCoherenceSnapshot) {
-        ProcessPipelineTransition("PreCoherence", "PostCoherence");
+
+    if (stageName == "Final") {
+        // Update statistics
+        std::lock_guard<std::mutex> statsLock(m_statisticsMutex);
+        m_statistics.totalGenerationsMonitored++;
+    } else if (hasPreviousSnapshot) {
+        ProcessPipelineTransition(previousStage, stageName);
     }
 }
 
-void TerrainPipelineMonitor::CaptureFinalSnapshot(const PlanetaryData& finalData) {
-    auto snapshot = CreateSnapshotFromPlanetaryData(finalData, "Final", 6);
-    
-    std::lock_guard<std::mutex> lock(m_snapshotMutex);
-    m_snapshotIndices["Final"] = m_snapshots.size();
-    m_snapshots.push_back(std::move(snapshot));
-    
-    // Update statistics
-    std::lock_guard<std::mutex> statsLock(m_statisticsMutex);
-    m_statistics.totalGenerationsMonitored++;
+void TerrainPipelineMonitor::SubmitCapture(
+    std::unique_ptr<ConcreteTerrainDataSnapshot> snapshot,
+    const std::string& stageName
+) {
+    if (!snapshot) {
+        return;
+    }
+
+    if (!m_asyncCaptureEnabled || !m_captureThreadRunning) {
+        FinalizeCapture(std::move(snapshot), stageName);
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_captureRingMutex);
+
+        // Backpressure only when the ring is full
+        m_captureRingNotFull.wait(lock, [this] {
+            return m_captureRing.size() < kCaptureRingCapacity || !m_captureThreadRunning;
+        });
+
+        if (!m_captureThreadRunning) {
+            lock.unlock();
+            FinalizeCapture(std::move(snapshot), stageName);
+            return;
+        }
+
+        m_captureRing.push_back({std::move(snapshot), stageName});
+        m_pendingCaptureCount.fetch_add(1);
+    }
+    m_captureRingNotEmpty.notify_one();
+}
+
+void TerrainPipelineMonitor::CaptureWorkerLoop() {
+    while (true) {
+        PendingCapture pending;
+        {
+            std::unique_lock<std::mutex> lock(m_captureRingMutex);
+            m_captureRingNotEmpty.wait(lock, [this] {
+                return !m_captureRing.empty() || !m_captureThreadRunning;
+            });
+
+            if (m_captureRing.empty()) {
+                return; // Stopped and fully drained
+            }
+
+            pending = std::move(m_captureRing.front());
+            m_captureRing.pop_front();
+        }
+        m_captureRingNotFull.notify_one();
+
+        try {
+            FinalizeCapture(std::move(pending.snapshot), pending.stageName);
+        } catch (const std::exception& e) {
+            std::cerr << "[ERROR] Async capture failed for " << pending.stageName << ": " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "[ERROR] Unknown async capture failure for " << pending.stageName << std::endl;
+        }
+
+        if (m_pendingCaptureCount.fetch_sub(1) == 1) {
+            m_captureRingDrained.notify_all();
+        }
+    }
+}
+
+void TerrainPipelineMonitor::EnableAsyncCapture(bool enable) {
+    if (enable) {
+        m_asyncCaptureEnabled = true;
+        if (!m_captureThreadRunning.exchange(true)) {
+            m_captureThread = std::thread([this]() { CaptureWorkerLoop(); });
+        }
+    } else {
+        m_asyncCaptureEnabled = false;
+        if (m_captureThreadRunning.exchange(false)) {
+            m_captureRingNotEmpty.notify_all();
+            m_captureRingNotFull.notify_all();
+            if (m_captureThread.joinable()) {
+                m_captureThread.join();
+            }
+        }
+    }
+}
+
+void TerrainPipelineMonitor::FlushPendingCaptures() {
+    std::unique_lock<std::mutex> lock(m_captureRingMutex);
+    m_captureRingDrained.wait(lock, [this] {
+        return m_pendingCaptureCount.load() == 0;
+    });
 }
 
 std::vector<PipelineAnalysisResult> TerrainPipelineMonitor::AnalyzeFullPipeline() {
     if (!m_analysisSystem) {
         return {};
     }
-    
+
+    // Make sure every queued async capture has landed before analyzing
+    FlushPendingCaptures();
+
     // Since we're managing snapshots locally, perform direct analysis
     std::vector<PipelineAnalysisResult> results;
     
@@ -279,6 +349,9 @@ std::vector<PipelineAnalysisResult> TerrainPipelineMonitor::AnalyzeFullPipeline(
 }
 
 PipelineAnalysisResult TerrainPipelineMonitor::AnalyzeLastTransition() {
+    // Make sure every queued async capture has landed before analyzing
+    FlushPendingCaptures();
+
     std::lock_guard<std::mutex> lock(m_snapshotMutex);
     
     if (m_snapshots.size() < 2) {
@@ -499,12 +572,16 @@ std::unique_ptr<ConcreteTerrainDataSnapshot> TerrainPipelineMonitor::CreateSnaps
         metadata.processingParameters = ""; // Could be populated with actual parameters
         
         auto snapshot = std::make_unique<ConcreteTerrainDataSnapshot>(metadata);
-        
+
+        // When async capture is active, only block acquisition happens here;
+        // statistics are computed on the capture thread (EnsureStatistics)
+        const bool deferStatistics = m_asyncCaptureEnabled && m_captureThreadRunning;
+
         // Safely copy data from PlanetaryData using chunked copying to avoid deadlocks
-        SafeCopyModalityData(data.elevation, "elevation", snapshot.get());
-        SafeCopyModalityData(data.temperature, "temperature", snapshot.get());
-        SafeCopyModalityData(data.precipitation, "precipitation", snapshot.get());
-        SafeCopyModalityData(data.vegetation, "vegetation", snapshot.get());
+        SafeCopyModalityData(data.elevation, "elevation", snapshot.get(), deferStatistics);
+        SafeCopyModalityData(data.temperature, "temperature", snapshot.get(), deferStatistics);
+        SafeCopyModalityData(data.precipitation, "precipitation", snapshot.get(), deferStatistics);
+        SafeCopyModalityData(data.vegetation, "vegetation", snapshot.get(), deferStatistics);
         
         // Generate coordinates if we have elevation data
         if (!data.elevation.data.empty()) {
@@ -524,21 +601,11 @@ std::unique_ptr<ConcreteTerrainDataSnapshot> TerrainPipelineMonitor::CreateSnaps
 std::unique_ptr<ConcreteTerrainDataSnapshot> TerrainPipelineMonitor::CopySnapshot(const ConcreteTerrainDataSnapshot& source) {
     // Create a new snapshot with the same metadata
     auto copy = std::make_unique<ConcreteTerrainDataSnapshot>(source.GetMetadata());
-    
-    // Copy the data manually to avoid copy constructor issues
-    if (source.HasElevationData()) {
-        copy->SetElevationData(source.GetElevationData());
-    }
-    if (source.HasTemperatureData()) {
-        copy->SetTemperatureData(source.GetTemperatureData());
-    }
-    if (source.HasPrecipitationData()) {
-        copy->SetPrecipitationData(source.GetPrecipitationData());
-    }
-    if (source.HasVegetationData()) {
-        copy->SetVegetationData(source.GetVegetationData());
-    }
-    
+
+    // Zero-copy: both snapshots reference the same immutable blocks (and the
+    // already-computed statistics)
+    copy->ShareDataFrom(source);
+
     return copy;
 }
 
@@ -559,50 +626,104 @@ void TerrainPipelineMonitor::EnsureDeviceSynchronization() {
     }
 }
 
+uint64_t TerrainPipelineMonitor::FingerprintModalityData(const std::vector<float>& data) {
+    // FNV-1a over the raw buffer, word-at-a-time. A read-only hash pass is
+    // far cheaper than the allocate-and-copy it lets us skip when the buffer
+    // is unchanged between captures.
+    constexpr uint64_t kFnvOffset = 1469598103934665603ull;
+    constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+    uint64_t hash = kFnvOffset;
+    const auto* bytes = reinterpret_cast<const unsigned char*>(data.data());
+    const size_t byteCount = data.size() * sizeof(float);
+    const size_t wordCount = byteCount / sizeof(uint64_t);
+
+    const auto* words = reinterpret_cast<const uint64_t*>(bytes);
+    for (size_t i = 0; i < wordCount; ++i) {
+        hash ^= words[i];
+        hash *= kFnvPrime;
+    }
+    for (size_t i = wordCount * sizeof(uint64_t); i < byteCount; ++i) {
+        hash ^= bytes[i];
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
 void TerrainPipelineMonitor::SafeCopyModalityData(
     const PlanetaryModality& modality,
     const std::string& modalityType,
-    ConcreteTerrainDataSnapshot* snapshot
+    ConcreteTerrainDataSnapshot* snapshot,
+    bool deferStatistics
 ) {
     if (modality.data.empty() || !snapshot) {
         return;
     }
-    
+    const bool computeStatistics = !deferStatistics;
+
     try {
+        // Copy-on-write: if the buffer is byte-identical to the previous
+        // capture of this modality, share that immutable block instead of
+        // materializing a new one
+        const uint64_t fingerprint = FingerprintModalityData(modality.data);
+        {
+            std::lock_guard<std::mutex> lock(m_snapshotMutex);
+            auto it = m_modalityBlockCache.find(modalityType);
+            if (it != m_modalityBlockCache.end() && it->second.block &&
+                it->second.size == modality.data.size() &&
+                it->second.fingerprint == fingerprint) {
+                if (modalityType == "elevation") {
+                    snapshot->SetElevationDataShared(it->second.block, computeStatistics);
+                } else if (modalityType == "temperature") {
+                    snapshot->SetTemperatureDataShared(it->second.block, computeStatistics);
+                } else if (modalityType == "precipitation") {
+                    snapshot->SetPrecipitationDataShared(it->second.block, computeStatistics);
+                } else if (modalityType == "vegetation") {
+                    snapshot->SetVegetationDataShared(it->second.block, computeStatistics);
+                }
+                return;
+            }
+        }
+
         // Copy data in chunks to avoid large memory allocations that could cause deadlocks
         const size_t chunkSize = 1024 * 1024; // 1MB chunks
         const size_t totalSize = modality.data.size();
-        
+
         std::vector<float> safeCopy;
         safeCopy.reserve(totalSize);
-        
+
         // Copy in chunks with yield points to avoid blocking
         for (size_t offset = 0; offset < totalSize; offset += chunkSize) {
             size_t currentChunkSize = std::min(chunkSize, totalSize - offset);
-            
+
             // Copy chunk
             auto beginIt = modality.data.begin() + offset;
             auto endIt = beginIt + currentChunkSize;
-            
+
             safeCopy.insert(safeCopy.end(), beginIt, endIt);
-            
+
             // Yield CPU to prevent blocking other threads
             if (offset + chunkSize < totalSize) {
                 std::this_thread::yield();
             }
         }
-        
-        // Set the data on the snapshot
+
+        // Seal the copy into an immutable block the next capture can share
+        auto block = std::make_shared<const std::vector<float>>(std::move(safeCopy));
+
         if (modalityType == "elevation") {
-            snapshot->SetElevationData(std::move(safeCopy));
+            snapshot->SetElevationDataShared(block, computeStatistics);
         } else if (modalityType == "temperature") {
-            snapshot->SetTemperatureData(std::move(safeCopy));
+            snapshot->SetTemperatureDataShared(block, computeStatistics);
         } else if (modalityType == "precipitation") {
-            snapshot->SetPrecipitationData(std::move(safeCopy));
+            snapshot->SetPrecipitationDataShared(block, computeStatistics);
         } else if (modalityType == "vegetation") {
-            snapshot->SetVegetationData(std::move(safeCopy));
+            snapshot->SetVegetationDataShared(block, computeStatistics);
         }
-        
+
+        std::lock_guard<std::mutex> lock(m_snapshotMutex);
+        m_modalityBlockCache[modalityType] = {fingerprint, totalSize, std::move(block)};
+
     } catch (const std::exception& e) {
         std::cerr << "[WARNING] Failed to copy " << modalityType << " data safely: " << e.what() << std::endl;
         // Continue without this modality data rather than failing completely
@@ -619,8 +740,19 @@ void TerrainPipelineMonitor::SafeGenerateCoordinates(
     if (!snapshot || resolution == 0) {
         return;
     }
-    
+
     try {
+        // Coordinates are a pure function of resolution - share one immutable
+        // block across every snapshot at the same resolution
+        {
+            std::lock_guard<std::mutex> lock(m_snapshotMutex);
+            auto it = m_coordinateBlockCache.find(resolution);
+            if (it != m_coordinateBlockCache.end() && it->second) {
+                snapshot->SetCoordinatesShared(it->second);
+                return;
+            }
+        }
+
         std::vector<std::pair<float, float>> coordinates;
         coordinates.reserve(resolution * resolution);
         
@@ -644,8 +776,12 @@ void TerrainPipelineMonitor::SafeGenerateCoordinates(
             }
         }
         
-        snapshot->SetCoordinates(std::move(coordinates));
-        
+        auto block = std::make_shared<const std::vector<std::pair<float, float>>>(std::move(coordinates));
+        snapshot->SetCoordinatesShared(block);
+
+        std::lock_guard<std::mutex> lock(m_snapshotMutex);
+        m_coordinateBlockCache[resolution] = std::move(block);
+
     } catch (const std::exception& e) {
         std::cerr << "[WARNING] Failed to generate coordinates safely: " << e.what() << std::endl;
         // Continue without coordinates rather than failing completely
@@ -6,6 +6,9 @@ module;
 #include <algorithm>
 #include <numeric>
 #include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 // Parallel execution policies are not fully supported in libc++
 #if defined(__clang__) && defined(_LIBCPP_VERSION)
@@ -114,7 +117,7 @@ TerrainMetricResult StatisticalContinuityMetrics::AnalyzeTransition(
         }
         
         // Perform high-performance statistical analysis using JobSystem
-        auto statisticalAnalysis = AnalyzeStatisticalProperties(beforeElevation, afterElevation);
+        auto statisticalAnalysis = AnalyzeStatisticalProperties(beforeSnapshot, afterSnapshot);
         auto continuityAnalysis = AnalyzeContinuity(beforeElevation, afterElevation);
         auto distributionAnalysis = AnalyzeDistributionChanges(beforeElevation, afterElevation);
         
@@ -146,41 +149,177 @@ TerrainMetricResult StatisticalContinuityMetrics::AnalyzeTransition(
     return result;
 }
 
+/**
+ * Accumulates the statistical and continuity sums inside the shared fused
+ * traversal. The distribution histograms need the full data range up front,
+ * so Finalize runs AnalyzeDistributionChanges as its single remaining pass -
+ * versus the four-plus full traversals the classic AnalyzeTransition performs.
+ */
+class StatisticalContinuityMetrics::FusedAccumulator : public IFusedMetricAccumulator {
+public:
+    FusedAccumulator(const StatisticalContinuityMetrics& metric,
+                     const TerrainDataSnapshot& beforeSnapshot,
+                     const TerrainDataSnapshot& afterSnapshot,
+                     uint32_t width, uint32_t height)
+        : m_metric(metric),
+          m_beforeSnapshot(beforeSnapshot),
+          m_afterSnapshot(afterSnapshot),
+          m_width(width),
+          m_height(height),
+          m_startTime(std::chrono::high_resolution_clock::now()) {}
+
+    void Accumulate(const FusedSample& sample) override {
+        // Welford moments: numerically stable and directly cacheable as the
+        // snapshot summaries the classic path also consumes
+        m_beforeMoments.Add(sample.before);
+        m_afterMoments.Add(sample.after);
+
+        // Continuity sums over interior cells, matching ComputeContinuitySequential
+        uint32_t x = static_cast<uint32_t>(sample.index % m_width);
+        uint32_t y = static_cast<uint32_t>(sample.index / m_width);
+        if (x >= 1 && x + 1 < m_width && y >= 1 && y + 1 < m_height) {
+            m_spatialSum += std::abs(sample.after - sample.before);
+
+            // Executor gradients carry the 0.5 central-difference factor;
+            // undo it to match the raw neighbor differences used here
+            float beforeGradX = std::abs(sample.beforeGradX) * 2.0f;
+            float afterGradX = std::abs(sample.afterGradX) * 2.0f;
+            m_gradientSum += std::abs(afterGradX - beforeGradX);
+
+            ++m_validCells;
+        }
+    }
+
+    TerrainMetricResult Finalize() override {
+        TerrainMetricResult result;
+        result.metricName = m_metric.m_metricName;
+        result.isSuccessful = false;
+
+        // Statistics from the streamed moments; seed the metric's snapshot
+        // cache so later transitions touching the same snapshots skip their
+        // statistics pass entirely
+        m_metric.StoreSnapshotMoments(m_beforeSnapshot, m_beforeMoments);
+        m_metric.StoreSnapshotMoments(m_afterSnapshot, m_afterMoments);
+
+        StatisticalAnalysis statisticalAnalysis;
+        auto beforeStats = m_beforeMoments.ToBasicStats();
+        auto afterStats = m_afterMoments.ToBasicStats();
+        statisticalAnalysis.beforeMean = beforeStats.mean;
+        statisticalAnalysis.afterMean = afterStats.mean;
+        statisticalAnalysis.beforeVariance = beforeStats.variance;
+        statisticalAnalysis.afterVariance = afterStats.variance;
+        statisticalAnalysis.beforeStdDev = beforeStats.stdDev;
+        statisticalAnalysis.afterStdDev = afterStats.stdDev;
+        statisticalAnalysis.meanChange = std::abs(statisticalAnalysis.afterMean - statisticalAnalysis.beforeMean);
+        statisticalAnalysis.stdDevChange = std::abs(statisticalAnalysis.afterStdDev - statisticalAnalysis.beforeStdDev);
+        statisticalAnalysis.varianceChange = std::abs(statisticalAnalysis.afterVariance - statisticalAnalysis.beforeVariance);
+
+        // Continuity from the interior sums
+        ContinuityAnalysis continuityAnalysis;
+        if (m_width < 3 || m_height < 3) {
+            // Grid too small for meaningful continuity analysis
+            continuityAnalysis.spatialContinuity = 1.0f;
+            continuityAnalysis.gradientContinuity = 1.0f;
+            continuityAnalysis.localVarianceChange = 0.0f;
+        } else {
+            float avgSpatial = m_validCells > 0 ? m_spatialSum / m_validCells : 0.0f;
+            float avgGradient = m_validCells > 0 ? m_gradientSum / m_validCells : 0.0f;
+            continuityAnalysis.spatialContinuity = 1.0f / (1.0f + avgSpatial);
+            continuityAnalysis.gradientContinuity = 1.0f / (1.0f + avgGradient);
+            continuityAnalysis.localVarianceChange = avgSpatial; // Simplified
+        }
+
+        // Histograms are the one analysis that still needs its own pass
+        auto distributionAnalysis = m_metric.AnalyzeDistributionChanges(
+            m_beforeSnapshot.GetElevationData(), m_afterSnapshot.GetElevationData());
+
+        float statisticalScore = m_metric.ComputeStatisticalScore(statisticalAnalysis);
+        float continuityScore = m_metric.ComputeContinuityScore(continuityAnalysis);
+        float distributionScore = m_metric.ComputeDistributionScore(distributionAnalysis);
+
+        result.score = (statisticalScore * 0.4f + continuityScore * 0.4f + distributionScore * 0.2f);
+        result.detailMessage = m_metric.GenerateDetailedMessage(statisticalAnalysis, continuityAnalysis, distributionAnalysis);
+
+        if (result.score < 0.7f) {
+            result.suggestions = m_metric.GenerateParameterSuggestions(statisticalAnalysis, continuityAnalysis, distributionAnalysis);
+        }
+
+        result.isSuccessful = true;
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        result.analysisTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - m_startTime);
+
+        return result;
+    }
+
+private:
+    const StatisticalContinuityMetrics& m_metric;
+    const TerrainDataSnapshot& m_beforeSnapshot;
+    const TerrainDataSnapshot& m_afterSnapshot;
+    uint32_t m_width;
+    uint32_t m_height;
+    std::chrono::high_resolution_clock::time_point m_startTime;
+
+    StreamingMoments m_beforeMoments;
+    StreamingMoments m_afterMoments;
+
+    float m_spatialSum = 0.0f;
+    float m_gradientSum = 0.0f;
+    size_t m_validCells = 0;
+};
+
+uint32_t StatisticalContinuityMetrics::GetRequiredSampleQuantities() const {
+    return static_cast<uint32_t>(SampleQuantity::Value) |
+           static_cast<uint32_t>(SampleQuantity::Gradient);
+}
+
+std::unique_ptr<IFusedMetricAccumulator> StatisticalContinuityMetrics::CreateFusedAccumulator(
+    const TerrainDataSnapshot& beforeSnapshot,
+    const TerrainDataSnapshot& afterSnapshot
+) const {
+    // Invalid inputs fall back to AnalyzeTransition so its validation can
+    // produce the established error messages
+    if (!beforeSnapshot.HasElevationData() || !afterSnapshot.HasElevationData()) {
+        return nullptr;
+    }
+
+    const auto& beforeElevation = beforeSnapshot.GetElevationData();
+    const auto& afterElevation = afterSnapshot.GetElevationData();
+    if (beforeElevation.size() != afterElevation.size() || beforeElevation.empty()) {
+        return nullptr;
+    }
+
+    // Same grid dimension estimate as AnalyzeContinuity (roughly square grid)
+    const size_t dataSize = beforeElevation.size();
+    uint32_t width = static_cast<uint32_t>(std::sqrt(dataSize));
+    uint32_t height = (dataSize + width - 1) / width;
+
+    return std::make_unique<FusedAccumulator>(*this, beforeSnapshot, afterSnapshot, width, height);
+}
+
 StatisticalContinuityMetrics::StatisticalAnalysis StatisticalContinuityMetrics::AnalyzeStatisticalProperties(
-    const std::vector<float>& beforeData,
-    const std::vector<float>& afterData
+    const TerrainDataSnapshot& beforeSnapshot,
+    const TerrainDataSnapshot& afterSnapshot
 ) const {
     StatisticalAnalysis analysis;
-    
-    const size_t dataSize = beforeData.size();
-    
-    // Use parallel algorithms for better performance on large datasets
-    if (dataSize > 10000) {
-        // Parallel computation of statistics
-        auto [beforeStats, afterStats] = ComputeStatisticsParallel(beforeData, afterData);
-        analysis.beforeMean = beforeStats.mean;
-        analysis.afterMean = afterStats.mean;
-        analysis.beforeStdDev = beforeStats.stdDev;
-        analysis.afterStdDev = afterStats.stdDev;
-        analysis.beforeVariance = beforeStats.variance;
-        analysis.afterVariance = afterStats.variance;
-    } else {
-        // Sequential computation for smaller datasets
-        auto beforeStats = ComputeStatistics(beforeData);
-        auto afterStats = ComputeStatistics(afterData);
-        analysis.beforeMean = beforeStats.mean;
-        analysis.afterMean = afterStats.mean;
-        analysis.beforeStdDev = beforeStats.stdDev;
-        analysis.afterStdDev = afterStats.stdDev;
-        analysis.beforeVariance = beforeStats.variance;
-        analysis.afterVariance = afterStats.variance;
-    }
-    
+
+    // Cached incremental summaries - each snapshot is scanned at most once,
+    // so the "after" summary of one transition is reused as the "before"
+    // summary of the next
+    auto beforeStats = GetSnapshotMoments(beforeSnapshot).ToBasicStats();
+    auto afterStats = GetSnapshotMoments(afterSnapshot).ToBasicStats();
+    analysis.beforeMean = beforeStats.mean;
+    analysis.afterMean = afterStats.mean;
+    analysis.beforeStdDev = beforeStats.stdDev;
+    analysis.afterStdDev = afterStats.stdDev;
+    analysis.beforeVariance = beforeStats.variance;
+    analysis.afterVariance = afterStats.variance;
+
     // Compute changes
     analysis.meanChange = std::abs(analysis.afterMean - analysis.beforeMean);
     analysis.stdDevChange = std::abs(analysis.afterStdDev - analysis.beforeStdDev);
     analysis.varianceChange = std::abs(analysis.afterVariance - analysis.beforeVariance);
-    
+
     return analysis;
 }
 
@@ -236,90 +375,114 @@ StatisticalContinuityMetrics::DistributionAnalysis StatisticalContinuityMetrics:
     return analysis;
 }
 
-std::pair<StatisticalContinuityMetrics::BasicStats, StatisticalContinuityMetrics::BasicStats> 
-StatisticalContinuityMetrics::ComputeStatisticsParallel(
-    const std::vector<float>& beforeData,
-    const std::vector<float>& afterData
-) const {
-    thread_local static bool inParallelExecution = false;
-    if (inParallelExecution) {
-        // Fallback to sequential to avoid deadlock
-        return {ComputeStatistics(beforeData), ComputeStatistics(afterData)};
-    }
-    inParallelExecution = true;
+StatisticalContinuityMetrics::BasicStats StatisticalContinuityMetrics::StreamingMoments::ToBasicStats() const {
+    BasicStats stats;
+    if (count == 0) return stats;
+
+    stats.mean = static_cast<float>(mean);
+    stats.variance = static_cast<float>(m2 / static_cast<double>(count));
+    stats.stdDev = std::sqrt(stats.variance);
+    return stats;
+}
 
-    BasicStats beforeStats, afterStats;
+std::string StatisticalContinuityMetrics::MakeSnapshotCacheKey(const TerrainDataSnapshot& snapshot) {
+    // Stage identity plus capture time plus size - enough to tell two
+    // snapshots of the same stage apart without hashing the data itself
+    const auto& metadata = snapshot.GetMetadata();
+    auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        metadata.timestamp.time_since_epoch()).count();
+    return metadata.stageName + ":" + std::to_string(metadata.stageId) + ":" +
+           std::to_string(timestamp) + ":" +
+           std::to_string(snapshot.GetElevationData().size());
+}
 
-    auto beforeJob = JobSystem::Instance().CreateJob<BasicStats>(
-        [this, &beforeData]() -> BasicStats {
-            return ComputeStatistics(beforeData);
-        },
-        "ComputeBeforeStats"
-    );
+StatisticalContinuityMetrics::StreamingMoments StatisticalContinuityMetrics::GetSnapshotMoments(
+    const TerrainDataSnapshot& snapshot
+) const {
+    const std::string key = MakeSnapshotCacheKey(snapshot);
 
-    auto afterJob = JobSystem::Instance().CreateJob<BasicStats>(
-        [this, &afterData]() -> BasicStats {
-            return ComputeStatistics(afterData);
-        },
-        "ComputeAfterStats"
-    );
+    {
+        std::lock_guard<std::mutex> lock(m_momentsCacheMutex);
+        auto it = m_momentsCache.find(key);
+        if (it != m_momentsCache.end()) {
+            return it->second;
+        }
+    }
 
-    auto beforeHandle = JobSystem::Instance().Schedule(beforeJob);
-    auto afterHandle = JobSystem::Instance().Schedule(afterJob);
+    // Miss: one streaming pass over the data, then cache the summary
+    auto moments = ComputeMomentsBlocked(snapshot.GetElevationData());
 
-    beforeStats = beforeJob->GetResult();
-    afterStats = afterJob->GetResult();
+    std::lock_guard<std::mutex> lock(m_momentsCacheMutex);
+    if (m_momentsCache.size() > 64) {
+        m_momentsCache.clear(); // Bounded cache; summaries are cheap to rebuild
+    }
+    m_momentsCache.emplace(key, moments);
+    return moments;
+}
 
-    delete beforeJob;
-    delete afterJob;
+void StatisticalContinuityMetrics::StoreSnapshotMoments(
+    const TerrainDataSnapshot& snapshot,
+    const StreamingMoments& moments
+) const {
+    std::lock_guard<std::mutex> lock(m_momentsCacheMutex);
+    if (m_momentsCache.size() > 64) {
+        m_momentsCache.clear();
+    }
+    m_momentsCache.emplace(MakeSnapshotCacheKey(snapshot), moments);
+}
 
-    inParallelExecution = false;
-    return {beforeStats, afterStats};
+StatisticalContinuityMetrics::StreamingMoments StatisticalContinuityMetrics::ComputeMomentsRange(
+    const float* data,
+    size_t count
+) {
+    StreamingMoments moments;
+    for (size_t i = 0; i < count; ++i) {
+        moments.Add(data[i]);
+    }
+    return moments;
 }
 
-StatisticalContinuityMetrics::BasicStats StatisticalContinuityMetrics::ComputeStatistics(
+StatisticalContinuityMetrics::StreamingMoments StatisticalContinuityMetrics::ComputeMomentsBlocked(
     const std::vector<float>& data
 ) const {
-    BasicStats stats;
-    
-    if (data.empty()) return stats;
-    
-    // Use parallel algorithms where available
-#ifdef NO_PARALLEL_EXECUTION
-    // Sequential fallback for Clang/libc++
-    stats.mean = std::reduce(data.begin(), data.end(), 0.0f) / data.size();
-    
-    // Compute variance
-    float variance = std::transform_reduce(
-        data.begin(), data.end(),
-        0.0f,
-        std::plus<>(),
-        [mean = stats.mean](float value) {
-            float diff = value - mean;
-            return diff * diff;
-        }
-    ) / data.size();
-#else
-    // Parallel execution for MSVC and GCC with libstdc++
-    stats.mean = std::reduce(std::execution::par_unseq, data.begin(), data.end(), 0.0f) / data.size();
-    
-    // Compute variance
-    float variance = std::transform_reduce(
-        std::execution::par_unseq,
-        data.begin(), data.end(),
-        0.0f,
-        std::plus<>(),
-        [mean = stats.mean](float value) {
-            float diff = value - mean;
-            return diff * diff;
-        }
-    ) / data.size();
-#endif
-    
-    stats.variance = variance;
-    stats.stdDev = std::sqrt(variance);
-    
-    return stats;
+    constexpr size_t kBlockSize = 65536;
+
+    thread_local static bool inParallelExecution = false;
+    if (data.size() <= kBlockSize * 2 || inParallelExecution) {
+        // Small datasets (or re-entrant calls from inside a job, which would
+        // deadlock the JobSystem) run the single-threaded streaming pass
+        return ComputeMomentsRange(data.data(), data.size());
+    }
+    inParallelExecution = true;
+
+    // Per-block partials computed in parallel, merged in order
+    const size_t blockCount = (data.size() + kBlockSize - 1) / kBlockSize;
+    std::vector<TypedJob<StreamingMoments>*> jobs;
+    jobs.reserve(blockCount);
+
+    for (size_t block = 0; block < blockCount; ++block) {
+        const size_t begin = block * kBlockSize;
+        const size_t count = std::min(kBlockSize, data.size() - begin);
+        const float* blockData = data.data() + begin;
+
+        auto* job = JobSystem::Instance().CreateJob<StreamingMoments>(
+            [blockData, count]() -> StreamingMoments {
+                return ComputeMomentsRange(blockData, count);
+            },
+            "ComputeMomentsBlock"
+        );
+        JobSystem::Instance().Schedule(job);
+        jobs.push_back(job);
+    }
+
+    StreamingMoments moments;
+    for (auto* job : jobs) {
+        moments.Merge(job->GetResult());
+        delete job;
+    }
+
+    inParallelExecution = false;
+    return moments;
 }
 
 StatisticalContinuityMetrics::ContinuityAnalysis StatisticalContinuityMetrics::ComputeContinuityParallel(
@@ -1,6 +1,7 @@
 module;
 
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <fstream>
 #include <vector>
@@ -8,12 +9,282 @@ module;
 #include <variant>
 #include <iomanip>
 #include <cctype>
+#include <charconv>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <cstddef>
 
 module JsonConfigurationHelpers;
 
 namespace PlanetGen::Generation::Configuration {
 
+// =============================================================================
+// JsonDocument - in-situ arena-backed parser
+// =============================================================================
+
+bool JsonDocument::Parse(std::string_view json) {
+    m_blocks.clear();
+    m_blockOffset = 0;
+    m_root = nullptr;
+    m_nodeScratch.clear();
+    m_memberScratch.clear();
+
+    size_t pos = 0;
+    SkipWhitespace(json, pos);
+    if (pos >= json.size()) {
+        return false;
+    }
+
+    Node root = ParseValue(json, pos);
+    m_root = ArenaAllocateArray<Node>(1);
+    *m_root = root;
+    return true;
+}
+
+void* JsonDocument::ArenaAllocate(size_t size, size_t alignment) {
+    // Oversized requests (very wide arrays, long escaped strings) get a
+    // dedicated block inserted behind the current one so the bump pointer
+    // keeps working against a partially filled block
+    if (size > kArenaBlockSize) {
+        auto block = std::make_unique<std::byte[]>(size);
+        void* result = block.get();
+        if (m_blocks.empty()) {
+            m_blocks.push_back(std::move(block));
+            m_blockOffset = size; // Fully consumed; next allocation opens a fresh block
+        } else {
+            m_blocks.insert(m_blocks.end() - 1, std::move(block));
+        }
+        return result;
+    }
+
+    size_t aligned = (m_blockOffset + alignment - 1) & ~(alignment - 1);
+    if (m_blocks.empty() || aligned + size > kArenaBlockSize) {
+        m_blocks.push_back(std::make_unique<std::byte[]>(kArenaBlockSize));
+        aligned = 0;
+    }
+    void* result = m_blocks.back().get() + aligned;
+    m_blockOffset = aligned + size;
+    return result;
+}
+
+JsonDocument::Node JsonDocument::ParseValue(std::string_view json, size_t& pos) {
+    SkipWhitespace(json, pos);
+
+    if (pos >= json.size()) {
+        return Node{}; // null
+    }
+
+    char ch = json[pos];
+    if (ch == '"') {
+        Node node;
+        if (ParseStringToken(json, pos, node.stringValue)) {
+            node.type = NodeType::String;
+        }
+        return node;
+    } else if (ch == '{') {
+        return ParseObject(json, pos);
+    } else if (ch == '[') {
+        return ParseArray(json, pos);
+    } else if (ch == 't' || ch == 'f') {
+        return ParseBoolean(json, pos);
+    } else if (ch == 'n') {
+        pos += 4; // Skip "null"
+        return Node{};
+    } else if (std::isdigit(static_cast<unsigned char>(ch)) || ch == '-' || ch == '+') {
+        return ParseNumber(json, pos);
+    }
+
+    return Node{};
+}
+
+bool JsonDocument::ParseStringToken(std::string_view json, size_t& pos, std::string_view& out) {
+    if (pos >= json.size() || json[pos] != '"') {
+        return false;
+    }
+
+    ++pos; // Skip opening quote
+    size_t start = pos;
+    bool hasEscapes = false;
+    while (pos < json.size() && json[pos] != '"') {
+        if (json[pos] == '\\' && pos + 1 < json.size()) {
+            hasEscapes = true;
+            ++pos;
+        }
+        ++pos;
+    }
+    size_t end = pos;
+    if (pos < json.size()) {
+        ++pos; // Skip closing quote
+    }
+
+    if (!hasEscapes) {
+        // Common case: view straight into the caller's buffer
+        out = json.substr(start, end - start);
+        return true;
+    }
+
+    // Unescape into the arena (never longer than the raw token)
+    char* buffer = ArenaAllocateArray<char>(end - start);
+    size_t length = 0;
+    for (size_t i = start; i < end; ++i) {
+        char c = json[i];
+        if (c == '\\' && i + 1 < end) {
+            ++i;
+            switch (json[i]) {
+                case 'n': buffer[length++] = '\n'; break;
+                case 't': buffer[length++] = '\t'; break;
+                case 'r': buffer[length++] = '\r'; break;
+                case '\\': buffer[length++] = '\\'; break;
+                case '"': buffer[length++] = '"'; break;
+                default: buffer[length++] = json[i]; break;
+            }
+        } else {
+            buffer[length++] = c;
+        }
+    }
+    out = std::string_view(buffer, length);
+    return true;
+}
+
+JsonDocument::Node JsonDocument::ParseNumber(std::string_view json, size_t& pos) {
+    size_t start = pos;
+
+    if (json[pos] == '-' || json[pos] == '+') {
+        ++pos;
+    }
+    while (pos < json.size() &&
+           (std::isdigit(static_cast<unsigned char>(json[pos])) || json[pos] == '.')) {
+        ++pos;
+    }
+
+    Node node;
+    node.type = NodeType::Number;
+    std::from_chars(json.data() + start, json.data() + pos, node.numberValue);
+    return node;
+}
+
+JsonDocument::Node JsonDocument::ParseBoolean(std::string_view json, size_t& pos) {
+    Node node;
+    if (json.substr(pos, 4) == "true") {
+        pos += 4;
+        node.type = NodeType::Boolean;
+        node.boolValue = true;
+    } else if (json.substr(pos, 5) == "false") {
+        pos += 5;
+        node.type = NodeType::Boolean;
+        node.boolValue = false;
+    }
+    return node;
+}
+
+JsonDocument::Node JsonDocument::ParseArray(std::string_view json, size_t& pos) {
+    Node array;
+    array.type = NodeType::Array;
+
+    if (json[pos] != '[') {
+        return array;
+    }
+
+    ++pos; // Skip opening bracket
+    SkipWhitespace(json, pos);
+
+    if (pos < json.size() && json[pos] == ']') {
+        ++pos;
+        return array;
+    }
+
+    // Children collect in the shared scratch (nested containers finish
+    // before the parent copies its sibling range into the arena)
+    size_t scratchStart = m_nodeScratch.size();
+    while (pos < json.size()) {
+        m_nodeScratch.push_back(ParseValue(json, pos));
+        SkipWhitespace(json, pos);
+
+        if (pos < json.size() && json[pos] == ',') {
+            ++pos;
+            SkipWhitespace(json, pos);
+        } else if (pos < json.size() && json[pos] == ']') {
+            ++pos;
+            break;
+        }
+    }
+
+    array.itemCount = m_nodeScratch.size() - scratchStart;
+    if (array.itemCount > 0) {
+        array.items = ArenaAllocateArray<Node>(array.itemCount);
+        std::memcpy(array.items, m_nodeScratch.data() + scratchStart,
+                    array.itemCount * sizeof(Node));
+    }
+    m_nodeScratch.resize(scratchStart);
+    return array;
+}
+
+JsonDocument::Node JsonDocument::ParseObject(std::string_view json, size_t& pos) {
+    Node object;
+    object.type = NodeType::Object;
+
+    if (json[pos] != '{') {
+        return object;
+    }
+
+    ++pos; // Skip opening brace
+    SkipWhitespace(json, pos);
+
+    if (pos < json.size() && json[pos] == '}') {
+        ++pos;
+        return object;
+    }
+
+    size_t nodeStart = m_nodeScratch.size();
+    size_t memberStart = m_memberScratch.size();
+    while (pos < json.size()) {
+        std::string_view key;
+        if (!ParseStringToken(json, pos, key)) {
+            break;
+        }
+
+        SkipWhitespace(json, pos);
+        if (pos < json.size() && json[pos] == ':') {
+            ++pos;
+            SkipWhitespace(json, pos);
+        }
+
+        m_nodeScratch.push_back(ParseValue(json, pos));
+        m_memberScratch.push_back(Member{key, nullptr});
+
+        SkipWhitespace(json, pos);
+        if (pos < json.size() && json[pos] == ',') {
+            ++pos;
+            SkipWhitespace(json, pos);
+        } else if (pos < json.size() && json[pos] == '}') {
+            ++pos;
+            break;
+        }
+    }
+
+    object.memberCount = m_memberScratch.size() - memberStart;
+    if (object.memberCount > 0) {
+        Node* values = ArenaAllocateArray<Node>(object.memberCount);
+        std::memcpy(values, m_nodeScratch.data() + nodeStart,
+                    object.memberCount * sizeof(Node));
+        object.members = ArenaAllocateArray<Member>(object.memberCount);
+        for (size_t i = 0; i < object.memberCount; ++i) {
+            object.members[i].key = m_memberScratch[memberStart + i].key;
+            object.members[i].value = values + i;
+        }
+    }
+    m_nodeScratch.resize(nodeStart);
+    m_memberScratch.resize(memberStart);
+    return object;
+}
+
+void JsonDocument::SkipWhitespace(std::string_view json, size_t& pos) {
+    while (pos < json.size() && std::isspace(static_cast<unsigned char>(json[pos]))) {
+        ++pos;
+    }
+}
+
 // JsonUtil implementation
 std::string JsonUtil::SerializeToString(const JsonValue& value, int indent) {
     std::ostringstream oss;
@@ -657,6 +928,271 @@ PlanetaryPreset JsonUtil::DeserializePreset(const JsonValue& value) {
     return preset;
 }
 
+// =============================================================================
+// In-situ deserializers (JsonDocument nodes)
+// =============================================================================
+
+namespace {
+
+// Field assignment helpers for the node-based deserializers. Each preserves
+// the JsonValue deserializer semantics: the target keeps its default unless
+// the member is present and correctly typed.
+void AssignFloat(const JsonDocument::Node& obj, std::string_view key, float& target) {
+    if (const auto* n = obj.Find(key); n && n->type == JsonDocument::NodeType::Number) {
+        target = static_cast<float>(n->numberValue);
+    }
+}
+
+void AssignInt(const JsonDocument::Node& obj, std::string_view key, int& target) {
+    if (const auto* n = obj.Find(key); n && n->type == JsonDocument::NodeType::Number) {
+        target = static_cast<int>(n->numberValue);
+    }
+}
+
+void AssignUInt(const JsonDocument::Node& obj, std::string_view key, uint32_t& target) {
+    if (const auto* n = obj.Find(key); n && n->type == JsonDocument::NodeType::Number) {
+        target = static_cast<uint32_t>(n->numberValue);
+    }
+}
+
+void AssignBool(const JsonDocument::Node& obj, std::string_view key, bool& target) {
+    if (const auto* n = obj.Find(key); n && n->type == JsonDocument::NodeType::Boolean) {
+        target = n->boolValue;
+    }
+}
+
+void AssignString(const JsonDocument::Node& obj, std::string_view key, std::string& target) {
+    if (const auto* n = obj.Find(key); n && n->type == JsonDocument::NodeType::String) {
+        target = std::string(n->stringValue);
+    }
+}
+
+void AssignVec3(const JsonDocument::Node& obj, std::string_view key, vec3& target) {
+    if (const auto* n = obj.Find(key)) {
+        target = JsonUtil::DeserializeVec3(*n);
+    }
+}
+
+} // namespace
+
+vec3 JsonUtil::DeserializeVec3(const JsonDocument::Node& node) {
+    vec3 result(0.0f);
+    if (node.type != JsonDocument::NodeType::Object) {
+        return result;
+    }
+    AssignFloat(node, "x", result.x);
+    AssignFloat(node, "y", result.y);
+    AssignFloat(node, "z", result.z);
+    return result;
+}
+
+NoiseLayerConfig JsonUtil::DeserializeNoiseLayer(const JsonDocument::Node& node) {
+    NoiseLayerConfig layer;
+    if (node.type != JsonDocument::NodeType::Object) {
+        return layer;
+    }
+
+    AssignString(node, "noiseType", layer.noiseType);
+    AssignFloat(node, "scale", layer.scale);
+    AssignFloat(node, "amplitude", layer.amplitude);
+    AssignFloat(node, "frequency", layer.frequency);
+    AssignInt(node, "octaves", layer.octaves);
+    AssignFloat(node, "persistence", layer.persistence);
+    AssignFloat(node, "lacunarity", layer.lacunarity);
+    AssignUInt(node, "seed", layer.seed);
+    AssignVec3(node, "offset", layer.offset);
+
+    if (const auto* extra = node.Find("extraParams");
+        extra && extra->type == JsonDocument::NodeType::Object) {
+        for (size_t i = 0; i < extra->memberCount; ++i) {
+            const auto& member = extra->members[i];
+            if (member.value->type == JsonDocument::NodeType::Number) {
+                layer.extraParams[std::string(member.key)] =
+                    static_cast<float>(member.value->numberValue);
+            }
+        }
+    }
+
+    return layer;
+}
+
+BiomeConfig JsonUtil::DeserializeBiome(const JsonDocument::Node& node) {
+    BiomeConfig biome;
+    if (node.type != JsonDocument::NodeType::Object) {
+        return biome;
+    }
+
+    AssignString(node, "name", biome.name);
+    AssignFloat(node, "elevationMin", biome.elevationMin);
+    AssignFloat(node, "elevationMax", biome.elevationMax);
+    AssignFloat(node, "moistureMin", biome.moistureMin);
+    AssignFloat(node, "moistureMax", biome.moistureMax);
+    AssignFloat(node, "temperatureMin", biome.temperatureMin);
+    AssignFloat(node, "temperatureMax", biome.temperatureMax);
+    AssignVec3(node, "baseColor", biome.baseColor);
+    AssignVec3(node, "slopeColor", biome.slopeColor);
+    AssignFloat(node, "roughness", biome.roughness);
+    AssignFloat(node, "metallic", biome.metallic);
+
+    return biome;
+}
+
+AtmosphereConfig JsonUtil::DeserializeAtmosphere(const JsonDocument::Node& node) {
+    AtmosphereConfig atmosphere;
+    if (node.type != JsonDocument::NodeType::Object) {
+        return atmosphere;
+    }
+
+    AssignBool(node, "enabled", atmosphere.enabled);
+    AssignFloat(node, "density", atmosphere.density);
+    AssignFloat(node, "scaleHeight", atmosphere.scaleHeight);
+    AssignVec3(node, "scatteringCoefficients", atmosphere.scatteringCoefficients);
+    AssignFloat(node, "planetRadius", atmosphere.planetRadius);
+    AssignFloat(node, "atmosphereRadius", atmosphere.atmosphereRadius);
+
+    return atmosphere;
+}
+
+OceanConfig JsonUtil::DeserializeOcean(const JsonDocument::Node& node) {
+    OceanConfig ocean;
+    if (node.type != JsonDocument::NodeType::Object) {
+        return ocean;
+    }
+
+    AssignBool(node, "enabled", ocean.enabled);
+    AssignFloat(node, "level", ocean.level);
+    AssignVec3(node, "shallowColor", ocean.shallowColor);
+    AssignVec3(node, "deepColor", ocean.deepColor);
+    AssignFloat(node, "depthScale", ocean.depthScale);
+    AssignFloat(node, "waveScale", ocean.waveScale);
+    AssignFloat(node, "waveSpeed", ocean.waveSpeed);
+
+    return ocean;
+}
+
+RingSystemConfig JsonUtil::DeserializeRingSystem(const JsonDocument::Node& node) {
+    RingSystemConfig rings;
+    if (node.type != JsonDocument::NodeType::Object) {
+        return rings;
+    }
+
+    AssignBool(node, "enabled", rings.enabled);
+    AssignFloat(node, "innerRadius", rings.innerRadius);
+    AssignFloat(node, "outerRadius", rings.outerRadius);
+    AssignVec3(node, "color", rings.color);
+    AssignFloat(node, "opacity", rings.opacity);
+    AssignFloat(node, "rotation", rings.rotation);
+    AssignVec3(node, "normal", rings.normal);
+
+    return rings;
+}
+
+PhysicsConfig JsonUtil::DeserializePhysics(const JsonDocument::Node& node) {
+    PhysicsConfig physics;
+    if (node.type != JsonDocument::NodeType::Object) {
+        return physics;
+    }
+
+    AssignBool(node, "enabled", physics.enabled);
+
+    // Enabled processors
+    AssignBool(node, "enableGravitationalSettling", physics.enableGravitationalSettling);
+    AssignBool(node, "enableAtmosphericErosion", physics.enableAtmosphericErosion);
+    AssignBool(node, "enableTectonicActivity", physics.enableTectonicActivity);
+    AssignBool(node, "enableAdvancedErosion", physics.enableAdvancedErosion);
+
+    // Simulation parameters
+    AssignUInt(node, "simulationSteps", physics.simulationSteps);
+    AssignFloat(node, "timeStep", physics.timeStep);
+    AssignBool(node, "useGPUAcceleration", physics.useGPUAcceleration);
+
+    // Gravitational settings
+    AssignFloat(node, "settlingStrength", physics.settlingStrength);
+    AssignFloat(node, "minimumStableSlope", physics.minimumStableSlope);
+
+    // Atmospheric settings
+    AssignFloat(node, "atmosphericStrength", physics.atmosphericStrength);
+    AssignFloat(node, "windErosionFactor", physics.windErosionFactor);
+
+    // Tectonic settings
+    AssignFloat(node, "tectonicActivity", physics.tectonicActivity);
+
+    // Processor weights
+    AssignFloat(node, "gravitationalWeight", physics.gravitationalWeight);
+    AssignFloat(node, "atmosphericWeight", physics.atmosphericWeight);
+    AssignFloat(node, "tectonicWeight", physics.tectonicWeight);
+    AssignFloat(node, "erosionWeight", physics.erosionWeight);
+
+    // Celestial body type
+    AssignString(node, "celestialBodyType", physics.celestialBodyType);
+
+    return physics;
+}
+
+PlanetaryPreset JsonUtil::DeserializePreset(const JsonDocument::Node& node) {
+    PlanetaryPreset preset;
+    if (node.type != JsonDocument::NodeType::Object) {
+        return preset;
+    }
+
+    // Basic properties
+    AssignString(node, "name", preset.name);
+    AssignString(node, "category", preset.category);
+    AssignString(node, "description", preset.description);
+
+    // Physical properties
+    AssignFloat(node, "baseRadius", preset.baseRadius);
+    AssignFloat(node, "minElevation", preset.minElevation);
+    AssignFloat(node, "maxElevation", preset.maxElevation);
+    AssignFloat(node, "gravity", preset.gravity);
+    AssignFloat(node, "rotationPeriod", preset.rotationPeriod);
+    AssignFloat(node, "axialTilt", preset.axialTilt);
+    AssignFloat(node, "orbitalPeriod", preset.orbitalPeriod);
+    AssignFloat(node, "atmosphereDensity", preset.atmosphereDensity);
+    AssignBool(node, "hasAtmosphere", preset.hasAtmosphere);
+    AssignBool(node, "hasWater", preset.hasWater);
+    AssignBool(node, "hasClouds", preset.hasClouds);
+
+    // Noise layers
+    if (const auto* layers = node.Find("noiseLayers");
+        layers && layers->type == JsonDocument::NodeType::Array) {
+        preset.noiseLayers.reserve(layers->itemCount);
+        for (size_t i = 0; i < layers->itemCount; ++i) {
+            preset.noiseLayers.push_back(DeserializeNoiseLayer(layers->items[i]));
+        }
+    }
+
+    // Biomes
+    if (const auto* biomes = node.Find("biomes");
+        biomes && biomes->type == JsonDocument::NodeType::Array) {
+        preset.biomes.reserve(biomes->itemCount);
+        for (size_t i = 0; i < biomes->itemCount; ++i) {
+            preset.biomes.push_back(DeserializeBiome(biomes->items[i]));
+        }
+    }
+
+    // Sub-configurations
+    if (const auto* atmosphere = node.Find("atmosphere")) {
+        preset.atmosphere = DeserializeAtmosphere(*atmosphere);
+    }
+    if (const auto* ocean = node.Find("ocean")) {
+        preset.ocean = DeserializeOcean(*ocean);
+    }
+    if (const auto* rings = node.Find("rings")) {
+        preset.rings = DeserializeRingSystem(*rings);
+    }
+    if (const auto* physics = node.Find("physics")) {
+        preset.physics = DeserializePhysics(*physics);
+    }
+
+    // Visual properties
+    AssignVec3(node, "baseColor", preset.baseColor);
+    AssignFloat(node, "roughness", preset.roughness);
+    AssignFloat(node, "metallic", preset.metallic);
+
+    return preset;
+}
+
 // Internal parsing helpers
 JsonUtil::JsonValue JsonUtil::ParseValue(const std::string& json, size_t& pos) {
     SkipWhitespace(json, pos);
@@ -891,17 +1427,23 @@ bool JsonConfigurationSerializer::LoadPresetFromFile(const std::string& filepath
         
         std::string jsonString((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
         file.close();
-        
-        JsonUtil::JsonValue presetJson = JsonUtil::ParseFromString(jsonString);
-        
-        if (!ValidateJsonPreset(presetJson)) {
-            std::cerr << "[JsonConfigurationSerializer] Invalid JSON preset: " << GetValidationErrors(presetJson) << std::endl;
+
+        // Parse in-situ: nodes view into jsonString and the DOM lives in the
+        // document's arena, so no per-token allocations are made
+        JsonDocument document;
+        if (!document.Parse(jsonString)) {
+            std::cerr << "[JsonConfigurationSerializer] Failed to parse JSON preset: " << filepath << std::endl;
             return false;
         }
-        
-        preset = JsonUtil::DeserializePreset(presetJson);
+
+        if (!ValidatePresetDocument(*document.Root())) {
+            std::cerr << "[JsonConfigurationSerializer] Invalid JSON preset: " << filepath << std::endl;
+            return false;
+        }
+
+        preset = JsonUtil::DeserializePreset(*document.Root());
         return true;
-        
+
     } catch (const std::exception& e) {
         std::cerr << "[JsonConfigurationSerializer] Exception loading preset: " << e.what() << std::endl;
         return false;
@@ -949,6 +1491,47 @@ bool JsonConfigurationSerializer::ValidateJsonPreset(const JsonUtil::JsonValue&
     return true;
 }
 
+bool JsonConfigurationSerializer::ValidatePresetDocument(const JsonDocument::Node& root) {
+    if (root.type != JsonDocument::NodeType::Object) {
+        return false;
+    }
+
+    // Check required fields
+    const auto* name = root.Find("name");
+    if (!name || name->type != JsonDocument::NodeType::String) {
+        return false;
+    }
+    const auto* category = root.Find("category");
+    if (!category || category->type != JsonDocument::NodeType::String) {
+        return false;
+    }
+
+    // Validate arrays if present
+    if (const auto* layers = root.Find("noiseLayers")) {
+        if (layers->type != JsonDocument::NodeType::Array) {
+            return false;
+        }
+        for (size_t i = 0; i < layers->itemCount; ++i) {
+            if (layers->items[i].type != JsonDocument::NodeType::Object) {
+                return false;
+            }
+        }
+    }
+
+    if (const auto* biomes = root.Find("biomes")) {
+        if (biomes->type != JsonDocument::NodeType::Array) {
+            return false;
+        }
+        for (size_t i = 0; i < biomes->itemCount; ++i) {
+            if (biomes->items[i].type != JsonDocument::NodeType::Object) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 std::string JsonConfigurationSerializer::GetValidationErrors(const JsonUtil::JsonValue& json) {
     std::ostringstream errors;
     
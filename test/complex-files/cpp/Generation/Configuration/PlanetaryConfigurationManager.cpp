@@ -19,6 +19,346 @@ import JsonConfigurationHelpers;
 
 namespace PlanetGen::Generation::Configuration {
 
+namespace {
+
+// =============================================================================
+// BINARY PRESET CACHE
+// =============================================================================
+// Parsed presets are mirrored to <config dir>/.preset_cache/<stem>.ppb so a
+// warm startup deserializes flat binary records instead of re-parsing JSON.
+// Each cache file is keyed by an FNV-1a hash of the source file contents and
+// is ignored (then rewritten) whenever the source changes.
+
+constexpr uint32_t kPresetCacheMagic = 0x31425050; // "PPB1"
+constexpr uint32_t kPresetCacheVersion = 1;
+constexpr uint32_t kPresetCacheMaxCount = 1u << 20; // Sanity cap for corrupt files
+
+uint64_t HashFileContents(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return 0;
+    }
+
+    constexpr uint64_t kFnvOffset = 1469598103934665603ull;
+    constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+    uint64_t hash = kFnvOffset;
+    char buffer[4096];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+        std::streamsize count = file.gcount();
+        for (std::streamsize i = 0; i < count; ++i) {
+            hash = (hash ^ static_cast<unsigned char>(buffer[i])) * kFnvPrime;
+        }
+        if (count == 0) break;
+    }
+    return hash;
+}
+
+std::string PresetCachePath(const std::string& sourcePath) {
+    std::filesystem::path source(sourcePath);
+    return (source.parent_path() / ".preset_cache" / (source.stem().string() + ".ppb")).string();
+}
+
+struct PresetCacheWriter {
+    std::ofstream out;
+
+    explicit PresetCacheWriter(const std::string& path) : out(path, std::ios::binary) {}
+
+    void WriteRaw(const void* data, size_t size) { out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size)); }
+    void WriteU32(uint32_t value) { WriteRaw(&value, sizeof(value)); }
+    void WriteU64(uint64_t value) { WriteRaw(&value, sizeof(value)); }
+    void WriteI32(int32_t value) { WriteRaw(&value, sizeof(value)); }
+    void WriteF32(float value) { WriteRaw(&value, sizeof(value)); }
+    void WriteBool(bool value) { uint8_t byte = value ? 1 : 0; WriteRaw(&byte, 1); }
+    void WriteString(const std::string& value) {
+        WriteU32(static_cast<uint32_t>(value.size()));
+        WriteRaw(value.data(), value.size());
+    }
+    void WriteVec3(const vec3& value) { WriteF32(value.x); WriteF32(value.y); WriteF32(value.z); }
+};
+
+struct PresetCacheReader {
+    std::ifstream in;
+
+    explicit PresetCacheReader(const std::string& path) : in(path, std::ios::binary) {}
+
+    bool ReadRaw(void* data, size_t size) {
+        in.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+        return in.good();
+    }
+    bool ReadU32(uint32_t& value) { return ReadRaw(&value, sizeof(value)); }
+    bool ReadU64(uint64_t& value) { return ReadRaw(&value, sizeof(value)); }
+    bool ReadI32(int32_t& value) { return ReadRaw(&value, sizeof(value)); }
+    bool ReadF32(float& value) { return ReadRaw(&value, sizeof(value)); }
+    bool ReadBool(bool& value) {
+        uint8_t byte = 0;
+        if (!ReadRaw(&byte, 1)) return false;
+        value = byte != 0;
+        return true;
+    }
+    bool ReadString(std::string& value) {
+        uint32_t size = 0;
+        if (!ReadU32(size) || size > kPresetCacheMaxCount) return false;
+        value.resize(size);
+        return size == 0 || ReadRaw(value.data(), size);
+    }
+    bool ReadVec3(vec3& value) { return ReadF32(value.x) && ReadF32(value.y) && ReadF32(value.z); }
+};
+
+void WriteNoiseLayer(PresetCacheWriter& writer, const NoiseLayerConfig& layer) {
+    writer.WriteString(layer.noiseType);
+    writer.WriteF32(layer.scale);
+    writer.WriteF32(layer.amplitude);
+    writer.WriteF32(layer.frequency);
+    writer.WriteI32(layer.octaves);
+    writer.WriteF32(layer.persistence);
+    writer.WriteF32(layer.lacunarity);
+    writer.WriteU32(layer.seed);
+    writer.WriteVec3(layer.offset);
+    writer.WriteU32(static_cast<uint32_t>(layer.extraParams.size()));
+    for (const auto& [key, value] : layer.extraParams) {
+        writer.WriteString(key);
+        writer.WriteF32(value);
+    }
+}
+
+bool ReadNoiseLayer(PresetCacheReader& reader, NoiseLayerConfig& layer) {
+    uint32_t extraCount = 0;
+    if (!reader.ReadString(layer.noiseType) ||
+        !reader.ReadF32(layer.scale) ||
+        !reader.ReadF32(layer.amplitude) ||
+        !reader.ReadF32(layer.frequency) ||
+        !reader.ReadI32(layer.octaves) ||
+        !reader.ReadF32(layer.persistence) ||
+        !reader.ReadF32(layer.lacunarity) ||
+        !reader.ReadU32(layer.seed) ||
+        !reader.ReadVec3(layer.offset) ||
+        !reader.ReadU32(extraCount) || extraCount > kPresetCacheMaxCount) {
+        return false;
+    }
+    for (uint32_t i = 0; i < extraCount; ++i) {
+        std::string key;
+        float value = 0.0f;
+        if (!reader.ReadString(key) || !reader.ReadF32(value)) return false;
+        layer.extraParams[key] = value;
+    }
+    return true;
+}
+
+void WriteBiome(PresetCacheWriter& writer, const BiomeConfig& biome) {
+    writer.WriteString(biome.name);
+    writer.WriteF32(biome.elevationMin);
+    writer.WriteF32(biome.elevationMax);
+    writer.WriteF32(biome.moistureMin);
+    writer.WriteF32(biome.moistureMax);
+    writer.WriteF32(biome.temperatureMin);
+    writer.WriteF32(biome.temperatureMax);
+    writer.WriteVec3(biome.baseColor);
+    writer.WriteVec3(biome.slopeColor);
+    writer.WriteF32(biome.roughness);
+    writer.WriteF32(biome.metallic);
+}
+
+bool ReadBiome(PresetCacheReader& reader, BiomeConfig& biome) {
+    return reader.ReadString(biome.name) &&
+           reader.ReadF32(biome.elevationMin) &&
+           reader.ReadF32(biome.elevationMax) &&
+           reader.ReadF32(biome.moistureMin) &&
+           reader.ReadF32(biome.moistureMax) &&
+           reader.ReadF32(biome.temperatureMin) &&
+           reader.ReadF32(biome.temperatureMax) &&
+           reader.ReadVec3(biome.baseColor) &&
+           reader.ReadVec3(biome.slopeColor) &&
+           reader.ReadF32(biome.roughness) &&
+           reader.ReadF32(biome.metallic);
+}
+
+void WritePresetBody(PresetCacheWriter& writer, const PlanetaryPreset& preset) {
+    writer.WriteString(preset.name);
+    writer.WriteString(preset.category);
+    writer.WriteString(preset.description);
+
+    writer.WriteF32(preset.baseRadius);
+    writer.WriteF32(preset.minElevation);
+    writer.WriteF32(preset.maxElevation);
+    writer.WriteF32(preset.gravity);
+    writer.WriteF32(preset.rotationPeriod);
+    writer.WriteF32(preset.axialTilt);
+    writer.WriteF32(preset.orbitalPeriod);
+    writer.WriteF32(preset.atmosphereDensity);
+    writer.WriteBool(preset.hasAtmosphere);
+    writer.WriteBool(preset.hasWater);
+    writer.WriteBool(preset.hasClouds);
+
+    writer.WriteU32(static_cast<uint32_t>(preset.noiseLayers.size()));
+    for (const auto& layer : preset.noiseLayers) {
+        WriteNoiseLayer(writer, layer);
+    }
+    writer.WriteU32(static_cast<uint32_t>(preset.biomes.size()));
+    for (const auto& biome : preset.biomes) {
+        WriteBiome(writer, biome);
+    }
+
+    writer.WriteBool(preset.atmosphere.enabled);
+    writer.WriteF32(preset.atmosphere.density);
+    writer.WriteF32(preset.atmosphere.scaleHeight);
+    writer.WriteVec3(preset.atmosphere.scatteringCoefficients);
+    writer.WriteF32(preset.atmosphere.planetRadius);
+    writer.WriteF32(preset.atmosphere.atmosphereRadius);
+
+    writer.WriteBool(preset.ocean.enabled);
+    writer.WriteF32(preset.ocean.level);
+    writer.WriteVec3(preset.ocean.shallowColor);
+    writer.WriteVec3(preset.ocean.deepColor);
+    writer.WriteF32(preset.ocean.depthScale);
+    writer.WriteF32(preset.ocean.waveScale);
+    writer.WriteF32(preset.ocean.waveSpeed);
+
+    writer.WriteBool(preset.rings.enabled);
+    writer.WriteF32(preset.rings.innerRadius);
+    writer.WriteF32(preset.rings.outerRadius);
+    writer.WriteVec3(preset.rings.color);
+    writer.WriteF32(preset.rings.opacity);
+    writer.WriteF32(preset.rings.rotation);
+    writer.WriteVec3(preset.rings.normal);
+
+    writer.WriteBool(preset.physics.enabled);
+    writer.WriteBool(preset.physics.enableGravitationalSettling);
+    writer.WriteBool(preset.physics.enableAtmosphericErosion);
+    writer.WriteBool(preset.physics.enableTectonicActivity);
+    writer.WriteBool(preset.physics.enableAdvancedErosion);
+    writer.WriteU32(preset.physics.simulationSteps);
+    writer.WriteF32(preset.physics.timeStep);
+    writer.WriteBool(preset.physics.useGPUAcceleration);
+    writer.WriteF32(preset.physics.settlingStrength);
+    writer.WriteF32(preset.physics.minimumStableSlope);
+    writer.WriteF32(preset.physics.atmosphericStrength);
+    writer.WriteF32(preset.physics.windErosionFactor);
+    writer.WriteF32(preset.physics.tectonicActivity);
+    writer.WriteF32(preset.physics.gravitationalWeight);
+    writer.WriteF32(preset.physics.atmosphericWeight);
+    writer.WriteF32(preset.physics.tectonicWeight);
+    writer.WriteF32(preset.physics.erosionWeight);
+    writer.WriteString(preset.physics.celestialBodyType);
+
+    writer.WriteVec3(preset.baseColor);
+    writer.WriteF32(preset.roughness);
+    writer.WriteF32(preset.metallic);
+}
+
+bool ReadPresetBody(PresetCacheReader& reader, PlanetaryPreset& preset) {
+    if (!reader.ReadString(preset.name) ||
+        !reader.ReadString(preset.category) ||
+        !reader.ReadString(preset.description) ||
+        !reader.ReadF32(preset.baseRadius) ||
+        !reader.ReadF32(preset.minElevation) ||
+        !reader.ReadF32(preset.maxElevation) ||
+        !reader.ReadF32(preset.gravity) ||
+        !reader.ReadF32(preset.rotationPeriod) ||
+        !reader.ReadF32(preset.axialTilt) ||
+        !reader.ReadF32(preset.orbitalPeriod) ||
+        !reader.ReadF32(preset.atmosphereDensity) ||
+        !reader.ReadBool(preset.hasAtmosphere) ||
+        !reader.ReadBool(preset.hasWater) ||
+        !reader.ReadBool(preset.hasClouds)) {
+        return false;
+    }
+
+    uint32_t layerCount = 0;
+    if (!reader.ReadU32(layerCount) || layerCount > kPresetCacheMaxCount) return false;
+    preset.noiseLayers.resize(layerCount);
+    for (auto& layer : preset.noiseLayers) {
+        if (!ReadNoiseLayer(reader, layer)) return false;
+    }
+
+    uint32_t biomeCount = 0;
+    if (!reader.ReadU32(biomeCount) || biomeCount > kPresetCacheMaxCount) return false;
+    preset.biomes.resize(biomeCount);
+    for (auto& biome : preset.biomes) {
+        if (!ReadBiome(reader, biome)) return false;
+    }
+
+    return reader.ReadBool(preset.atmosphere.enabled) &&
+           reader.ReadF32(preset.atmosphere.density) &&
+           reader.ReadF32(preset.atmosphere.scaleHeight) &&
+           reader.ReadVec3(preset.atmosphere.scatteringCoefficients) &&
+           reader.ReadF32(preset.atmosphere.planetRadius) &&
+           reader.ReadF32(preset.atmosphere.atmosphereRadius) &&
+           reader.ReadBool(preset.ocean.enabled) &&
+           reader.ReadF32(preset.ocean.level) &&
+           reader.ReadVec3(preset.ocean.shallowColor) &&
+           reader.ReadVec3(preset.ocean.deepColor) &&
+           reader.ReadF32(preset.ocean.depthScale) &&
+           reader.ReadF32(preset.ocean.waveScale) &&
+           reader.ReadF32(preset.ocean.waveSpeed) &&
+           reader.ReadBool(preset.rings.enabled) &&
+           reader.ReadF32(preset.rings.innerRadius) &&
+           reader.ReadF32(preset.rings.outerRadius) &&
+           reader.ReadVec3(preset.rings.color) &&
+           reader.ReadF32(preset.rings.opacity) &&
+           reader.ReadF32(preset.rings.rotation) &&
+           reader.ReadVec3(preset.rings.normal) &&
+           reader.ReadBool(preset.physics.enabled) &&
+           reader.ReadBool(preset.physics.enableGravitationalSettling) &&
+           reader.ReadBool(preset.physics.enableAtmosphericErosion) &&
+           reader.ReadBool(preset.physics.enableTectonicActivity) &&
+           reader.ReadBool(preset.physics.enableAdvancedErosion) &&
+           reader.ReadU32(preset.physics.simulationSteps) &&
+           reader.ReadF32(preset.physics.timeStep) &&
+           reader.ReadBool(preset.physics.useGPUAcceleration) &&
+           reader.ReadF32(preset.physics.settlingStrength) &&
+           reader.ReadF32(preset.physics.minimumStableSlope) &&
+           reader.ReadF32(preset.physics.atmosphericStrength) &&
+           reader.ReadF32(preset.physics.windErosionFactor) &&
+           reader.ReadF32(preset.physics.tectonicActivity) &&
+           reader.ReadF32(preset.physics.gravitationalWeight) &&
+           reader.ReadF32(preset.physics.atmosphericWeight) &&
+           reader.ReadF32(preset.physics.tectonicWeight) &&
+           reader.ReadF32(preset.physics.erosionWeight) &&
+           reader.ReadString(preset.physics.celestialBodyType) &&
+           reader.ReadVec3(preset.baseColor) &&
+           reader.ReadF32(preset.roughness) &&
+           reader.ReadF32(preset.metallic);
+}
+
+bool TryLoadCachedPreset(const std::string& cachePath, uint64_t sourceHash, PlanetaryPreset& preset) {
+    PresetCacheReader reader(cachePath);
+    if (!reader.in) {
+        return false;
+    }
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t cachedHash = 0;
+    if (!reader.ReadU32(magic) || magic != kPresetCacheMagic ||
+        !reader.ReadU32(version) || version != kPresetCacheVersion ||
+        !reader.ReadU64(cachedHash) || cachedHash != sourceHash) {
+        return false;
+    }
+
+    return ReadPresetBody(reader, preset);
+}
+
+void WriteCachedPreset(const std::string& cachePath, uint64_t sourceHash, const PlanetaryPreset& preset) {
+    // Best effort: a failed cache write just means the next startup parses JSON
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), ec);
+    if (ec) {
+        return;
+    }
+
+    PresetCacheWriter writer(cachePath);
+    if (!writer.out) {
+        return;
+    }
+    writer.WriteU32(kPresetCacheMagic);
+    writer.WriteU32(kPresetCacheVersion);
+    writer.WriteU64(sourceHash);
+    WritePresetBody(writer, preset);
+}
+
+} // namespace
+
 // Internal implementation class
 class PlanetaryConfigurationManager::Impl {
 public:
@@ -45,19 +385,22 @@ bool PlanetaryConfigurationManager::Initialize(const std::string& configDirector
     // Create JSON configuration source by default
     m_configSource = ConfigurationSourceFactory::CreateJsonSource();
     
-    // Load presets from config directory if it exists
+    // Index presets from the config directory without parsing them: the
+    // file stem is the preset name by convention, and bodies materialize on
+    // first use (via the binary cache when it matches the source hash)
     if (std::filesystem::exists(configDirectory)) {
         auto presetFiles = m_configSource->ListPresets(configDirectory);
         for (const auto& file : presetFiles) {
-            LoadPresetFromFile(file);
+            m_pendingPresetFiles[std::filesystem::path(file).stem().string()] = file;
         }
     }
-    
+
     return true;
 }
 
 void PlanetaryConfigurationManager::Shutdown() {
     m_presets.clear();
+    m_pendingPresetFiles.clear();
     m_types.clear();
     m_instances.clear();
     m_configSource.reset();
@@ -73,6 +416,9 @@ bool PlanetaryConfigurationManager::RegisterPreset(const PlanetaryPreset& preset
 }
 
 bool PlanetaryConfigurationManager::LoadPreset(const std::string& name) {
+    if (m_pendingPresetFiles.find(name) != m_pendingPresetFiles.end()) {
+        MaterializePreset(name);
+    }
     auto it = m_presets.find(name);
     return it != m_presets.end();
 }
@@ -91,6 +437,9 @@ bool PlanetaryConfigurationManager::LoadPresetFromFile(const std::string& path)
 }
 
 bool PlanetaryConfigurationManager::SavePreset(const std::string& name, const std::string& path) {
+    if (m_pendingPresetFiles.find(name) != m_pendingPresetFiles.end()) {
+        MaterializePreset(name);
+    }
     auto it = m_presets.find(name);
     if (it == m_presets.end() || !m_configSource) {
         return false;
@@ -100,6 +449,11 @@ bool PlanetaryConfigurationManager::SavePreset(const std::string& name, const st
 }
 
 std::optional<PlanetaryPreset> PlanetaryConfigurationManager::GetPreset(const std::string& name) const {
+    // A pending file takes precedence over a same-named built-in, matching
+    // the old eager-load order (files were registered after built-ins)
+    if (m_pendingPresetFiles.find(name) != m_pendingPresetFiles.end()) {
+        MaterializePreset(name);
+    }
     auto it = m_presets.find(name);
     if (it != m_presets.end()) {
         return it->second;
@@ -109,14 +463,22 @@ std::optional<PlanetaryPreset> PlanetaryConfigurationManager::GetPreset(const st
 
 std::vector<std::string> PlanetaryConfigurationManager::GetPresetNames() const {
     std::vector<std::string> names;
-    names.reserve(m_presets.size());
+    names.reserve(m_presets.size() + m_pendingPresetFiles.size());
     for (const auto& [name, preset] : m_presets) {
         names.push_back(name);
     }
+    for (const auto& [name, path] : m_pendingPresetFiles) {
+        if (m_presets.find(name) == m_presets.end()) {
+            names.push_back(name);
+        }
+    }
     return names;
 }
 
 std::vector<std::string> PlanetaryConfigurationManager::GetPresetsByCategory(const std::string& category) const {
+    // Category lives in the preset body, so a category scan needs them all
+    MaterializeAllPresets();
+
     std::vector<std::string> names;
     for (const auto& [name, preset] : m_presets) {
         if (preset.category == category) {
@@ -306,11 +668,54 @@ void PlanetaryConfigurationManager::SetConfigurationSource(std::unique_ptr<IConf
 }
 
 void PlanetaryConfigurationManager::SetDefaultPreset(const std::string& name) {
+    if (m_pendingPresetFiles.find(name) != m_pendingPresetFiles.end()) {
+        MaterializePreset(name);
+    }
     if (m_presets.find(name) != m_presets.end()) {
         m_defaultPreset = name;
     }
 }
 
+bool PlanetaryConfigurationManager::MaterializePreset(const std::string& name) const {
+    auto pending = m_pendingPresetFiles.find(name);
+    if (pending == m_pendingPresetFiles.end()) {
+        return false;
+    }
+    const std::string path = pending->second;
+    m_pendingPresetFiles.erase(pending); // One parse attempt per file
+
+    const uint64_t sourceHash = HashFileContents(path);
+
+    PlanetaryPreset preset;
+    bool loaded = false;
+    if (m_binaryCacheEnabled && sourceHash != 0) {
+        loaded = TryLoadCachedPreset(PresetCachePath(path), sourceHash, preset);
+    }
+
+    if (!loaded) {
+        if (!m_configSource || !m_configSource->LoadPreset(path, preset)) {
+            return false;
+        }
+        if (m_binaryCacheEnabled && sourceHash != 0) {
+            WriteCachedPreset(PresetCachePath(path), sourceHash, preset);
+        }
+    }
+
+    if (!ValidatePreset(preset)) {
+        return false;
+    }
+
+    // Registered under the embedded name, as the eager loader did
+    m_presets[preset.name] = preset;
+    return true;
+}
+
+void PlanetaryConfigurationManager::MaterializeAllPresets() const {
+    while (!m_pendingPresetFiles.empty()) {
+        MaterializePreset(m_pendingPresetFiles.begin()->first);
+    }
+}
+
 bool PlanetaryConfigurationManager::ValidatePreset(const PlanetaryPreset& preset) const {
     // Basic validation
     if (preset.name.empty()) {
@@ -1,6 +1,7 @@
 module;
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -46,13 +47,18 @@ IPlanetBuilder& PlanetBuilder::WithConfiguration(const Configuration::PlanetInst
     return *this;
 }
 
+IPlanetBuilder& PlanetBuilder::WithConfiguration(Configuration::PlanetInstanceConfig&& config) {
+    m_config = std::move(config);
+    return *this;
+}
+
 IPlanetBuilder& PlanetBuilder::WithDependencyContainer(IDependencyContainer* container) {
     m_container = container;
     return *this;
 }
 
 IPlanetBuilder& PlanetBuilder::WithComponent(const std::string& type, std::shared_ptr<IPlanetComponent> component) {
-    m_components[type] = component;
+    m_components[type] = std::move(component);
     return *this;
 }
 
@@ -103,9 +109,24 @@ IPlanetBuilder& PlanetBuilder::WithTextureResolution(uint32_t resolution) {
     return *this;
 }
 
-std::unique_ptr<PlanetInstance> PlanetBuilder::Build() {
+std::unique_ptr<PlanetInstance> PlanetBuilder::Build() & {
+    // Lvalue build: copy the payload once so the builder stays reusable.
+    auto config = m_config;
+    auto components = m_components;
+    return AssembleInstance(std::move(config), std::move(components));
+}
+
+std::unique_ptr<PlanetInstance> PlanetBuilder::Build() && {
+    // Rvalue build: hand the builder's state straight to the instance.
+    // Nothing is moved until validation passes inside AssembleInstance,
+    // so a failed build leaves the builder intact.
+    return AssembleInstance(std::move(m_config), std::move(m_components));
+}
+
+std::unique_ptr<PlanetInstance> PlanetBuilder::AssembleInstance(Configuration::PlanetInstanceConfig&& config,
+                                                                std::unordered_map<std::string, std::shared_ptr<IPlanetComponent>>&& components) {
     m_impl->ClearValidationErrors();
-    
+
     if (!Validate()) {
         std::cerr << "[PlanetBuilder] Validation failed:" << std::endl;
         for (const auto& error : m_impl->m_validationErrors) {
@@ -113,32 +134,33 @@ std::unique_ptr<PlanetInstance> PlanetBuilder::Build() {
         }
         return nullptr;
     }
-    
-    // Create planet instance
-    auto planet = std::make_unique<PlanetInstance>(m_config, m_container);
-    
-    // Create and add components based on specifications
+
+    // Create missing components directly in the outgoing map - no staging copy
     for (const auto& [componentName, componentType] : m_componentTypes) {
-        CreateComponentFromType(componentName, componentType);
+        CreateComponentFromType(componentName, componentType, components);
     }
-    
-    // Add all created components to the planet
-    for (const auto& [type, component] : m_components) {
-        planet->AddComponent(type, component);
+
+    // Create planet instance; the configuration moves in without a copy
+    auto planet = std::make_unique<PlanetInstance>(std::move(config), m_container);
+
+    // Move each component handle into the planet
+    for (auto& [type, component] : components) {
+        planet->AddComponent(type, std::move(component));
     }
-    
+    components.clear();
+
     // Apply configuration to components
     ApplyConfigurationToComponents();
-    
+
     // Initialize the planet
     if (!planet->Initialize()) {
         std::cerr << "[PlanetBuilder] Failed to initialize planet instance" << std::endl;
         return nullptr;
     }
-    
+
     // Apply quality settings
     planet->SetLODEnabled(m_lodLevels > 1);
-    
+
     return planet;
 }
 
@@ -197,15 +219,16 @@ void PlanetBuilder::Reset() {
     m_impl->ClearValidationErrors();
 }
 
-void PlanetBuilder::CreateComponentFromType(const std::string& componentName, const std::string& componentType) {
-    if (m_components.find(componentName) != m_components.end()) {
+void PlanetBuilder::CreateComponentFromType(const std::string& componentName, const std::string& componentType,
+                                            std::unordered_map<std::string, std::shared_ptr<IPlanetComponent>>& components) {
+    if (components.find(componentName) != components.end()) {
         // Component already exists, don't overwrite
         return;
     }
-    
+
     auto component = CreateComponent(componentType);
     if (component) {
-        m_components[componentName] = component;
+        components[componentName] = std::move(component);
     } else {
         std::cerr << "[PlanetBuilder] Failed to create component: " << componentName << " of type: " << componentType << std::endl;
     }
@@ -257,30 +280,36 @@ std::unique_ptr<PlanetInstance> PresetPlanetBuilder::BuildFromPreset(const std::
         return nullptr;
     }
     
-    auto instanceConfig = CreateInstanceConfig(presetName);
+    auto instanceConfig = GetCachedInstanceConfig(presetName);
     ApplyOverridesToConfig(instanceConfig);
     
-    // Create builder and configure it
+    // Record which components the preset wants before the config is moved
+    const bool wantsAtmosphere = instanceConfig.atmosphere.enabled;
+    const bool wantsOcean = instanceConfig.ocean.enabled;
+    const bool wantsRings = instanceConfig.rings.enabled;
+
+    // Create builder and configure it; the config moves in without a copy
     PlanetBuilder builder(m_container, m_componentFactory);
-    builder.WithConfiguration(instanceConfig)
+    builder.WithConfiguration(std::move(instanceConfig))
            .WithLODLevels(m_lodLevels)
            .WithTextureResolution(m_textureResolution)
            .WithTerrain("default");
-    
+
     // Add components based on preset configuration
-    if (instanceConfig.atmosphere.enabled) {
+    if (wantsAtmosphere) {
         builder.WithAtmosphere("default");
     }
-    
-    if (instanceConfig.ocean.enabled) {
+
+    if (wantsOcean) {
         builder.WithOcean("default");
     }
-    
-    if (instanceConfig.rings.enabled) {
+
+    if (wantsRings) {
         builder.WithRings("default");
     }
-    
-    return builder.Build();
+
+    // Consume the local builder so its state moves into the instance
+    return std::move(builder).Build();
 }
 
 std::unique_ptr<PlanetInstance> PresetPlanetBuilder::BuildFromType(const std::string& typeName,
@@ -303,28 +332,34 @@ std::unique_ptr<PlanetInstance> PresetPlanetBuilder::BuildFromType(const std::st
     m_overrides = combinedOverrides;
     ApplyOverridesToConfig(instanceConfig);
     m_overrides = originalOverrides;
-    
-    // Create builder and configure it
+
+    // Record which components the type wants before the config is moved
+    const bool wantsAtmosphere = instanceConfig.atmosphere.enabled;
+    const bool wantsOcean = instanceConfig.ocean.enabled;
+    const bool wantsRings = instanceConfig.rings.enabled;
+
+    // Create builder and configure it; the config moves in without a copy
     PlanetBuilder builder(m_container, m_componentFactory);
-    builder.WithConfiguration(instanceConfig)
+    builder.WithConfiguration(std::move(instanceConfig))
            .WithLODLevels(m_lodLevels)
            .WithTextureResolution(m_textureResolution)
            .WithTerrain("default");
-    
+
     // Add components based on configuration
-    if (instanceConfig.atmosphere.enabled) {
+    if (wantsAtmosphere) {
         builder.WithAtmosphere("default");
     }
-    
-    if (instanceConfig.ocean.enabled) {
+
+    if (wantsOcean) {
         builder.WithOcean("default");
     }
-    
-    if (instanceConfig.rings.enabled) {
+
+    if (wantsRings) {
         builder.WithRings("default");
     }
-    
-    return builder.Build();
+
+    // Consume the local builder so its state moves into the instance
+    return std::move(builder).Build();
 }
 
 PresetPlanetBuilder& PresetPlanetBuilder::WithOverrides(const std::unordered_map<std::string, std::variant<float, vec3, std::string>>& overrides) {
@@ -367,6 +402,27 @@ std::vector<std::string> PresetPlanetBuilder::GetValidationErrors(const std::str
     return errors;
 }
 
+void PresetPlanetBuilder::PrewarmPreset(const std::string& presetName) {
+    if (!ValidatePreset(presetName)) {
+        std::cerr << "[PresetPlanetBuilder] Cannot prewarm unknown preset: " << presetName << std::endl;
+        return;
+    }
+
+    GetCachedInstanceConfig(presetName);
+}
+
+Configuration::PlanetInstanceConfig PresetPlanetBuilder::GetCachedInstanceConfig(const std::string& presetName) const {
+    std::lock_guard<std::mutex> lock(m_configCacheMutex);
+
+    if (auto it = m_configCache.find(presetName); it != m_configCache.end()) {
+        return it->second;
+    }
+
+    auto instanceConfig = CreateInstanceConfig(presetName);
+    m_configCache.emplace(presetName, instanceConfig);
+    return instanceConfig;
+}
+
 Configuration::PlanetInstanceConfig PresetPlanetBuilder::CreateInstanceConfig(const std::string& presetName) const {
     Configuration::PlanetInstanceConfig instanceConfig;
     
@@ -444,68 +500,68 @@ std::unique_ptr<PresetPlanetBuilder> BuilderFactory::CreatePresetBuilder(Configu
 }
 
 std::unique_ptr<PlanetInstance> BuilderFactory::CreateEarthLikePlanet() {
-    auto config = CreateEarthLikeTemplate();
+    auto config = GetTemplateConfig("earth_like");
     
     auto builder = CreateBuilder();
-    return builder->WithConfiguration(config)
+    return std::move(builder->WithConfiguration(std::move(config))
                   .WithTerrain("default")
                   .WithAtmosphere("default")
                   .WithOcean("default")
                   .WithLODLevels(4)
                   .WithTextureResolution(PlanetGen::Core::Parameters::ParameterSystemAdapter::Get<uint32_t>(
-                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION))
+                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION)))
                   .Build();
 }
 
 std::unique_ptr<PlanetInstance> BuilderFactory::CreateMarsLikePlanet() {
-    auto config = CreateMarsLikeTemplate();
+    auto config = GetTemplateConfig("mars_like");
     
     auto builder = CreateBuilder();
-    return builder->WithConfiguration(config)
+    return std::move(builder->WithConfiguration(std::move(config))
                   .WithTerrain("default")
                   .WithAtmosphere("thin")
                   .WithLODLevels(4)
                   .WithTextureResolution(PlanetGen::Core::Parameters::ParameterSystemAdapter::Get<uint32_t>(
-                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION))
+                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION)))
                   .Build();
 }
 
 std::unique_ptr<PlanetInstance> BuilderFactory::CreateGasGiant() {
-    auto config = CreateGasGiantTemplate();
+    auto config = GetTemplateConfig("gas_giant");
     
     auto builder = CreateBuilder();
-    return builder->WithConfiguration(config)
+    return std::move(builder->WithConfiguration(std::move(config))
                   .WithAtmosphere("thick")
                   .WithRings("default")
                   .WithLODLevels(3)
                   .WithTextureResolution(PlanetGen::Core::Parameters::ParameterSystemAdapter::Get<uint32_t>(
-                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION) / 2)
+                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION) / 2))
                   .Build();
 }
 
 std::unique_ptr<PlanetInstance> BuilderFactory::CreateRockyMoon() {
-    auto config = CreateRockyMoonTemplate();
+    auto config = GetTemplateConfig("rocky_moon");
     
     auto builder = CreateBuilder();
-    return builder->WithConfiguration(config)
+    return std::move(builder->WithConfiguration(std::move(config))
                   .WithTerrain("rocky")
                   .WithLODLevels(3)
                   .WithTextureResolution(PlanetGen::Core::Parameters::ParameterSystemAdapter::Get<uint32_t>(
-                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION) / 2)
+                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION) / 2))
                   .Build();
 }
 
 std::unique_ptr<PlanetInstance> BuilderFactory::CreateIceWorld() {
-    auto config = CreateIceWorldTemplate();
+    auto config = GetTemplateConfig("ice_world");
     
     auto builder = CreateBuilder();
-    return builder->WithConfiguration(config)
+    return std::move(builder->WithConfiguration(std::move(config))
                   .WithTerrain("icy")
                   .WithAtmosphere("thin")
                   .WithOcean("frozen")
                   .WithLODLevels(4)
                   .WithTextureResolution(PlanetGen::Core::Parameters::ParameterSystemAdapter::Get<uint32_t>(
-                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION))
+                      PlanetGen::Core::Parameters::PlanetParams::TEXTURE_RESOLUTION)))
                   .Build();
 }
 
@@ -526,6 +582,36 @@ std::unique_ptr<PlanetInstance> BuilderFactory::CreateFromTemplate(const std::st
     return nullptr;
 }
 
+void BuilderFactory::PrewarmTemplates() {
+    for (const auto& templateName : {"earth_like", "mars_like", "gas_giant", "rocky_moon", "ice_world"}) {
+        GetTemplateConfig(templateName);
+    }
+}
+
+Configuration::PlanetInstanceConfig BuilderFactory::GetTemplateConfig(const std::string& templateName) {
+    std::lock_guard<std::mutex> lock(m_templateCacheMutex);
+
+    if (auto it = m_templateCache.find(templateName); it != m_templateCache.end()) {
+        return it->second;
+    }
+
+    Configuration::PlanetInstanceConfig config;
+    if (templateName == "earth_like") {
+        config = CreateEarthLikeTemplate();
+    } else if (templateName == "mars_like") {
+        config = CreateMarsLikeTemplate();
+    } else if (templateName == "gas_giant") {
+        config = CreateGasGiantTemplate();
+    } else if (templateName == "rocky_moon") {
+        config = CreateRockyMoonTemplate();
+    } else if (templateName == "ice_world") {
+        config = CreateIceWorldTemplate();
+    }
+
+    m_templateCache.emplace(templateName, config);
+    return config;
+}
+
 Configuration::PlanetInstanceConfig BuilderFactory::CreateEarthLikeTemplate() {
     Configuration::PlanetInstanceConfig config;
     config.name = "earth_like_template";
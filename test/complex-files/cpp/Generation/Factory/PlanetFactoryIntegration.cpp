@@ -1,7 +1,10 @@
 module;
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <iostream>
 #include <algorithm>
@@ -17,6 +20,19 @@ import Core.Parameters.PlanetParams;
 
 namespace PlanetGen::Generation::Factory {
 
+// Static member definitions
+std::unordered_map<std::string, std::shared_ptr<PlanetFactoryIntegration>> PlanetFactoryIntegration::s_sharedStacks;
+std::mutex PlanetFactoryIntegration::s_sharedStacksMutex;
+
+namespace {
+
+std::string MakeStackKey(void* vulkanRenderSystem, const void* configManager) {
+    return std::to_string(reinterpret_cast<std::uintptr_t>(vulkanRenderSystem)) + ":" +
+           std::to_string(reinterpret_cast<std::uintptr_t>(configManager));
+}
+
+} // namespace
+
 // PlanetFactoryIntegration implementation
 PlanetFactoryIntegration::PlanetFactoryIntegration() = default;
 
@@ -71,13 +87,60 @@ bool PlanetFactoryIntegration::Initialize(void* vulkanRenderSystem,
     return true;
 }
 
+std::shared_ptr<PlanetFactoryIntegration> PlanetFactoryIntegration::AcquireShared(void* vulkanRenderSystem,
+                                                                                 std::shared_ptr<Configuration::PlanetaryConfigurationManager> configManager) {
+    if (!vulkanRenderSystem || !configManager) {
+        std::cerr << "[PlanetFactoryIntegration] Invalid parameters provided" << std::endl;
+        return nullptr;
+    }
+
+    const auto key = MakeStackKey(vulkanRenderSystem, configManager.get());
+
+    std::lock_guard<std::mutex> lock(s_sharedStacksMutex);
+
+    if (auto it = s_sharedStacks.find(key); it != s_sharedStacks.end()) {
+        return it->second;
+    }
+
+    auto integration = std::make_shared<PlanetFactoryIntegration>();
+    if (!integration->Initialize(vulkanRenderSystem, configManager)) {
+        return nullptr;
+    }
+
+    integration->WarmUp();
+    s_sharedStacks.emplace(key, integration);
+    return integration;
+}
+
+void PlanetFactoryIntegration::ClearSharedCache() {
+    std::lock_guard<std::mutex> lock(s_sharedStacksMutex);
+    s_sharedStacks.clear();
+}
+
+void PlanetFactoryIntegration::WarmUp() {
+    if (!m_initialized) {
+        return;
+    }
+
+    if (m_builderFactory) {
+        m_builderFactory->PrewarmTemplates();
+    }
+
+    if (auto* presetBuilder = GetPresetBuilder()) {
+        for (const auto& presetName : GetAvailablePresets()) {
+            presetBuilder->PrewarmPreset(presetName);
+        }
+    }
+}
+
 void PlanetFactoryIntegration::Shutdown() {
     if (!m_initialized) {
         return;
     }
-    
+
+    m_presetBuilder.reset();
     m_builderFactory.reset();
-    
+
     if (m_factory) {
         m_factory->Shutdown();
         m_factory.reset();
@@ -101,10 +164,11 @@ std::unique_ptr<PlanetInstance> PlanetFactoryIntegration::CreatePlanetFromPreset
         return nullptr;
     }
     
-    auto presetBuilder = std::make_unique<PresetPlanetBuilder>(m_container.get(), 
-                                                               m_componentFactory.get(), 
-                                                               m_configManager.get());
-    
+    auto* presetBuilder = GetPresetBuilder();
+    if (!presetBuilder) {
+        return nullptr;
+    }
+
     return presetBuilder->WithQualitySettings(m_defaultLODLevels, m_defaultTextureResolution)
                          .BuildFromPreset(presetName);
 }
@@ -203,6 +267,16 @@ void PlanetFactoryIntegration::RegisterDefaultComponents() {
     // TODO: Register additional custom components if needed
 }
 
+PresetPlanetBuilder* PlanetFactoryIntegration::GetPresetBuilder() {
+    if (!m_presetBuilder) {
+        m_presetBuilder = std::make_unique<PresetPlanetBuilder>(m_container.get(),
+                                                                m_componentFactory.get(),
+                                                                m_configManager.get());
+    }
+
+    return m_presetBuilder.get();
+}
+
 bool PlanetFactoryIntegration::ValidateSetup() const {
     if (!m_container || !m_componentFactory || !m_factory) {
         return false;
@@ -228,13 +302,13 @@ SimplePlanetFactory::~SimplePlanetFactory() = default;
 
 bool SimplePlanetFactory::QuickSetup(void* vulkanRenderSystem, 
                                      std::shared_ptr<Configuration::PlanetaryConfigurationManager> configManager) {
-    m_integration = std::make_unique<PlanetFactoryIntegration>();
-    
-    if (!m_integration->Initialize(vulkanRenderSystem, configManager)) {
-        m_integration.reset();
+    // Reuse a warm stack when one exists for this render system and
+    // configuration manager; cold setup only happens on the first request
+    m_integration = PlanetFactoryIntegration::AcquireShared(vulkanRenderSystem, configManager);
+    if (!m_integration) {
         return false;
     }
-    
+
     // Set reasonable default quality
     SetQuality("medium");
     
@@ -320,9 +394,9 @@ std::unique_ptr<PlanetInstance> SimplePlanetFactory::CreateCustomPlanet(const st
     }
     
     ApplyQualitySettings(*static_cast<PlanetBuilder*>(builder.get()));
-    
-    return builder->WithConfiguration(config)
-                  .WithTerrain("default")
+
+    return std::move(builder->WithConfiguration(std::move(config))
+                  .WithTerrain("default"))
                   .Build();
 }
 
@@ -431,8 +505,8 @@ std::unique_ptr<PlanetInstance> CreatePlanetFromLegacy(const LegacyPlanetData& l
         return nullptr;
     }
     
-    return builder->WithConfiguration(config)
-                  .WithTerrain("default")
+    return std::move(builder->WithConfiguration(std::move(config))
+                  .WithTerrain("default"))
                   .Build();
 }
 
@@ -12,6 +12,7 @@ module;
 #include <fstream>
 #include <mutex>
 #include <variant>
+#include <Core/Memory/ObjectPool.h>
 
 module PlanetTypeFactory;
 
@@ -85,6 +86,12 @@ PlanetInstance::PlanetInstance(const Configuration::PlanetInstanceConfig& config
     , m_container(container) {
 }
 
+PlanetInstance::PlanetInstance(Configuration::PlanetInstanceConfig&& config, IDependencyContainer* container)
+    : m_impl(std::make_unique<Impl>())
+    , m_config(std::move(config))
+    , m_container(container) {
+}
+
 PlanetInstance::~PlanetInstance() {
     Shutdown();
 }
@@ -154,7 +161,7 @@ void PlanetInstance::Shutdown() {
 
 void PlanetInstance::AddComponent(const std::string& type, std::shared_ptr<IPlanetComponent> component) {
     std::lock_guard<std::mutex> lock(m_impl->m_componentMutex);
-    m_components[type] = component;
+    m_components[type] = std::move(component);
     
     // Recompute initialization order
     m_impl->DetermineInitializationOrder(m_components);
@@ -343,10 +350,143 @@ std::vector<std::string> DefaultDependencyContainer::GetMissingRegistrations() c
     return missing;
 }
 
+// Default component implementations, pooled by DefaultComponentFactory.
+// Each type implements Reset() to drop per-instance state before its memory
+// is handed back to the pool. These are stub components for now and will be
+// replaced with actual implementations as they're developed.
+namespace {
+
+class StubTerrainComponent : public ITerrainComponent {
+public:
+    bool Initialize(const Configuration::PlanetInstanceConfig& config, IDependencyContainer* container) override {
+        return true;
+    }
+    void Update(float deltaTime) override {}
+    void Render(void* renderContext) override {}
+    void Shutdown() override {}
+    bool IsReady() const override { return true; }
+    void OnResourcesChanged() override {}
+    size_t GetMemoryUsage() const override { return 0; }
+    std::vector<std::string> GetDependencies() const override { return {}; }
+    std::string GetComponentType() const override { return "terrain"; }
+
+    // ITerrainComponent specific methods
+    void RegenerateHeightmap() override {}
+    void UpdateLOD(const vec3& viewerPosition, float viewDistance) override {}
+    void* GetTerrainMesh() const override { return nullptr; }
+    float GetHeightAt(const vec3& position) const override { return 0.0f; }
+    vec3 GetNormalAt(const vec3& position) const override { return vec3(0.0f, 1.0f, 0.0f); }
+    void SetTessellationLevel(float level) override {}
+
+    // Pool recycle protocol - stubs hold no per-instance state yet
+    void Reset() {}
+};
+
+class StubAtmosphereComponent : public IAtmosphereComponent {
+public:
+    bool Initialize(const Configuration::PlanetInstanceConfig& config, IDependencyContainer* container) override {
+        return true;
+    }
+    void Update(float deltaTime) override {}
+    void Render(void* renderContext) override {}
+    void Shutdown() override {}
+    bool IsReady() const override { return true; }
+    void OnResourcesChanged() override {}
+    size_t GetMemoryUsage() const override { return 0; }
+    std::vector<std::string> GetDependencies() const override { return {"terrain"}; }
+    std::string GetComponentType() const override { return "atmosphere"; }
+
+    // IAtmosphereComponent specific methods
+    void UpdateAtmosphereParameters(const Configuration::AtmosphereConfig& config) override {}
+    vec3 GetScatteringColor(const vec3& viewDirection, const vec3& lightDirection) const override {
+        return vec3(0.5f, 0.7f, 1.0f);
+    }
+    float GetAtmosphereDensityAt(float altitude) const override { return 1.0f; }
+
+    void Reset() {}
+};
+
+class StubOceanComponent : public IOceanComponent {
+public:
+    bool Initialize(const Configuration::PlanetInstanceConfig& config, IDependencyContainer* container) override {
+        return true;
+    }
+    void Update(float deltaTime) override {}
+    void Render(void* renderContext) override {}
+    void Shutdown() override {}
+    bool IsReady() const override { return true; }
+    void OnResourcesChanged() override {}
+    size_t GetMemoryUsage() const override { return 0; }
+    std::vector<std::string> GetDependencies() const override { return {"terrain"}; }
+    std::string GetComponentType() const override { return "ocean"; }
+
+    // IOceanComponent specific methods
+    void UpdateOceanParameters(const Configuration::OceanConfig& config) override {}
+    void SimulateWaves(float time, float windSpeed, const vec3& windDirection) override {}
+    float GetWaveHeightAt(const vec2& position, float time) const override { return 0.0f; }
+    void* GetOceanMesh() const override { return nullptr; }
+
+    void Reset() {}
+};
+
+class StubRingSystemComponent : public IRingSystemComponent {
+public:
+    bool Initialize(const Configuration::PlanetInstanceConfig& config, IDependencyContainer* container) override {
+        return true;
+    }
+    void Update(float deltaTime) override {}
+    void Render(void* renderContext) override {}
+    void Shutdown() override {}
+    bool IsReady() const override { return true; }
+    void OnResourcesChanged() override {}
+    size_t GetMemoryUsage() const override { return 0; }
+    std::vector<std::string> GetDependencies() const override { return {}; }
+    std::string GetComponentType() const override { return "rings"; }
+
+    // IRingSystemComponent specific methods
+    void UpdateRingParameters(const Configuration::RingSystemConfig& config) override {}
+    void SetRingRotation(float rotation) override {}
+    void* GetRingMesh() const override { return nullptr; }
+
+    void Reset() {}
+};
+
+// Hand out a pooled component as a shared_ptr whose deleter resets the
+// instance and returns its memory to the pool. The deleter keeps the pool
+// alive, so components may outlive the factory that created them.
+template<typename T>
+std::shared_ptr<IPlanetComponent> AcquireFromPool(
+    const std::shared_ptr<Core::Memory::ObjectPool<T>>& pool) {
+    T* component = pool->Create();
+    if (!component) {
+        // Pool could not grow; fall back to a plain heap allocation
+        return std::make_shared<T>();
+    }
+    return std::shared_ptr<IPlanetComponent>(component, [pool](IPlanetComponent* ptr) {
+        auto* typed = static_cast<T*>(ptr);
+        typed->Reset();
+        pool->Destroy(typed);
+    });
+}
+
+} // namespace
+
 // DefaultComponentFactory::Impl
 class DefaultComponentFactory::Impl {
 public:
     std::unordered_map<std::string, std::function<std::shared_ptr<IPlanetComponent>()>> m_factories;
+
+    // Pools for the default component types; variation sweeps churn through
+    // thousands of instances, so their memory is recycled instead of
+    // reallocated
+    std::shared_ptr<Core::Memory::ObjectPool<StubTerrainComponent>> m_terrainPool =
+        std::make_shared<Core::Memory::ObjectPool<StubTerrainComponent>>();
+    std::shared_ptr<Core::Memory::ObjectPool<StubAtmosphereComponent>> m_atmospherePool =
+        std::make_shared<Core::Memory::ObjectPool<StubAtmosphereComponent>>();
+    std::shared_ptr<Core::Memory::ObjectPool<StubOceanComponent>> m_oceanPool =
+        std::make_shared<Core::Memory::ObjectPool<StubOceanComponent>>();
+    std::shared_ptr<Core::Memory::ObjectPool<StubRingSystemComponent>> m_ringPool =
+        std::make_shared<Core::Memory::ObjectPool<StubRingSystemComponent>>();
 };
 
 // DefaultComponentFactory implementation
@@ -387,119 +527,37 @@ void DefaultComponentFactory::UnregisterComponentType(const std::string& type) {
 }
 
 void DefaultComponentFactory::RegisterDefaultComponents() {
-    // Register default planet component types
-    // For now, we'll register placeholder factories that create stub components
-    // These will be replaced with actual implementations as they're developed
-    
-    // Terrain component
-    RegisterComponentType("terrain", []() -> std::shared_ptr<IPlanetComponent> {
-        // Stub terrain component for now
-        class StubTerrainComponent : public ITerrainComponent {
-        public:
-            bool Initialize(const Configuration::PlanetInstanceConfig& config, IDependencyContainer* container) override {
-                return true;
-            }
-            void Update(float deltaTime) override {}
-            void Render(void* renderContext) override {}
-            void Shutdown() override {}
-            bool IsReady() const override { return true; }
-            void OnResourcesChanged() override {}
-            size_t GetMemoryUsage() const override { return 0; }
-            std::vector<std::string> GetDependencies() const override { return {}; }
-            std::string GetComponentType() const override { return "terrain"; }
-            
-            // ITerrainComponent specific methods
-            void RegenerateHeightmap() override {}
-            void UpdateLOD(const vec3& viewerPosition, float viewDistance) override {}
-            void* GetTerrainMesh() const override { return nullptr; }
-            float GetHeightAt(const vec3& position) const override { return 0.0f; }
-            vec3 GetNormalAt(const vec3& position) const override { return vec3(0.0f, 1.0f, 0.0f); }
-            void SetTessellationLevel(float level) override {}
-        };
-        return std::make_shared<StubTerrainComponent>();
+    // Register default planet component types. Instances come out of the
+    // per-type pools and are recycled via Reset() when released.
+
+    RegisterComponentType("terrain", [pool = m_impl->m_terrainPool]() {
+        return AcquireFromPool(pool);
     });
-    
-    // Atmosphere component  
-    RegisterComponentType("atmosphere", []() -> std::shared_ptr<IPlanetComponent> {
-        // Stub atmosphere component for now
-        class StubAtmosphereComponent : public IAtmosphereComponent {
-        public:
-            bool Initialize(const Configuration::PlanetInstanceConfig& config, IDependencyContainer* container) override {
-                return true;
-            }
-            void Update(float deltaTime) override {}
-            void Render(void* renderContext) override {}
-            void Shutdown() override {}
-            bool IsReady() const override { return true; }
-            void OnResourcesChanged() override {}
-            size_t GetMemoryUsage() const override { return 0; }
-            std::vector<std::string> GetDependencies() const override { return {"terrain"}; }
-            std::string GetComponentType() const override { return "atmosphere"; }
-            
-            // IAtmosphereComponent specific methods
-            void UpdateAtmosphereParameters(const Configuration::AtmosphereConfig& config) override {}
-            vec3 GetScatteringColor(const vec3& viewDirection, const vec3& lightDirection) const override { 
-                return vec3(0.5f, 0.7f, 1.0f); 
-            }
-            float GetAtmosphereDensityAt(float altitude) const override { return 1.0f; }
-        };
-        return std::make_shared<StubAtmosphereComponent>();
+
+    RegisterComponentType("atmosphere", [pool = m_impl->m_atmospherePool]() {
+        return AcquireFromPool(pool);
     });
-    
-    // Ocean component
-    RegisterComponentType("ocean", []() -> std::shared_ptr<IPlanetComponent> {
-        // Stub ocean component for now
-        class StubOceanComponent : public IOceanComponent {
-        public:
-            bool Initialize(const Configuration::PlanetInstanceConfig& config, IDependencyContainer* container) override {
-                return true;
-            }
-            void Update(float deltaTime) override {}
-            void Render(void* renderContext) override {}
-            void Shutdown() override {}
-            bool IsReady() const override { return true; }
-            void OnResourcesChanged() override {}
-            size_t GetMemoryUsage() const override { return 0; }
-            std::vector<std::string> GetDependencies() const override { return {"terrain"}; }
-            std::string GetComponentType() const override { return "ocean"; }
-            
-            // IOceanComponent specific methods
-            void UpdateOceanParameters(const Configuration::OceanConfig& config) override {}
-            void SimulateWaves(float time, float windSpeed, const vec3& windDirection) override {}
-            float GetWaveHeightAt(const vec2& position, float time) const override { return 0.0f; }
-            void* GetOceanMesh() const override { return nullptr; }
-        };
-        return std::make_shared<StubOceanComponent>();
+
+    RegisterComponentType("ocean", [pool = m_impl->m_oceanPool]() {
+        return AcquireFromPool(pool);
     });
-    
-    // Ring system component
-    RegisterComponentType("rings", []() -> std::shared_ptr<IPlanetComponent> {
-        // Stub ring system component for now
-        class StubRingSystemComponent : public IRingSystemComponent {
-        public:
-            bool Initialize(const Configuration::PlanetInstanceConfig& config, IDependencyContainer* container) override {
-                return true;
-            }
-            void Update(float deltaTime) override {}
-            void Render(void* renderContext) override {}
-            void Shutdown() override {}
-            bool IsReady() const override { return true; }
-            void OnResourcesChanged() override {}
-            size_t GetMemoryUsage() const override { return 0; }
-            std::vector<std::string> GetDependencies() const override { return {}; }
-            std::string GetComponentType() const override { return "rings"; }
-            
-            // IRingSystemComponent specific methods
-            void UpdateRingParameters(const Configuration::RingSystemConfig& config) override {}
-            void SetRingRotation(float rotation) override {}
-            void* GetRingMesh() const override { return nullptr; }
-        };
-        return std::make_shared<StubRingSystemComponent>();
+
+    RegisterComponentType("rings", [pool = m_impl->m_ringPool]() {
+        return AcquireFromPool(pool);
     });
-    
+
     std::cout << "[DefaultComponentFactory] Registered " << m_impl->m_factories.size() << " default component types" << std::endl;
 }
 
+std::unordered_map<std::string, ComponentPoolStats> DefaultComponentFactory::GetPoolStatistics() const {
+    std::unordered_map<std::string, ComponentPoolStats> stats;
+    stats["terrain"] = {m_impl->m_terrainPool->GetCapacity(), m_impl->m_terrainPool->GetAllocatedCount()};
+    stats["atmosphere"] = {m_impl->m_atmospherePool->GetCapacity(), m_impl->m_atmospherePool->GetAllocatedCount()};
+    stats["ocean"] = {m_impl->m_oceanPool->GetCapacity(), m_impl->m_oceanPool->GetAllocatedCount()};
+    stats["rings"] = {m_impl->m_ringPool->GetCapacity(), m_impl->m_ringPool->GetAllocatedCount()};
+    return stats;
+}
+
 // PlanetTypeFactory::Impl
 class PlanetTypeFactory::Impl {
 public:
@@ -572,7 +630,7 @@ std::unique_ptr<IPlanetBuilder> PlanetTypeFactory::CreateBuilderForPreset(const
         Configuration::PlanetInstanceConfig instanceConfig;
         // Convert preset to instance config
         // TODO: Implement conversion logic
-        builder->WithConfiguration(instanceConfig);
+        builder->WithConfiguration(std::move(instanceConfig));
     }
     
     return builder;
@@ -673,6 +731,13 @@ void PlanetTypeFactory::ResetStatistics() {
     m_statistics = FactoryStatistics{};
 }
 
+std::unordered_map<std::string, ComponentPoolStats> PlanetTypeFactory::GetComponentPoolStatistics() const {
+    if (auto pooling = std::dynamic_pointer_cast<DefaultComponentFactory>(m_componentFactory)) {
+        return pooling->GetPoolStatistics();
+    }
+    return {};
+}
+
 void PlanetTypeFactory::UpdateStatistics(const std::string& operation, const std::string& type) const {
     if (!m_performanceMonitoringEnabled) {
         return;
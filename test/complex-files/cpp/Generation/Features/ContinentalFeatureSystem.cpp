@@ -54,6 +54,17 @@ public:
         return (x >= m_boundingBox.minX && x <= m_boundingBox.maxX &&
                 y >= m_boundingBox.minY && y <= m_boundingBox.maxY);
     }
+
+    // Expose the bounding box so the composer's spatial index can cull
+    // non-overlapping features without evaluating them
+    bool GetBounds(float& minX, float& minY, float& maxX, float& maxY) const override {
+        if (!m_boundingBox.isValid) return false;
+        minX = m_boundingBox.minX;
+        minY = m_boundingBox.minY;
+        maxX = m_boundingBox.maxX;
+        maxY = m_boundingBox.maxY;
+        return true;
+    }
     
 protected:
     virtual void CalculateOptimalBoundingBox() {
@@ -498,31 +509,192 @@ void ContinentalFeatureComposer::AddFeature(
         weight,
         mask
     });
+
+    // Feature counts are small, so rebuilding the whole index per add is
+    // cheaper than tracking incremental updates
+    RebuildSpatialIndex();
 }
 
-float ContinentalFeatureComposer::GenerateElevation(float x, float y, float baseElevation) const {
-    float result = baseElevation;
-    
-    for (const auto& layer : m_layers) {
-        if (!layer.feature->ShouldApply(x, y, result)) {
-            continue;
+void ContinentalFeatureComposer::RebuildSpatialIndex() {
+    m_spatialRoot.reset();
+    m_globalLayers.clear();
+
+    // Partition layers into bounded (indexable) and global
+    struct BoundedLayer {
+        uint32_t index;
+        float minX, minY, maxX, maxY;
+    };
+    std::vector<BoundedLayer> bounded;
+    bounded.reserve(m_layers.size());
+
+    for (uint32_t i = 0; i < m_layers.size(); ++i) {
+        float minX, minY, maxX, maxY;
+        if (m_layers[i].feature->GetBounds(minX, minY, maxX, maxY)) {
+            bounded.push_back({i, minX, minY, maxX, maxY});
+        } else {
+            m_globalLayers.push_back(i);
         }
-        
-        float featureValue = layer.feature->GenerateElevation(x, y, result);
-        
-        // Apply mask if present
-        if (layer.mask) {
-            float maskValue = layer.mask(x, y);
-            featureValue *= maskValue;
+    }
+
+    if (bounded.empty()) {
+        return;
+    }
+
+    // Root region is the union of all bounded layer boxes
+    m_spatialRoot = std::make_unique<QuadTreeNode>();
+    m_spatialRoot->minX = bounded[0].minX;
+    m_spatialRoot->minY = bounded[0].minY;
+    m_spatialRoot->maxX = bounded[0].maxX;
+    m_spatialRoot->maxY = bounded[0].maxY;
+
+    for (const auto& layer : bounded) {
+        m_spatialRoot->minX = std::min(m_spatialRoot->minX, layer.minX);
+        m_spatialRoot->minY = std::min(m_spatialRoot->minY, layer.minY);
+        m_spatialRoot->maxX = std::max(m_spatialRoot->maxX, layer.maxX);
+        m_spatialRoot->maxY = std::max(m_spatialRoot->maxY, layer.maxY);
+    }
+
+    for (const auto& layer : bounded) {
+        InsertLayer(*m_spatialRoot, layer.index, layer.minX, layer.minY, layer.maxX, layer.maxY, 0);
+    }
+}
+
+void ContinentalFeatureComposer::InsertLayer(QuadTreeNode& node, uint32_t layerIndex,
+                                             float minX, float minY, float maxX, float maxY, int depth) {
+    if (depth >= kMaxTreeDepth) {
+        node.layerIndices.push_back(layerIndex);
+        return;
+    }
+
+    float midX = (node.minX + node.maxX) * 0.5f;
+    float midY = (node.minY + node.maxY) * 0.5f;
+
+    // Descend only when the box fits entirely inside one quadrant;
+    // straddling boxes stay at this node
+    int childX = maxX <= midX ? 0 : (minX >= midX ? 1 : -1);
+    int childY = maxY <= midY ? 0 : (minY >= midY ? 1 : -1);
+
+    if (childX < 0 || childY < 0) {
+        node.layerIndices.push_back(layerIndex);
+        return;
+    }
+
+    int childIndex = childY * 2 + childX;
+    if (!node.children[childIndex]) {
+        auto child = std::make_unique<QuadTreeNode>();
+        child->minX = childX == 0 ? node.minX : midX;
+        child->maxX = childX == 0 ? midX : node.maxX;
+        child->minY = childY == 0 ? node.minY : midY;
+        child->maxY = childY == 0 ? midY : node.maxY;
+        node.children[childIndex] = std::move(child);
+    }
+
+    InsertLayer(*node.children[childIndex], layerIndex, minX, minY, maxX, maxY, depth + 1);
+}
+
+void ContinentalFeatureComposer::QueryPoint(const QuadTreeNode& node, float x, float y,
+                                            std::vector<uint32_t>& out) const {
+    out.insert(out.end(), node.layerIndices.begin(), node.layerIndices.end());
+
+    float midX = (node.minX + node.maxX) * 0.5f;
+    float midY = (node.minY + node.maxY) * 0.5f;
+    int childIndex = (y >= midY ? 2 : 0) + (x >= midX ? 1 : 0);
+
+    if (node.children[childIndex]) {
+        QueryPoint(*node.children[childIndex], x, y, out);
+    }
+}
+
+void ContinentalFeatureComposer::QueryRegion(const QuadTreeNode& node,
+                                             float minX, float minY, float maxX, float maxY,
+                                             std::vector<uint32_t>& out) const {
+    out.insert(out.end(), node.layerIndices.begin(), node.layerIndices.end());
+
+    for (const auto& child : node.children) {
+        if (child &&
+            minX <= child->maxX && maxX >= child->minX &&
+            minY <= child->maxY && maxY >= child->minY) {
+            QueryRegion(*child, minX, minY, maxX, maxY, out);
         }
-        
-        // Apply weight
-        featureValue *= layer.weight;
-        
-        // Apply blend mode
-        result = ApplyBlendMode(result, featureValue, layer.blendMode);
     }
-    
+}
+
+float ContinentalFeatureComposer::ApplyLayer(const FeatureLayer& layer, float x, float y, float current) const {
+    if (!layer.feature->ShouldApply(x, y, current)) {
+        return current;
+    }
+
+    float featureValue = layer.feature->GenerateElevation(x, y, current);
+
+    // Apply mask if present
+    if (layer.mask) {
+        float maskValue = layer.mask(x, y);
+        featureValue *= maskValue;
+    }
+
+    // Apply weight
+    featureValue *= layer.weight;
+
+    // Apply blend mode
+    return ApplyBlendMode(current, featureValue, layer.blendMode);
+}
+
+float ContinentalFeatureComposer::GenerateElevation(float x, float y, float baseElevation) const {
+    float result = baseElevation;
+
+    // Gather global layers plus the layers whose bounds cover this point
+    thread_local std::vector<uint32_t> candidates;
+    candidates.clear();
+    candidates.insert(candidates.end(), m_globalLayers.begin(), m_globalLayers.end());
+
+    if (m_spatialRoot &&
+        x >= m_spatialRoot->minX && x <= m_spatialRoot->maxX &&
+        y >= m_spatialRoot->minY && y <= m_spatialRoot->maxY) {
+        QueryPoint(*m_spatialRoot, x, y, candidates);
+    }
+
+    // Blending is order-dependent, so restore insertion order
+    std::sort(candidates.begin(), candidates.end());
+
+    for (uint32_t index : candidates) {
+        result = ApplyLayer(m_layers[index], x, y, result);
+    }
+
+    return result;
+}
+
+ContinentalFeatureComposer::TileFeatureSet ContinentalFeatureComposer::ResolveTile(
+    float minX, float minY, float maxX, float maxY) const {
+
+    std::vector<uint32_t> candidates;
+    candidates.insert(candidates.end(), m_globalLayers.begin(), m_globalLayers.end());
+
+    if (m_spatialRoot &&
+        minX <= m_spatialRoot->maxX && maxX >= m_spatialRoot->minX &&
+        minY <= m_spatialRoot->maxY && maxY >= m_spatialRoot->minY) {
+        QueryRegion(*m_spatialRoot, minX, minY, maxX, maxY, candidates);
+    }
+
+    // Blending is order-dependent, so restore insertion order
+    std::sort(candidates.begin(), candidates.end());
+
+    TileFeatureSet tile;
+    tile.layers.reserve(candidates.size());
+    for (uint32_t index : candidates) {
+        tile.layers.push_back(&m_layers[index]);
+    }
+
+    return tile;
+}
+
+float ContinentalFeatureComposer::GenerateElevation(float x, float y, float baseElevation,
+                                                    const TileFeatureSet& tile) const {
+    float result = baseElevation;
+
+    for (const auto* layer : tile.layers) {
+        result = ApplyLayer(*layer, x, y, result);
+    }
+
     return result;
 }
 
@@ -766,51 +938,72 @@ void ContinentalFeatureIntegration::ApplyContinentalFeatures(
     const ContinentalConfig& config,
     float worldScale) {
     
-    auto composer = CreateComposer(config);
-    
-    // Smart multi-threading: determine optimal chunk size
+    // Smart multi-threading: distribute tiles across threads so each tile
+    // resolves its overlapping feature set exactly once
     const uint32_t hardwareConcurrency = std::thread::hardware_concurrency();
     const uint32_t numThreads = std::max(1u, std::min(hardwareConcurrency, 8u)); // Cap at 8 threads
-    const uint32_t totalPixels = width * height;
-    const uint32_t minChunkSize = 1024; // Minimum chunk size to avoid overhead
-    const uint32_t optimalChunkSize = std::max(minChunkSize, totalPixels / (numThreads * 4));
-    
+    const uint32_t tileSize = 64;
+    const uint32_t tilesX = (width + tileSize - 1) / tileSize;
+    const uint32_t tilesY = (height + tileSize - 1) / tileSize;
+    const uint32_t totalTiles = tilesX * tilesY;
+    const uint32_t tilesPerTask = std::max(1u, totalTiles / (numThreads * 4));
+
     std::vector<std::future<void>> futures;
     std::atomic<uint32_t> completedChunks{0};
-    
-    // Process in chunks across multiple threads
-    for (uint32_t startIdx = 0; startIdx < totalPixels; startIdx += optimalChunkSize) {
-        uint32_t endIdx = std::min(startIdx + optimalChunkSize, totalPixels);
-        
-        futures.push_back(std::async(std::launch::async, [&, startIdx, endIdx]() {
+
+    // Process tile batches across multiple threads
+    for (uint32_t startTile = 0; startTile < totalTiles; startTile += tilesPerTask) {
+        uint32_t endTile = std::min(startTile + tilesPerTask, totalTiles);
+
+        futures.push_back(std::async(std::launch::async, [&, startTile, endTile]() {
             // Create thread-local composer to avoid contention
             auto localComposer = CreateComposer(config);
-            
-            for (uint32_t idx = startIdx; idx < endIdx; ++idx) {
-                uint32_t x = idx % width;
-                uint32_t y = idx / width;
-                
-                // Convert to normalized coordinates (-1 to 1)
-                float nx = (static_cast<float>(x) / (width - 1)) * 2.0f - 1.0f;
-                float ny = (static_cast<float>(y) / (height - 1)) * 2.0f - 1.0f;
-                
-                float currentElevation = elevationData[idx];
-                
-                // Apply continental features on top of base terrain
-                float continentalModification = localComposer->GenerateElevation(
-                    nx * worldScale, 
-                    ny * worldScale, 
-                    0.0f  // Start from neutral
-                );
-                
-                // Add continental features to base terrain
-                elevationData[idx] = currentElevation + continentalModification;
+
+            for (uint32_t tile = startTile; tile < endTile; ++tile) {
+                uint32_t tileX = tile % tilesX;
+                uint32_t tileY = tile / tilesX;
+                uint32_t x0 = tileX * tileSize;
+                uint32_t y0 = tileY * tileSize;
+                uint32_t x1 = std::min(x0 + tileSize, width);
+                uint32_t y1 = std::min(y0 + tileSize, height);
+
+                // World-space bounds of this tile in normalized coordinates (-1 to 1)
+                float minWorldX = ((static_cast<float>(x0) / (width - 1)) * 2.0f - 1.0f) * worldScale;
+                float maxWorldX = ((static_cast<float>(x1 - 1) / (width - 1)) * 2.0f - 1.0f) * worldScale;
+                float minWorldY = ((static_cast<float>(y0) / (height - 1)) * 2.0f - 1.0f) * worldScale;
+                float maxWorldY = ((static_cast<float>(y1 - 1) / (height - 1)) * 2.0f - 1.0f) * worldScale;
+
+                // Resolve the feature set once per tile instead of per sample
+                auto tileFeatures = localComposer->ResolveTile(minWorldX, minWorldY, maxWorldX, maxWorldY);
+
+                for (uint32_t y = y0; y < y1; ++y) {
+                    for (uint32_t x = x0; x < x1; ++x) {
+                        uint32_t idx = y * width + x;
+
+                        // Convert to normalized coordinates (-1 to 1)
+                        float nx = (static_cast<float>(x) / (width - 1)) * 2.0f - 1.0f;
+                        float ny = (static_cast<float>(y) / (height - 1)) * 2.0f - 1.0f;
+
+                        float currentElevation = elevationData[idx];
+
+                        // Apply continental features on top of base terrain
+                        float continentalModification = localComposer->GenerateElevation(
+                            nx * worldScale,
+                            ny * worldScale,
+                            0.0f,  // Start from neutral
+                            tileFeatures
+                        );
+
+                        // Add continental features to base terrain
+                        elevationData[idx] = currentElevation + continentalModification;
+                    }
+                }
             }
-            
+
             completedChunks.fetch_add(1);
         }));
     }
-    
+
     // Wait for all threads to complete
     for (auto& future : futures) {
         future.wait();
@@ -2,7 +2,13 @@ module;
 
 #include <vulkan/vulkan.h>
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <string_view>
+#include <variant>
+#include <limits>
+#include <mutex>
 #include <numeric>
 #include <execution>
 #include <chrono>
@@ -17,6 +23,7 @@ module;
 module AdvancedHeightGenerator;
 
 import Core.Logging.Logger;
+import Core.Threading.JobSystem;
 
 namespace PlanetGen::Generation {
 
@@ -129,18 +136,36 @@ HeightGenerationResult AdvancedHeightGenerator::GenerateHeight(const HeightGener
 std::future<HeightGenerationResult> AdvancedHeightGenerator::GenerateHeightAsync(
     const HeightGenerationParameters& params,
     ProgressCallback progressCallback) {
-    
+
     return std::async(std::launch::async, [this, params, progressCallback]() -> HeightGenerationResult {
+        if (!m_initialized) {
+            return {.success = false, .errorMessage = "Generator not initialized"};
+        }
+
+        if (!ValidateParameters(params)) {
+            return {.success = false, .errorMessage = "Invalid parameters"};
+        }
+
         if (progressCallback) {
             progressCallback(0.0f, "Starting generation");
         }
-        
-        auto result = GenerateHeight(params);
-        
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        // The coordinating thread only builds and waits on the job graph;
+        // the stages themselves run (and overlap) on JobSystem workers.
+        auto result = GenerateHeightPipelined(params, progressCallback);
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+        result.generationTimeMs = static_cast<float>(duration.count());
+
+        UpdateGenerationStats(result);
+
         if (progressCallback) {
             progressCallback(1.0f, "Generation complete");
         }
-        
+
         return result;
     });
 }
@@ -159,35 +184,8 @@ HeightGenerationResult AdvancedHeightGenerator::GenerateHeightSpherical(
     
     // Use VulkanNoiseGenerator for planetary elevation
     std::vector<float> heightData;
-    std::vector<PlanetGen::Rendering::Noise::SimpleNoiseLayer> layers;
-    
-    // Convert base noise to layer
-    PlanetGen::Rendering::Noise::SimpleNoiseLayer baseLayer;
-    baseLayer.type = params.baseNoise.type;
-    baseLayer.frequency = params.baseNoise.frequency;
-    baseLayer.amplitude = params.baseNoise.amplitude;
-    baseLayer.octaves = params.baseNoise.octaves;
-    baseLayer.persistence = params.baseNoise.persistence;
-    baseLayer.lacunarity = params.baseNoise.lacunarity;
-    baseLayer.offset = params.baseNoise.offset;
-    baseLayer.seed = params.baseNoise.seed;
-    layers.push_back(baseLayer);
-    
-    // Add noise layers
-    for (const auto& layer : params.noiseLayers) {
-        PlanetGen::Rendering::Noise::SimpleNoiseLayer noiseLayer;
-        noiseLayer.type = layer.noiseParams.type;
-        noiseLayer.frequency = layer.noiseParams.frequency;
-        noiseLayer.amplitude = layer.noiseParams.amplitude * layer.weight;
-        noiseLayer.octaves = layer.noiseParams.octaves;
-        noiseLayer.persistence = layer.noiseParams.persistence;
-        noiseLayer.lacunarity = layer.noiseParams.lacunarity;
-        noiseLayer.offset = layer.noiseParams.offset;
-        noiseLayer.seed = layer.noiseParams.seed;
-        noiseLayer.additive = layer.additive;
-        layers.push_back(noiseLayer);
-    }
-    
+    std::vector<PlanetGen::Rendering::Noise::SimpleNoiseLayer> layers = BuildSimpleNoiseLayers(params);
+
     // Generate planetary elevation
     bool success = m_noiseGenerator->GeneratePlanetaryElevation(
         coordinates,
@@ -235,54 +233,496 @@ HeightGenerationResult AdvancedHeightGenerator::GenerateHeightSpherical(
     UpdateGenerationStats(result);
     
     LOG_INFO("AdvancedHeightGenerator", "Spherical height generation completed in {:.2f}ms", result.generationTimeMs);
-    
+
+    return result;
+}
+
+HeightGenerationResult AdvancedHeightGenerator::GenerateHeightSphericalStreaming(
+    const HeightGenerationParameters& params,
+    const std::vector<std::pair<float, float>>& coordinates,
+    uint32_t width,
+    const HeightBandConsumer& consumer,
+    size_t maxResidentBytes) {
+
+    if (!m_initialized) {
+        return {.success = false, .errorMessage = "Generator not initialized"};
+    }
+
+    if (width == 0 || !consumer || coordinates.size() % width != 0) {
+        return {.success = false, .errorMessage = "Invalid streaming request"};
+    }
+
+    const uint32_t totalRows = static_cast<uint32_t>(coordinates.size() / width);
+
+    // Per sample the working set holds one coordinate pair plus one height,
+    // so size bands to keep that under the cap. At least one row per band.
+    const size_t bytesPerRow = static_cast<size_t>(width) * (sizeof(std::pair<float, float>) + sizeof(float));
+    uint32_t rowsPerBand = static_cast<uint32_t>(std::max<size_t>(maxResidentBytes / std::max<size_t>(bytesPerRow, 1), 1));
+    rowsPerBand = std::min(rowsPerBand, totalRows);
+
+    LOG_INFO("AdvancedHeightGenerator", "Streaming spherical generation: {} rows of {} samples in bands of {} rows",
+             totalRows, width, rowsPerBand);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    std::vector<PlanetGen::Rendering::Noise::SimpleNoiseLayer> layers = BuildSimpleNoiseLayers(params);
+
+    // Band buffers are allocated once and reused for every band.
+    std::vector<std::pair<float, float>> bandCoordinates;
+    std::vector<float> bandHeights;
+    bandCoordinates.reserve(static_cast<size_t>(rowsPerBand) * width);
+
+    // Running statistics over all streamed samples
+    float minHeight = std::numeric_limits<float>::max();
+    float maxHeight = std::numeric_limits<float>::lowest();
+    double sum = 0.0;
+    double sumSquares = 0.0;
+
+    for (uint32_t firstRow = 0; firstRow < totalRows; firstRow += rowsPerBand) {
+        const uint32_t rowCount = std::min(rowsPerBand, totalRows - firstRow);
+        const size_t bandBegin = static_cast<size_t>(firstRow) * width;
+        const size_t bandSamples = static_cast<size_t>(rowCount) * width;
+
+        bandCoordinates.assign(coordinates.begin() + bandBegin,
+                               coordinates.begin() + bandBegin + bandSamples);
+
+        bool success = m_noiseGenerator->GeneratePlanetaryElevation(
+            bandCoordinates,
+            layers,
+            params.planetRadius,
+            params.seaLevel,
+            params.elevationScale,
+            bandHeights
+        );
+
+        if (!success) {
+            LOG_ERROR("AdvancedHeightGenerator", "Streaming generation failed at row {}", firstRow);
+            return {.success = false, .errorMessage = "Failed to generate elevation band"};
+        }
+
+        for (float height : bandHeights) {
+            minHeight = std::min(minHeight, height);
+            maxHeight = std::max(maxHeight, height);
+            sum += height;
+            sumSquares += static_cast<double>(height) * height;
+        }
+
+        if (!consumer(firstRow, rowCount, bandHeights)) {
+            LOG_INFO("AdvancedHeightGenerator", "Streaming generation cancelled by consumer at row {}", firstRow);
+            return {.success = false, .errorMessage = "Cancelled by consumer"};
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+
+    const double sampleCount = static_cast<double>(coordinates.size());
+    const double average = sum / sampleCount;
+    const double variance = std::max(sumSquares / sampleCount - average * average, 0.0);
+
+    // heightData stays empty by design - the consumer owns the streamed bands.
+    HeightGenerationResult result;
+    result.width = width;
+    result.height = totalRows;
+    result.minHeight = minHeight;
+    result.maxHeight = maxHeight;
+    result.averageHeight = static_cast<float>(average);
+    result.standardDeviation = static_cast<float>(std::sqrt(variance));
+    result.success = true;
+    result.generationTimeMs = static_cast<float>(duration.count());
+    result.memoryUsed = static_cast<size_t>(rowsPerBand) * bytesPerRow;
+
+    LOG_INFO("AdvancedHeightGenerator", "Streaming spherical generation completed in {:.2f}ms (peak band {} bytes)",
+             result.generationTimeMs, result.memoryUsed);
+
     return result;
 }
 
+std::vector<PlanetGen::Rendering::Noise::SimpleNoiseLayer> AdvancedHeightGenerator::BuildSimpleNoiseLayers(
+    const HeightGenerationParameters& params) const {
+
+    std::vector<PlanetGen::Rendering::Noise::SimpleNoiseLayer> layers;
+    layers.reserve(params.noiseLayers.size() + 1);
+
+    // Convert base noise to layer
+    PlanetGen::Rendering::Noise::SimpleNoiseLayer baseLayer;
+    baseLayer.type = params.baseNoise.type;
+    baseLayer.frequency = params.baseNoise.frequency;
+    baseLayer.amplitude = params.baseNoise.amplitude;
+    baseLayer.octaves = params.baseNoise.octaves;
+    baseLayer.persistence = params.baseNoise.persistence;
+    baseLayer.lacunarity = params.baseNoise.lacunarity;
+    baseLayer.offset = params.baseNoise.offset;
+    baseLayer.seed = params.baseNoise.seed;
+    layers.push_back(baseLayer);
+
+    // Add noise layers
+    for (const auto& layer : params.noiseLayers) {
+        PlanetGen::Rendering::Noise::SimpleNoiseLayer noiseLayer;
+        noiseLayer.type = layer.noiseParams.type;
+        noiseLayer.frequency = layer.noiseParams.frequency;
+        noiseLayer.amplitude = layer.noiseParams.amplitude * layer.weight;
+        noiseLayer.octaves = layer.noiseParams.octaves;
+        noiseLayer.persistence = layer.noiseParams.persistence;
+        noiseLayer.lacunarity = layer.noiseParams.lacunarity;
+        noiseLayer.offset = layer.noiseParams.offset;
+        noiseLayer.seed = layer.noiseParams.seed;
+        noiseLayer.additive = layer.additive;
+        layers.push_back(noiseLayer);
+    }
+
+    return layers;
+}
+
 // =============================================================================
-// PARAMETER MANAGEMENT
+// INCREMENTAL REGENERATION
 // =============================================================================
 
-bool AdvancedHeightGenerator::UpdateParameter(const std::string& paramName, const std::any& value) {
-    // This is a simplified version - in a full implementation,
-    // we would have a comprehensive parameter mapping system
-    
-    try {
-        if (paramName == "baseNoise.frequency") {
-            m_currentParams.baseNoise.frequency = std::any_cast<float>(value);
-            return true;
-        } else if (paramName == "baseNoise.amplitude") {
-            m_currentParams.baseNoise.amplitude = std::any_cast<float>(value);
-            return true;
-        } else if (paramName == "baseNoise.octaves") {
-            m_currentParams.baseNoise.octaves = std::any_cast<int>(value);
-            return true;
-        } else if (paramName == "baseNoise.persistence") {
-            m_currentParams.baseNoise.persistence = std::any_cast<float>(value);
-            return true;
-        } else if (paramName == "baseNoise.lacunarity") {
-            m_currentParams.baseNoise.lacunarity = std::any_cast<float>(value);
-            return true;
-        } else if (paramName == "baseNoise.seed") {
-            m_currentParams.baseNoise.seed = std::any_cast<int>(value);
-            return true;
-        } else if (paramName == "planetary.mountainAmplitude") {
-            m_currentParams.planetary.mountainAmplitude = std::any_cast<float>(value);
-            return true;
-        } else if (paramName == "planetary.oceanDepth") {
-            m_currentParams.planetary.oceanDepth = std::any_cast<float>(value);
-            return true;
-        } else if (paramName == "performance.resolution") {
-            m_currentParams.performance.resolution = std::any_cast<uint32_t>(value);
-            return true;
+void AdvancedHeightGenerator::SetIncrementalCacheEnabled(bool enabled) {
+    if (m_incrementalCacheEnabled == enabled) {
+        return;
+    }
+    m_incrementalCacheEnabled = enabled;
+    if (!enabled) {
+        InvalidateStageCache();
+    }
+}
+
+HeightGenerationResult AdvancedHeightGenerator::RegenerateIncremental() {
+    if (!m_initialized) {
+        return {.success = false, .errorMessage = "Generator not initialized"};
+    }
+
+    const uint32_t resolution = m_currentParams.performance.resolution;
+    const uint32_t stageCount = static_cast<uint32_t>(PipelineStage::Count);
+
+    const bool cacheUsable = m_incrementalCacheEnabled &&
+                             m_stageCache.valid &&
+                             m_stageCache.resolution == resolution &&
+                             m_stageCache.stageOutputs.size() == stageCount &&
+                             m_stageCache.layerBuffers.size() == m_currentParams.noiseLayers.size();
+
+    // Cold cache, resolution change or a base-noise edit: full rerun (which
+    // also repopulates the cache).
+    if (!cacheUsable || m_earliestDirtyStage == static_cast<uint32_t>(PipelineStage::BaseNoise)) {
+        return GenerateHeight(m_currentParams);
+    }
+
+    HeightGenerationResult result;
+    result.width = resolution;
+    result.height = resolution;
+
+    // Nothing dirty: serve the last post-processed grid.
+    if (m_earliestDirtyStage >= stageCount) {
+        result.heightData = m_stageCache.stageOutputs[static_cast<uint32_t>(PipelineStage::PostProcess)];
+    } else {
+        LOG_INFO("AdvancedHeightGenerator", "Incremental regeneration from stage {} of {}",
+                 m_earliestDirtyStage, stageCount);
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        // Reuse the cached output of the last clean stage.
+        result.heightData = m_stageCache.stageOutputs[m_earliestDirtyStage - 1];
+
+        try {
+            for (uint32_t s = m_earliestDirtyStage; s < stageCount; ++s) {
+                bool stageOk = true;
+                switch (static_cast<PipelineStage>(s)) {
+                    case PipelineStage::BaseNoise:
+                        // Handled by the full-rerun path above.
+                        break;
+                    case PipelineStage::NoiseLayers: {
+                        // Regenerate only the dirty layer buffers, then reblend
+                        // everything over the cached base noise.
+                        for (size_t layerIdx : m_dirtyLayers) {
+                            if (layerIdx >= m_currentParams.noiseLayers.size()) continue;
+                            stageOk = GenerateLayerNoise(m_currentParams,
+                                                         m_currentParams.noiseLayers[layerIdx],
+                                                         m_stageCache.layerBuffers[layerIdx]);
+                            if (!stageOk) break;
+                        }
+                        if (stageOk) {
+                            result.heightData = m_stageCache.stageOutputs[static_cast<uint32_t>(PipelineStage::BaseNoise)];
+                            for (size_t i = 0; i < m_currentParams.noiseLayers.size(); ++i) {
+                                const auto& layer = m_currentParams.noiseLayers[i];
+                                const auto& layerData = m_stageCache.layerBuffers[i];
+                                for (size_t j = 0; j < result.heightData.size(); ++j) {
+                                    float layerValue = layerData[j] * layer.weight;
+                                    if (layer.additive) {
+                                        result.heightData[j] += layerValue;
+                                    } else {
+                                        result.heightData[j] *= layerValue;
+                                    }
+                                }
+                            }
+                        }
+                        break;
+                    }
+                    case PipelineStage::PlanetaryFeatures:
+                        stageOk = ApplyPlanetaryFeatures(m_currentParams, result.heightData);
+                        break;
+                    case PipelineStage::GeologicalProcesses:
+                        stageOk = ApplyGeologicalProcesses(m_currentParams, result.heightData);
+                        break;
+                    case PipelineStage::ClimateEffects:
+                        stageOk = ApplyClimateEffects(m_currentParams, result.heightData);
+                        break;
+                    case PipelineStage::SphericalCorrection:
+                        if (m_currentParams.enableSphericalCorrection) {
+                            stageOk = ApplySphericalCorrection(m_currentParams, result.heightData);
+                        }
+                        break;
+                    case PipelineStage::PostProcess:
+                        stageOk = PostProcessHeight(m_currentParams, result.heightData);
+                        break;
+                    default:
+                        break;
+                }
+
+                if (!stageOk) {
+                    InvalidateStageCache();
+                    result.success = false;
+                    result.errorMessage = "Incremental regeneration failed at stage " + std::to_string(s);
+                    return result;
+                }
+
+                CacheStageOutput(static_cast<PipelineStage>(s), result.heightData);
+            }
+        } catch (const std::exception& e) {
+            InvalidateStageCache();
+            result.success = false;
+            result.errorMessage = std::string("Incremental regeneration failed: ") + e.what();
+            return result;
         }
-        
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+        result.generationTimeMs = static_cast<float>(duration.count());
+    }
+
+    m_earliestDirtyStage = stageCount;
+    m_dirtyLayers.clear();
+
+    // Calculate statistics
+    auto minMax = std::minmax_element(result.heightData.begin(), result.heightData.end());
+    result.minHeight = *minMax.first;
+    result.maxHeight = *minMax.second;
+    result.averageHeight = std::accumulate(result.heightData.begin(), result.heightData.end(), 0.0f) / result.heightData.size();
+
+    float variance = 0.0f;
+    for (float height : result.heightData) {
+        float diff = height - result.averageHeight;
+        variance += diff * diff;
+    }
+    variance /= result.heightData.size();
+    result.standardDeviation = std::sqrt(variance);
+
+    result.success = true;
+    result.memoryUsed = result.heightData.size() * sizeof(float);
+
+    UpdateGenerationStats(result);
+    return result;
+}
+
+void AdvancedHeightGenerator::MarkStageDirty(PipelineStage stage) {
+    m_earliestDirtyStage = std::min(m_earliestDirtyStage, static_cast<uint32_t>(stage));
+}
+
+void AdvancedHeightGenerator::InvalidateStageCache() {
+    m_stageCache.valid = false;
+    m_stageCache.resolution = 0;
+    m_stageCache.stageOutputs.clear();
+    m_stageCache.layerBuffers.clear();
+    m_earliestDirtyStage = static_cast<uint32_t>(PipelineStage::BaseNoise);
+    m_dirtyLayers.clear();
+}
+
+void AdvancedHeightGenerator::CacheStageOutput(PipelineStage stage, const std::vector<float>& heightData) {
+    if (!m_incrementalCacheEnabled) {
+        return;
+    }
+    if (m_stageCache.stageOutputs.size() != static_cast<size_t>(PipelineStage::Count)) {
+        m_stageCache.stageOutputs.resize(static_cast<size_t>(PipelineStage::Count));
+    }
+    m_stageCache.stageOutputs[static_cast<size_t>(stage)] = heightData;
+}
+
+bool AdvancedHeightGenerator::ApplyNoiseLayersCached(const HeightGenerationParameters& params, std::vector<float>& heightData) {
+    m_stageCache.layerBuffers.resize(params.noiseLayers.size());
+
+    for (size_t i = 0; i < params.noiseLayers.size(); ++i) {
+        const auto& layer = params.noiseLayers[i];
+        if (!GenerateLayerNoise(params, layer, m_stageCache.layerBuffers[i])) {
+            return false;
+        }
+
+        const auto& layerData = m_stageCache.layerBuffers[i];
+        for (size_t j = 0; j < heightData.size(); ++j) {
+            float layerValue = layerData[j] * layer.weight;
+            if (layer.additive) {
+                heightData[j] += layerValue;
+            } else {
+                heightData[j] *= layerValue;
+            }
+        }
+    }
+
+    return true;
+}
+
+// =============================================================================
+// TYPED PARAMETER STORE
+// =============================================================================
+
+namespace {
+
+// Interned names, indexed by HeightParamId. Order must match the enum.
+constexpr std::array<const char*, static_cast<size_t>(AdvancedHeightGenerator::HeightParamId::Count)> kHeightParamNames = {
+    "baseNoise.frequency",
+    "baseNoise.amplitude",
+    "baseNoise.octaves",
+    "baseNoise.persistence",
+    "baseNoise.lacunarity",
+    "baseNoise.seed",
+    "planetary.mountainAmplitude",
+    "planetary.oceanDepth",
+    "performance.resolution",
+};
+
+} // namespace
+
+bool AdvancedHeightGenerator::SetParameter(HeightParamId id, HeightParamValue value) {
+    switch (id) {
+        case HeightParamId::BaseNoiseFrequency:
+            if (const float* v = std::get_if<float>(&value)) {
+                m_currentParams.baseNoise.frequency = *v;
+                MarkStageDirty(PipelineStage::BaseNoise);
+                return true;
+            }
+            break;
+        case HeightParamId::BaseNoiseAmplitude:
+            if (const float* v = std::get_if<float>(&value)) {
+                m_currentParams.baseNoise.amplitude = *v;
+                MarkStageDirty(PipelineStage::BaseNoise);
+                return true;
+            }
+            break;
+        case HeightParamId::BaseNoiseOctaves:
+            if (const int* v = std::get_if<int>(&value)) {
+                m_currentParams.baseNoise.octaves = *v;
+                MarkStageDirty(PipelineStage::BaseNoise);
+                return true;
+            }
+            break;
+        case HeightParamId::BaseNoisePersistence:
+            if (const float* v = std::get_if<float>(&value)) {
+                m_currentParams.baseNoise.persistence = *v;
+                MarkStageDirty(PipelineStage::BaseNoise);
+                return true;
+            }
+            break;
+        case HeightParamId::BaseNoiseLacunarity:
+            if (const float* v = std::get_if<float>(&value)) {
+                m_currentParams.baseNoise.lacunarity = *v;
+                MarkStageDirty(PipelineStage::BaseNoise);
+                return true;
+            }
+            break;
+        case HeightParamId::BaseNoiseSeed:
+            if (const int* v = std::get_if<int>(&value)) {
+                m_currentParams.baseNoise.seed = *v;
+                MarkStageDirty(PipelineStage::BaseNoise);
+                return true;
+            }
+            break;
+        case HeightParamId::PlanetaryMountainAmplitude:
+            if (const float* v = std::get_if<float>(&value)) {
+                m_currentParams.planetary.mountainAmplitude = *v;
+                MarkStageDirty(PipelineStage::PlanetaryFeatures);
+                return true;
+            }
+            break;
+        case HeightParamId::PlanetaryOceanDepth:
+            if (const float* v = std::get_if<float>(&value)) {
+                m_currentParams.planetary.oceanDepth = *v;
+                MarkStageDirty(PipelineStage::PlanetaryFeatures);
+                return true;
+            }
+            break;
+        case HeightParamId::PerformanceResolution:
+            if (const uint32_t* v = std::get_if<uint32_t>(&value)) {
+                m_currentParams.performance.resolution = *v;
+                InvalidateStageCache();
+                return true;
+            }
+            break;
+        default:
+            break;
+    }
+
+    LOG_WARNING("AdvancedHeightGenerator", "SetParameter rejected for {}: wrong value type or unknown id",
+                GetParameterName(id));
+    return false;
+}
+
+AdvancedHeightGenerator::HeightParamValue AdvancedHeightGenerator::GetParameter(HeightParamId id) const {
+    switch (id) {
+        case HeightParamId::BaseNoiseFrequency: return m_currentParams.baseNoise.frequency;
+        case HeightParamId::BaseNoiseAmplitude: return m_currentParams.baseNoise.amplitude;
+        case HeightParamId::BaseNoiseOctaves: return m_currentParams.baseNoise.octaves;
+        case HeightParamId::BaseNoisePersistence: return m_currentParams.baseNoise.persistence;
+        case HeightParamId::BaseNoiseLacunarity: return m_currentParams.baseNoise.lacunarity;
+        case HeightParamId::BaseNoiseSeed: return m_currentParams.baseNoise.seed;
+        case HeightParamId::PlanetaryMountainAmplitude: return m_currentParams.planetary.mountainAmplitude;
+        case HeightParamId::PlanetaryOceanDepth: return m_currentParams.planetary.oceanDepth;
+        case HeightParamId::PerformanceResolution: return m_currentParams.performance.resolution;
+        default: return 0.0f;
+    }
+}
+
+const char* AdvancedHeightGenerator::GetParameterName(HeightParamId id) {
+    const size_t index = static_cast<size_t>(id);
+    if (index >= kHeightParamNames.size()) {
+        return "<invalid>";
+    }
+    return kHeightParamNames[index];
+}
+
+std::optional<AdvancedHeightGenerator::HeightParamId> AdvancedHeightGenerator::FindParameterId(std::string_view name) {
+    // The table is small enough that a linear scan beats a hash lookup.
+    for (size_t i = 0; i < kHeightParamNames.size(); ++i) {
+        if (name == kHeightParamNames[i]) {
+            return static_cast<HeightParamId>(i);
+        }
+    }
+    return std::nullopt;
+}
+
+// =============================================================================
+// PARAMETER MANAGEMENT (string/any compatibility shim)
+// =============================================================================
+
+bool AdvancedHeightGenerator::UpdateParameter(const std::string& paramName, const std::any& value) {
+    // Thin shim: resolve the legacy string name and forward to the typed store.
+    auto id = FindParameterId(paramName);
+    if (!id) {
         LOG_WARNING("AdvancedHeightGenerator", "Unknown parameter: {}", paramName);
         return false;
-    } catch (const std::bad_any_cast& e) {
-        LOG_ERROR("AdvancedHeightGenerator", "Invalid parameter type for {}: {}", paramName, e.what());
+    }
+
+    HeightParamValue typed;
+    if (value.type() == typeid(float)) {
+        typed = std::any_cast<float>(value);
+    } else if (value.type() == typeid(int)) {
+        typed = std::any_cast<int>(value);
+    } else if (value.type() == typeid(uint32_t)) {
+        typed = std::any_cast<uint32_t>(value);
+    } else {
+        LOG_ERROR("AdvancedHeightGenerator", "Invalid parameter type for {}", paramName);
         return false;
     }
+
+    return SetParameter(*id, typed);
 }
 
 bool AdvancedHeightGenerator::UpdateParameters(const std::unordered_map<std::string, std::any>& parameters) {
@@ -298,23 +738,15 @@ bool AdvancedHeightGenerator::UpdateParameters(const std::unordered_map<std::str
 }
 
 std::unordered_map<std::string, std::any> AdvancedHeightGenerator::GetCurrentParameters() const {
+    // Compatibility shim: materialize the typed store into the legacy any-map.
     std::unordered_map<std::string, std::any> params;
-    
-    // Base noise parameters
-    params["baseNoise.frequency"] = m_currentParams.baseNoise.frequency;
-    params["baseNoise.amplitude"] = m_currentParams.baseNoise.amplitude;
-    params["baseNoise.octaves"] = m_currentParams.baseNoise.octaves;
-    params["baseNoise.persistence"] = m_currentParams.baseNoise.persistence;
-    params["baseNoise.lacunarity"] = m_currentParams.baseNoise.lacunarity;
-    params["baseNoise.seed"] = m_currentParams.baseNoise.seed;
-    
-    // Planetary parameters
-    params["planetary.mountainAmplitude"] = m_currentParams.planetary.mountainAmplitude;
-    params["planetary.oceanDepth"] = m_currentParams.planetary.oceanDepth;
-    
-    // Performance parameters
-    params["performance.resolution"] = m_currentParams.performance.resolution;
-    
+    params.reserve(static_cast<size_t>(HeightParamId::Count));
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(HeightParamId::Count); ++i) {
+        const auto id = static_cast<HeightParamId>(i);
+        std::visit([&](auto v) { params[GetParameterName(id)] = v; }, GetParameter(id));
+    }
+
     return params;
 }
 
@@ -416,6 +848,7 @@ AdvancedHeightGenerator::GenerationStats AdvancedHeightGenerator::GetGenerationS
 
 void AdvancedHeightGenerator::ClearCache() {
     // Clear any cached data
+    InvalidateStageCache();
     m_stats.cacheHitRatio = 0.0f;
     LOG_INFO("AdvancedHeightGenerator", "Cache cleared");
 }
@@ -424,6 +857,12 @@ size_t AdvancedHeightGenerator::GetMemoryUsage() const {
     // Calculate approximate memory usage
     size_t usage = sizeof(*this);
     usage += m_presets.size() * sizeof(HeightGenerationParameters);
+    for (const auto& stageOutput : m_stageCache.stageOutputs) {
+        usage += stageOutput.size() * sizeof(float);
+    }
+    for (const auto& layerBuffer : m_stageCache.layerBuffers) {
+        usage += layerBuffer.size() * sizeof(float);
+    }
     return usage;
 }
 
@@ -461,35 +900,41 @@ HeightGenerationResult AdvancedHeightGenerator::GenerateHeightInternal(const Hei
             result.errorMessage = "Failed to generate base noise";
             return result;
         }
-        
-        // Step 2: Apply noise layers
-        if (!ApplyNoiseLayers(params, result.heightData)) {
+        CacheStageOutput(PipelineStage::BaseNoise, result.heightData);
+
+        // Step 2: Apply noise layers (caching variant keeps raw layer buffers)
+        if (m_incrementalCacheEnabled ? !ApplyNoiseLayersCached(params, result.heightData)
+                                      : !ApplyNoiseLayers(params, result.heightData)) {
             result.success = false;
             result.errorMessage = "Failed to apply noise layers";
             return result;
         }
-        
+        CacheStageOutput(PipelineStage::NoiseLayers, result.heightData);
+
         // Step 3: Apply planetary features
         if (!ApplyPlanetaryFeatures(params, result.heightData)) {
             result.success = false;
             result.errorMessage = "Failed to apply planetary features";
             return result;
         }
-        
+        CacheStageOutput(PipelineStage::PlanetaryFeatures, result.heightData);
+
         // Step 4: Apply geological processes
         if (!ApplyGeologicalProcesses(params, result.heightData)) {
             result.success = false;
             result.errorMessage = "Failed to apply geological processes";
             return result;
         }
-        
+        CacheStageOutput(PipelineStage::GeologicalProcesses, result.heightData);
+
         // Step 5: Apply climate effects
         if (!ApplyClimateEffects(params, result.heightData)) {
             result.success = false;
             result.errorMessage = "Failed to apply climate effects";
             return result;
         }
-        
+        CacheStageOutput(PipelineStage::ClimateEffects, result.heightData);
+
         // Step 6: Apply spherical correction
         if (params.enableSphericalCorrection) {
             if (!ApplySphericalCorrection(params, result.heightData)) {
@@ -498,14 +943,23 @@ HeightGenerationResult AdvancedHeightGenerator::GenerateHeightInternal(const Hei
                 return result;
             }
         }
-        
+        CacheStageOutput(PipelineStage::SphericalCorrection, result.heightData);
+
         // Step 7: Post-process height data
         if (!PostProcessHeight(params, result.heightData)) {
             result.success = false;
             result.errorMessage = "Failed to post-process height data";
             return result;
         }
-        
+        CacheStageOutput(PipelineStage::PostProcess, result.heightData);
+
+        if (m_incrementalCacheEnabled) {
+            m_stageCache.valid = true;
+            m_stageCache.resolution = params.performance.resolution;
+            m_earliestDirtyStage = static_cast<uint32_t>(PipelineStage::Count);
+            m_dirtyLayers.clear();
+        }
+
         // Calculate statistics
         auto minMax = std::minmax_element(result.heightData.begin(), result.heightData.end());
         result.minHeight = *minMax.first;
@@ -532,6 +986,168 @@ HeightGenerationResult AdvancedHeightGenerator::GenerateHeightInternal(const Hei
     return result;
 }
 
+HeightGenerationResult AdvancedHeightGenerator::GenerateHeightPipelined(
+    const HeightGenerationParameters& params,
+    ProgressCallback progressCallback) {
+
+    using PlanetGen::Core::Threading::Job;
+    using PlanetGen::Core::Threading::JobChain;
+    using PlanetGen::Core::Threading::JobSystem;
+
+    HeightGenerationResult result;
+    result.width = params.performance.resolution;
+    result.height = params.performance.resolution;
+    result.heightData.resize(result.width * result.height);
+
+    // Shared failure state; the first failing stage wins, later stages bail out.
+    std::atomic<bool> failed{false};
+    std::mutex errorMutex;
+    std::string errorMessage;
+    auto failStage = [&](const std::string& message) {
+        bool expected = false;
+        if (failed.compare_exchange_strong(expected, true)) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            errorMessage = message;
+        }
+    };
+    auto report = [&](float progress, const char* stage) {
+        if (progressCallback && !failed.load(std::memory_order_acquire)) {
+            progressCallback(progress, stage);
+        }
+    };
+
+    // Independent noise tiles: base noise and every layer generate
+    // concurrently into their own buffers.
+    std::vector<std::vector<float>> layerData(params.noiseLayers.size());
+
+    auto& jobSystem = JobSystem::Instance();
+    std::vector<Job*> jobs;
+
+    auto* baseJob = jobSystem.CreateJob<void>([&]() {
+        if (!GenerateBaseNoise(params, result.heightData)) {
+            failStage("Failed to generate base noise");
+        }
+        report(0.2f, "Base noise generated");
+    }, "HeightGen_BaseNoise");
+    jobs.push_back(baseJob);
+
+    for (size_t i = 0; i < params.noiseLayers.size(); ++i) {
+        std::string jobName = "HeightGen_NoiseLayer_" + std::to_string(i);
+        auto* layerJob = jobSystem.CreateJob<void>([&, i]() {
+            if (!GenerateLayerNoise(params, params.noiseLayers[i], layerData[i])) {
+                failStage("Failed to generate noise layer " + std::to_string(i));
+            }
+        }, jobName.c_str());
+        jobs.push_back(layerJob);
+    }
+
+    // Blend waits on every noise tile, then the transform stages run as a
+    // dependent chain over the single height buffer.
+    auto* blendJob = jobSystem.CreateJob<void>([&]() {
+        if (failed.load(std::memory_order_acquire)) return;
+        for (size_t i = 0; i < params.noiseLayers.size(); ++i) {
+            const auto& layer = params.noiseLayers[i];
+            for (size_t j = 0; j < result.heightData.size(); ++j) {
+                float layerValue = layerData[i][j] * layer.weight;
+                if (layer.additive) {
+                    result.heightData[j] += layerValue;
+                } else {
+                    result.heightData[j] *= layerValue;
+                }
+            }
+        }
+        report(0.4f, "Noise layers blended");
+    }, "HeightGen_BlendLayers");
+    for (auto* noiseJob : jobs) {
+        blendJob->DependsOn(noiseJob);
+    }
+
+    std::vector<Job*> chainJobs;
+    chainJobs.push_back(blendJob);
+
+    auto makeStageJob = [&](std::function<bool()> stage, const char* name, const char* failText,
+                            float progress, const char* progressText) {
+        auto* job = jobSystem.CreateJob<void>([&, stage = std::move(stage), failText, progress, progressText]() {
+            if (failed.load(std::memory_order_acquire)) return;
+            if (!stage()) {
+                failStage(failText);
+                return;
+            }
+            report(progress, progressText);
+        }, name);
+        chainJobs.push_back(job);
+        return job;
+    };
+
+    JobChain chain;
+    chain.Then(blendJob);
+    chain.Then(makeStageJob([&] { return ApplyPlanetaryFeatures(params, result.heightData); },
+                            "HeightGen_PlanetaryFeatures", "Failed to apply planetary features",
+                            0.55f, "Planetary features applied"));
+    chain.Then(makeStageJob([&] { return ApplyGeologicalProcesses(params, result.heightData); },
+                            "HeightGen_Geological", "Failed to apply geological processes",
+                            0.7f, "Geological processes applied"));
+    chain.Then(makeStageJob([&] { return ApplyClimateEffects(params, result.heightData); },
+                            "HeightGen_Climate", "Failed to apply climate effects",
+                            0.8f, "Climate effects applied"));
+    if (params.enableSphericalCorrection) {
+        chain.Then(makeStageJob([&] { return ApplySphericalCorrection(params, result.heightData); },
+                                "HeightGen_SphericalCorrection", "Failed to apply spherical correction",
+                                0.9f, "Spherical correction applied"));
+    }
+    chain.Then(makeStageJob([&] { return PostProcessHeight(params, result.heightData); },
+                            "HeightGen_PostProcess", "Failed to post-process height data",
+                            0.95f, "Post-processing complete"));
+
+    // Schedule the independent tiles first, then the dependent chain.
+    auto noiseHandles = jobSystem.ScheduleBatch(jobs);
+    auto chainHandles = chain.Schedule();
+
+    try {
+        for (auto& handle : noiseHandles) {
+            handle.Wait();
+        }
+        for (auto& handle : chainHandles) {
+            handle.Wait();
+        }
+    } catch (const std::exception& e) {
+        failStage(std::string("Generation failed: ") + e.what());
+    }
+
+    // All handles are complete; reclaim the graph.
+    for (auto* job : jobs) {
+        delete job;
+    }
+    for (auto* job : chainJobs) {
+        delete job;
+    }
+
+    if (failed.load(std::memory_order_acquire)) {
+        result.success = false;
+        std::lock_guard<std::mutex> lock(errorMutex);
+        result.errorMessage = errorMessage;
+        return result;
+    }
+
+    // Calculate statistics
+    auto minMax = std::minmax_element(result.heightData.begin(), result.heightData.end());
+    result.minHeight = *minMax.first;
+    result.maxHeight = *minMax.second;
+    result.averageHeight = std::accumulate(result.heightData.begin(), result.heightData.end(), 0.0f) / result.heightData.size();
+
+    float variance = 0.0f;
+    for (float height : result.heightData) {
+        float diff = height - result.averageHeight;
+        variance += diff * diff;
+    }
+    variance /= result.heightData.size();
+    result.standardDeviation = std::sqrt(variance);
+
+    result.success = true;
+    result.memoryUsed = result.heightData.size() * sizeof(float);
+    return result;
+}
+
 bool AdvancedHeightGenerator::GenerateBaseNoise(const HeightGenerationParameters& params, std::vector<float>& heightData) {
     // Use VulkanNoiseGenerator for GPU-accelerated noise generation
     PlanetGen::Rendering::Noise::GPUNoiseParameters noiseParams;
@@ -556,37 +1172,42 @@ bool AdvancedHeightGenerator::GenerateBaseNoise(const HeightGenerationParameters
     );
 }
 
+bool AdvancedHeightGenerator::GenerateLayerNoise(const HeightGenerationParameters& params, const AdvancedNoiseLayer& layer, std::vector<float>& layerData) {
+    layerData.resize(static_cast<size_t>(params.performance.resolution) * params.performance.resolution);
+
+    PlanetGen::Rendering::Noise::GPUNoiseParameters noiseParams;
+    noiseParams.type = layer.noiseParams.type;
+    noiseParams.seed = layer.noiseParams.seed;
+    noiseParams.frequency = layer.noiseParams.frequency;
+    noiseParams.octaves = layer.noiseParams.octaves;
+    noiseParams.persistence = layer.noiseParams.persistence;
+    noiseParams.lacunarity = layer.noiseParams.lacunarity;
+    noiseParams.offset = layer.noiseParams.offset;
+    noiseParams.amplitude = layer.noiseParams.amplitude;
+    noiseParams.useRidgedNoise = layer.noiseParams.useRidgedNoise;
+    noiseParams.ridgeOffset = layer.noiseParams.ridgeOffset;
+    noiseParams.width = params.performance.resolution;
+    noiseParams.height = params.performance.resolution;
+
+    return m_noiseGenerator->GenerateNoise2D(
+        noiseParams,
+        layerData.data(),
+        params.performance.resolution,
+        params.performance.resolution);
+}
+
 bool AdvancedHeightGenerator::ApplyNoiseLayers(const HeightGenerationParameters& params, std::vector<float>& heightData) {
     // Apply additional noise layers
     for (const auto& layer : params.noiseLayers) {
-        std::vector<float> layerData(heightData.size());
-        
-        PlanetGen::Rendering::Noise::GPUNoiseParameters noiseParams;
-        noiseParams.type = layer.noiseParams.type;
-        noiseParams.seed = layer.noiseParams.seed;
-        noiseParams.frequency = layer.noiseParams.frequency;
-        noiseParams.octaves = layer.noiseParams.octaves;
-        noiseParams.persistence = layer.noiseParams.persistence;
-        noiseParams.lacunarity = layer.noiseParams.lacunarity;
-        noiseParams.offset = layer.noiseParams.offset;
-        noiseParams.amplitude = layer.noiseParams.amplitude;
-        noiseParams.useRidgedNoise = layer.noiseParams.useRidgedNoise;
-        noiseParams.ridgeOffset = layer.noiseParams.ridgeOffset;
-        noiseParams.width = params.performance.resolution;
-        noiseParams.height = params.performance.resolution;
-        
-        if (!m_noiseGenerator->GenerateNoise2D(
-            noiseParams,
-            layerData.data(),
-            params.performance.resolution,
-            params.performance.resolution)) {
+        std::vector<float> layerData;
+        if (!GenerateLayerNoise(params, layer, layerData)) {
             return false;
         }
-        
+
         // Blend layer with existing height data
         for (size_t i = 0; i < heightData.size(); ++i) {
             float layerValue = layerData[i] * layer.weight;
-            
+
             if (layer.additive) {
                 heightData[i] += layerValue;
             } else {
@@ -594,7 +1215,7 @@ bool AdvancedHeightGenerator::ApplyNoiseLayers(const HeightGenerationParameters&
             }
         }
     }
-    
+
     return true;
 }
 
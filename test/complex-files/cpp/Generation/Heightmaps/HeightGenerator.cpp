@@ -2,12 +2,17 @@ module;
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <future>
+#include <limits>
 #include <stdexcept>
+#include <vector>
 
 module HeightGenerator;
 
 import NoiseTypes;
 import IGPUNoiseAccelerator;
+import ThreadPool;
 
 namespace PlanetGen::Generation {
 
@@ -30,17 +35,21 @@ bool HeightGenerator::GenerateHeightmap(
         return false;
     }
 
-    // Prepare coordinates for the heightmap
-    std::vector<std::pair<float, float>> coordinates;
-    coordinates.reserve(width * height);
-    
-    for (uint32_t y = 0; y < height; ++y) {
-        for (uint32_t x = 0; x < width; ++x) {
-            float u = static_cast<float>(x) / static_cast<float>(width - 1);
+    // Prepare coordinates for the heightmap, partitioned by row so each
+    // worker writes a disjoint slice of the preallocated vector.
+    std::vector<std::pair<float, float>> coordinates(
+        static_cast<size_t>(width) * height);
+
+    ParallelFor(height, [&](size_t rowBegin, size_t rowEnd) {
+        for (size_t y = rowBegin; y < rowEnd; ++y) {
             float v = static_cast<float>(y) / static_cast<float>(height - 1);
-            coordinates.emplace_back(u * worldScale, v * worldScale);
+            size_t rowOffset = y * width;
+            for (uint32_t x = 0; x < width; ++x) {
+                float u = static_cast<float>(x) / static_cast<float>(width - 1);
+                coordinates[rowOffset + x] = {u * worldScale, v * worldScale};
+            }
         }
-    }
+    });
 
     // Generate using GPU noise accelerator
     outHeights.resize(width * height);
@@ -48,7 +57,7 @@ bool HeightGenerator::GenerateHeightmap(
         coordinates, layers, worldScale, seaLevel, 1.0f, outHeights);
 
     if (success) {
-        ApplySeaLevel(outHeights, seaLevel);
+        ApplySeaLevelAndScale(outHeights, seaLevel, 1.0f);
     }
 
     return success;
@@ -71,7 +80,7 @@ bool HeightGenerator::GeneratePlanetaryElevation(
         coordinates, layers, worldScale, seaLevel, elevationScale, outElevation);
 
     if (success && elevationScale != 1.0f) {
-        ApplyElevationScale(outElevation, elevationScale);
+        ApplySeaLevelAndScale(outElevation, std::numeric_limits<float>::lowest(), elevationScale);
     }
 
     return success;
@@ -126,15 +135,36 @@ bool HeightGenerator::ValidateParameters(
     return true;
 }
 
-void HeightGenerator::ApplySeaLevel(std::vector<float>& heights, float seaLevel) {
-    for (auto& height : heights) {
-        height = std::max(height, seaLevel);
-    }
+void HeightGenerator::ApplySeaLevelAndScale(std::vector<float>& heights, float seaLevel, float scale) {
+    // One fused sweep instead of a sea-level pass followed by a scale pass.
+    ParallelFor(heights.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            heights[i] = std::max(heights[i], seaLevel) * scale;
+        }
+    });
 }
 
-void HeightGenerator::ApplyElevationScale(std::vector<float>& heights, float scale) {
-    for (auto& height : heights) {
-        height *= scale;
+void HeightGenerator::ParallelFor(size_t count, const std::function<void(size_t, size_t)>& body) {
+    // Small ranges are not worth the enqueue overhead.
+    constexpr size_t kParallelThreshold = 4096;
+    if (!m_threadPool || count < kParallelThreshold) {
+        body(0, count);
+        return;
+    }
+
+    const size_t workers = std::max<size_t>(m_threadPool->GetWorkerCount(), 1);
+    const size_t chunk = (count + workers - 1) / workers;
+
+    std::vector<std::future<void>> pending;
+    pending.reserve(workers);
+    for (size_t begin = 0; begin < count; begin += chunk) {
+        const size_t end = std::min(begin + chunk, count);
+        pending.push_back(m_threadPool->Enqueue([&body, begin, end] {
+            body(begin, end);
+        }));
+    }
+    for (auto& future : pending) {
+        future.get();
     }
 }
 
@@ -5,9 +5,11 @@ module;
 #define M_PI 3.14159265358979323846
 #endif
 
+#include <cstddef>
 #include <memory>
 #include <cmath>
 #include <algorithm>
+#include <vector>
 
 module DomainWarpedNoise;
 
@@ -28,7 +30,8 @@ DomainWarpedNoise::DomainWarpedNoise(std::unique_ptr<INoiseGenerator> baseNoise,
       m_frequency(frequency),
       m_octaves(std::max(1, octaves)),
       m_enableMultiLevel(false),
-      m_warpLevels(2) {
+      m_warpLevels(2),
+      m_fusedEvaluation(false) {
     
     // Initialize default warp parameters
     m_warpParams = WarpParameters{};
@@ -51,11 +54,17 @@ DomainWarpedNoise::DomainWarpedNoise(std::unique_ptr<INoiseGenerator> baseNoise,
     );
     m_rotationNoise = std::make_unique<SimpleNoise::NoiseProvider>(0.5f, 2.0f, 2);
     m_turbulenceNoise = std::make_unique<SimpleNoise::NoiseProvider>(0.6f, 2.0f, 3);
+    // Single-octave provider driven directly by the fused octave walk
+    m_fusedWarpOctave = std::make_unique<SimpleNoise::NoiseProvider>(0.5f, 2.0f, 1);
 }
 
 float DomainWarpedNoise::GetNoise(float x, float y, float z) {
     if (!m_baseNoise) return 0.0f;
-    
+
+    if (m_fusedEvaluation && CanUseFusedPath()) {
+        return GetNoiseFused(x, y, z);
+    }
+
     // Compute warp offset
     vec3 warpOffset = ComputeWarpOffset(x, y, z);
     
@@ -113,6 +122,88 @@ void DomainWarpedNoise::SetBaseNoise(std::unique_ptr<INoiseGenerator> baseNoise)
     m_baseNoise = std::move(baseNoise);
 }
 
+bool DomainWarpedNoise::CanUseFusedPath() const {
+    return !m_enableMultiLevel && !m_warpParams.enableRotation &&
+           !m_warpParams.enableTurbulence;
+}
+
+float DomainWarpedNoise::GetNoiseFused(float x, float y, float z) {
+    // One octave walk produces all three warp channels: the
+    // frequency/amplitude ramp is computed once and the channel samples for
+    // an octave run back to back while the permutation/gradient tables are
+    // hot, instead of three independent FractalNoise traversals.
+    const float warpFreq = m_warpParams.warpFrequency * m_frequency;
+    float amplitude = 1.0f;
+    float frequency = warpFreq;
+    float maxValue = 0.0f;
+    float warpX = 0.0f;
+    float warpY = 0.0f;
+    float warpZ = 0.0f;
+
+    for (int i = 0; i < m_warpParams.warpOctaves; i++) {
+        warpX += m_fusedWarpOctave->GetNoise(x * frequency, y * frequency,
+                                             z * frequency) * amplitude;
+        warpY += m_fusedWarpOctave->GetNoise((x + 100.0f) * frequency,
+                                             (y + 100.0f) * frequency,
+                                             (z + 100.0f) * frequency) * amplitude;
+        warpZ += m_fusedWarpOctave->GetNoise((x + 200.0f) * frequency,
+                                             (y + 200.0f) * frequency,
+                                             (z + 200.0f) * frequency) * amplitude;
+        maxValue += amplitude;
+        amplitude *= m_warpParams.warpPersistence;
+        frequency *= m_warpParams.warpLacunarity;
+    }
+
+    const float scale = m_warpParams.warpStrength / maxValue;
+    return m_baseNoise->GetNoise(x + warpX * scale, y + warpY * scale,
+                                 z + warpZ * scale);
+}
+
+void DomainWarpedNoise::GetNoiseBatch(const float* xs, const float* ys,
+                                      const float* zs, float* out,
+                                      size_t count) {
+    if (count == 0) return;
+    if (!m_baseNoise) {
+        std::fill(out, out + count, 0.0f);
+        return;
+    }
+    if (!CanUseFusedPath()) {
+        // Rotation/turbulence/multi-level configurations keep the general
+        // per-sample path.
+        for (size_t i = 0; i < count; i++) {
+            out[i] = GetNoise(xs[i], ys[i], zs[i]);
+        }
+        return;
+    }
+
+    // Warp channels go through the vectorized NoiseProvider batch kernels;
+    // the scratch coordinate buffers are rescaled per channel.
+    const float warpFreq = m_warpParams.warpFrequency * m_frequency;
+    std::vector<float> sx(count), sy(count), sz(count);
+    std::vector<float> warpX(count), warpY(count), warpZ(count);
+
+    auto scaleInputs = [&](float offset) {
+        for (size_t i = 0; i < count; i++) {
+            sx[i] = (xs[i] + offset) * warpFreq;
+            sy[i] = (ys[i] + offset) * warpFreq;
+            sz[i] = (zs[i] + offset) * warpFreq;
+        }
+    };
+    scaleInputs(0.0f);
+    m_warpNoiseX->GetNoiseBatch(sx.data(), sy.data(), sz.data(), warpX.data(), count);
+    scaleInputs(100.0f);
+    m_warpNoiseY->GetNoiseBatch(sx.data(), sy.data(), sz.data(), warpY.data(), count);
+    scaleInputs(200.0f);
+    m_warpNoiseZ->GetNoiseBatch(sx.data(), sy.data(), sz.data(), warpZ.data(), count);
+
+    const float strength = m_warpParams.warpStrength;
+    for (size_t i = 0; i < count; i++) {
+        out[i] = m_baseNoise->GetNoise(xs[i] + warpX[i] * strength,
+                                       ys[i] + warpY[i] * strength,
+                                       zs[i] + warpZ[i] * strength);
+    }
+}
+
 vec3 DomainWarpedNoise::ComputeWarpOffset(float x, float y, float z) const {
     return ComputeWarpOffset(vec3(x, y, z));
 }
@@ -1,5 +1,8 @@
 module;
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 #include <glm/glm.hpp>
@@ -8,6 +11,7 @@ module GPUNoiseGenerator;
 
 import VulkanNoiseGenerator;
 import NoiseTypes;
+import IGPUNoiseAccelerator;
 
 namespace PlanetGen::Rendering::Noise {
 
@@ -45,14 +49,72 @@ NoiseType GPUNoiseGenerator::GetNoiseType() const {
     return m_noiseType;
 }
 
+namespace {
+// One compute dispatch per chunk; two chunks stay in flight so the CPU packs
+// and submits batch N+1 while the GPU still executes batch N.
+constexpr size_t kSampleBatchChunk = 65536;
+}
+
 std::vector<float> GPUNoiseGenerator::SampleBatch(const std::vector<glm::vec3>& positions) const {
-    std::vector<float> results;
-    results.reserve(positions.size());
-    
-    for (const auto& pos : positions) {
-        results.push_back(const_cast<GPUNoiseGenerator*>(this)->GetNoise(pos));
+    return SampleBatch(positions.data(), positions.size());
+}
+
+std::vector<float> GPUNoiseGenerator::SampleBatch(const glm::vec3* positions, size_t positionCount) const {
+    std::vector<float> results(positionCount);
+    if (positionCount == 0) {
+        return results;
     }
-    
+
+    if (m_gpuGenerator) {
+        using AsyncNoiseHandle = PlanetGen::Generation::IGPUNoiseAccelerator::AsyncNoiseHandle;
+        struct InFlightChunk {
+            std::optional<AsyncNoiseHandle> handle;
+            size_t offset = 0;
+        };
+        InFlightChunk chunks[2];
+        size_t submitted = 0;
+        bool gpuOk = true;
+
+        auto submit = [&](InFlightChunk& slot) {
+            const size_t count = std::min(kSampleBatchChunk, positionCount - submitted);
+            slot.handle = m_gpuGenerator->BeginNoiseGenerationAtPositions(
+                m_params, positions + submitted, static_cast<uint32_t>(count));
+            slot.offset = submitted;
+            submitted += count;
+            return slot.handle.has_value();
+        };
+        auto readback = [&](InFlightChunk& slot) {
+            if (!slot.handle) {
+                return true;
+            }
+            bool ok = m_gpuGenerator->EndNoiseGeneration(*slot.handle, results.data() + slot.offset);
+            slot.handle.reset();
+            return ok;
+        };
+
+        int current = 0;
+        gpuOk = submit(chunks[current]);
+        while (gpuOk && submitted < positionCount) {
+            // Queue the next chunk before reading back the previous one so
+            // upload and compute overlap with the readback copy.
+            const int next = current ^ 1;
+            const bool submitOk = submit(chunks[next]);
+            const bool readbackOk = readback(chunks[current]);
+            gpuOk = submitOk && readbackOk;
+            current = next;
+        }
+        const bool finalOk = readback(chunks[current]);
+        if (gpuOk && finalOk) {
+            return results;
+        }
+        std::cerr << "[GPUNoiseGenerator] Batched dispatch unavailable, using per-sample path" << std::endl;
+    }
+
+    // Fallback: one round-trip per sample through GetNoise.
+    for (size_t i = 0; i < positionCount; ++i) {
+        results[i] = const_cast<GPUNoiseGenerator*>(this)->GetNoise(positions[i]);
+    }
+
     return results;
 }
 
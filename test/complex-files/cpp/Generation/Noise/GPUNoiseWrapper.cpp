@@ -1,4 +1,6 @@
 module;
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <iostream>
@@ -16,6 +18,7 @@ import WorleyNoise;
 import GPUNoiseTypes;
 import GLMModule;
 import VulkanResourceManager;
+import NoiseTileCache;
 
 namespace PlanetGen::Rendering::Noise {
 
@@ -102,6 +105,65 @@ public:
         return GenerateNoiseMapCPU(startX, startZ, width, depth, stepSize);
     }
 
+    std::vector<float> GenerateNoiseMapTiled(float startX, float startZ, int width,
+                                             int depth, float stepSize, int tileSize,
+                                             NoiseMapLayout layout) const {
+        if (!m_initialized || width <= 0 || depth <= 0) {
+            return std::vector<float>(std::max(0, width) * std::max(0, depth), 0.0f);
+        }
+        tileSize = std::max(1, tileSize);
+
+        const int tilesX = (width + tileSize - 1) / tileSize;
+        const int tilesZ = (depth + tileSize - 1) / tileSize;
+        const size_t tileFloats = static_cast<size_t>(tileSize) * tileSize;
+
+        std::vector<float> result;
+        if (layout == NoiseMapLayout::RowMajor) {
+            result.assign(static_cast<size_t>(width) * depth, 0.0f);
+        } else if (layout == NoiseMapLayout::Morton) {
+            // Morton addressing needs a power-of-two square tile grid.
+            const size_t side = NextPow2(static_cast<uint32_t>(std::max(tilesX, tilesZ)));
+            result.assign(side * side * tileFloats, 0.0f);
+        } else {
+            // Padded layout: every tile slot is a full tileSize^2 block so
+            // consumers can index tiles without per-tile bounds math.
+            result.assign(static_cast<size_t>(tilesX) * tilesZ * tileFloats, 0.0f);
+        }
+
+        for (int tz = 0; tz < tilesZ; ++tz) {
+            for (int tx = 0; tx < tilesX; ++tx) {
+                const int tileW = std::min(tileSize, width - tx * tileSize);
+                const int tileD = std::min(tileSize, depth - tz * tileSize);
+                const float tileStartX = startX + tx * tileSize * stepSize;
+                const float tileStartZ = startZ + tz * tileSize * stepSize;
+
+                auto tile = GenerateTileCached(tileStartX, tileStartZ, tileW, tileD, stepSize);
+
+                if (layout == NoiseMapLayout::RowMajor) {
+                    for (int z = 0; z < tileD; ++z) {
+                        float* dst = result.data() +
+                                     static_cast<size_t>(tz * tileSize + z) * width +
+                                     tx * tileSize;
+                        const float* src = tile->data() + static_cast<size_t>(z) * tileW;
+                        std::copy(src, src + tileW, dst);
+                    }
+                } else {
+                    const size_t tileIndex =
+                        (layout == NoiseMapLayout::Morton)
+                            ? MortonEncode2D(static_cast<uint32_t>(tx), static_cast<uint32_t>(tz))
+                            : static_cast<size_t>(tz) * tilesX + tx;
+                    float* dst = result.data() + tileIndex * tileFloats;
+                    for (int z = 0; z < tileD; ++z) {
+                        const float* src = tile->data() + static_cast<size_t>(z) * tileW;
+                        std::copy(src, src + tileW, dst + static_cast<size_t>(z) * tileSize);
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
     void SetSeed(int seed) { 
         m_seed = seed; 
         m_gpuParams.seed = seed;
@@ -182,6 +244,63 @@ private:
     // CPU noise generators cache
     std::unordered_map<NoiseType, std::unique_ptr<INoiseGenerator>> m_cpuGenerators;
 
+    // Serves a tile from the process-wide LRU cache when an identical tile
+    // (same generator parameters and world window) was generated before,
+    // e.g. by a previous evolutionary candidate that did not mutate this
+    // layer; otherwise generates and publishes it.
+    std::shared_ptr<const std::vector<float>> GenerateTileCached(
+        float tileStartX, float tileStartZ, int tileW, int tileD, float stepSize) const {
+        NoiseTileKey key;
+        key.type = m_currentNoiseType;
+        key.seed = m_seed;
+        key.frequency = m_frequency;
+        key.octaves = m_octaves;
+        key.persistence = m_gpuParams.persistence;
+        key.lacunarity = m_gpuParams.lacunarity;
+        key.amplitude = m_gpuParams.amplitude;
+        key.startX = tileStartX;
+        key.startZ = tileStartZ;
+        key.stepSize = stepSize;
+        key.width = tileW;
+        key.depth = tileD;
+
+        if (auto cached = NoiseTileCache::Instance().Get(key)) {
+            return cached;
+        }
+
+        std::vector<float> tile;
+        if (m_preferGPU && IsGPUSupported(m_currentNoiseType)) {
+            tile = GenerateNoiseMapGPU(tileStartX, tileStartZ, tileW, tileD, stepSize);
+        }
+        if (tile.empty()) {
+            tile = GenerateNoiseMapCPU(tileStartX, tileStartZ, tileW, tileD, stepSize);
+        }
+
+        auto shared = std::make_shared<const std::vector<float>>(std::move(tile));
+        NoiseTileCache::Instance().Put(key, shared);
+        return shared;
+    }
+
+    static uint32_t NextPow2(uint32_t v) {
+        uint32_t p = 1;
+        while (p < v) p <<= 1;
+        return p;
+    }
+
+    // Interleaves the bits of (x, z) into a Z-order tile index.
+    static size_t MortonEncode2D(uint32_t x, uint32_t z) {
+        auto spread = [](uint32_t v) -> uint64_t {
+            uint64_t r = v;
+            r = (r | (r << 16)) & 0x0000FFFF0000FFFFull;
+            r = (r | (r << 8))  & 0x00FF00FF00FF00FFull;
+            r = (r | (r << 4))  & 0x0F0F0F0F0F0F0F0Full;
+            r = (r | (r << 2))  & 0x3333333333333333ull;
+            r = (r | (r << 1))  & 0x5555555555555555ull;
+            return r;
+        };
+        return static_cast<size_t>(spread(x) | (spread(z) << 1));
+    }
+
     bool IsGPUSupported(NoiseType type) const {
         // Currently, VulkanNoiseGenerator supports Simplex and Worley on GPU
         return (type == NoiseType::Simplex || 
@@ -358,6 +477,13 @@ std::vector<float> GPUNoiseWrapper::GenerateNoiseMap(float startX, float startZ,
     return m_pimpl->GenerateNoiseMap(startX, startZ, width, depth, stepSize);
 }
 
+std::vector<float> GPUNoiseWrapper::GenerateNoiseMapTiled(
+    float startX, float startZ, int width, int depth, float stepSize,
+    int tileSize, NoiseMapLayout layout) const {
+    return m_pimpl->GenerateNoiseMapTiled(startX, startZ, width, depth,
+                                          stepSize, tileSize, layout);
+}
+
 // Enhanced API methods
 void GPUNoiseWrapper::SetNoiseType(NoiseType type) {
     m_pimpl->SetNoiseType(type);
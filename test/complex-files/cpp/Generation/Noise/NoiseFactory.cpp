@@ -17,12 +17,19 @@ import BillowNoise;
 import VolcanicNoise;
 import StarFieldNoise;
 import DomainWarpedNoise;
+import FractalCombinators;
 
 namespace PlanetGen::Rendering::Noise {
 
 std::unique_ptr<INoiseGenerator> NoiseFactory::Create(NoiseType type, int seed,
                                                       float frequency,
                                                       int octaves) {
+  // Prefer the compile-time devirtualized fractal path for configurations
+  // fixed at creation; everything else keeps the virtual generators.
+  if (auto fixedOctave = CreateFixedOctave(type, seed, frequency, octaves)) {
+    return fixedOctave;
+  }
+
   // CPU-only implementations
   switch (type) {
     case NoiseType::SimpleNoise:
@@ -53,6 +60,21 @@ std::unique_ptr<INoiseGenerator> NoiseFactory::Create(NoiseType type, int seed,
   }
 }
 
+std::unique_ptr<INoiseGenerator> NoiseFactory::CreateFixedOctave(
+    NoiseType type, int seed, float frequency, int octaves) {
+  switch (type) {
+    case NoiseType::Simplex:
+    case NoiseType::SimpleNoise:
+      return MakeFixedOctaveFractal<SimplexKernel>(octaves, seed, frequency);
+    case NoiseType::RidgedNoise:
+      return MakeFixedOctaveFractal<RidgedKernel>(octaves, seed, frequency);
+    case NoiseType::BillowNoise:
+      return MakeFixedOctaveFractal<BillowKernel>(octaves, seed, frequency);
+    default:
+      return nullptr;
+  }
+}
+
 std::unique_ptr<INoiseGenerator> NoiseFactory::CreateSimpleNoise(
     int seed, float frequency, int octaves) {
   return std::make_unique<SimpleNoiseWrapper>(seed, frequency, octaves);
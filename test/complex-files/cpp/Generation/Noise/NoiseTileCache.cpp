@@ -0,0 +1,121 @@
+module;
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+module NoiseTileCache;
+
+namespace PlanetGen::Rendering::Noise {
+
+namespace {
+
+uint64_t MixHash(uint64_t h, uint64_t v) {
+  h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+  return h;
+}
+
+uint64_t FloatBits(float f) {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &f, sizeof(bits));
+  return bits;
+}
+
+}  // namespace
+
+size_t NoiseTileKeyHash::operator()(const NoiseTileKey& key) const {
+  uint64_t h = static_cast<uint64_t>(key.type);
+  h = MixHash(h, static_cast<uint32_t>(key.seed));
+  h = MixHash(h, FloatBits(key.frequency));
+  h = MixHash(h, static_cast<uint32_t>(key.octaves));
+  h = MixHash(h, FloatBits(key.persistence));
+  h = MixHash(h, FloatBits(key.lacunarity));
+  h = MixHash(h, FloatBits(key.amplitude));
+  h = MixHash(h, FloatBits(key.startX));
+  h = MixHash(h, FloatBits(key.startZ));
+  h = MixHash(h, FloatBits(key.stepSize));
+  h = MixHash(h, static_cast<uint32_t>(key.width));
+  h = MixHash(h, static_cast<uint32_t>(key.depth));
+  return static_cast<size_t>(h);
+}
+
+NoiseTileCache& NoiseTileCache::Instance() {
+  static NoiseTileCache s_instance;
+  return s_instance;
+}
+
+std::shared_ptr<const std::vector<float>> NoiseTileCache::Get(
+    const NoiseTileKey& key) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_index.find(key);
+  if (it == m_index.end()) {
+    m_stats.misses++;
+    return nullptr;
+  }
+  // Refresh recency.
+  m_lru.splice(m_lru.begin(), m_lru, it->second);
+  m_stats.hits++;
+  return it->second->data;
+}
+
+void NoiseTileCache::Put(const NoiseTileKey& key,
+                         std::shared_ptr<const std::vector<float>> tile) {
+  if (!tile) {
+    return;
+  }
+  const size_t tileBytes = tile->size() * sizeof(float);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_index.find(key);
+  if (it != m_index.end()) {
+    m_bytes -= it->second->data->size() * sizeof(float);
+    it->second->data = std::move(tile);
+    m_bytes += tileBytes;
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+  } else {
+    m_lru.push_front(Entry{key, std::move(tile)});
+    m_index[key] = m_lru.begin();
+    m_bytes += tileBytes;
+  }
+
+  while (m_bytes > m_capacityBytes && !m_lru.empty()) {
+    Entry& victim = m_lru.back();
+    m_bytes -= victim.data->size() * sizeof(float);
+    m_index.erase(victim.key);
+    m_lru.pop_back();
+    m_stats.evictions++;
+  }
+  m_stats.bytes = m_bytes;
+}
+
+void NoiseTileCache::SetCapacityBytes(size_t bytes) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_capacityBytes = bytes;
+  while (m_bytes > m_capacityBytes && !m_lru.empty()) {
+    Entry& victim = m_lru.back();
+    m_bytes -= victim.data->size() * sizeof(float);
+    m_index.erase(victim.key);
+    m_lru.pop_back();
+    m_stats.evictions++;
+  }
+  m_stats.bytes = m_bytes;
+}
+
+void NoiseTileCache::Clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_lru.clear();
+  m_index.clear();
+  m_bytes = 0;
+  m_stats.bytes = 0;
+}
+
+NoiseTileCache::Stats NoiseTileCache::GetStats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats;
+}
+
+}  // namespace PlanetGen::Rendering::Noise
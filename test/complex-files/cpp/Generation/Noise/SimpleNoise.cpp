@@ -1,33 +1,23 @@
 module;
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <random>
 #include <stdexcept>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 module SimpleNoise;
 
 import GLMModule;
+import NoiseTableRegistry;
 
 namespace SimpleNoise {
-static constexpr std::array<uint8_t, 256> PERM = {
-    151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,
-    225, 140, 36,  103, 30,  69,  142, 8,   99,  37,  240, 21,  10,  23,  190,
-    6,   148, 247, 120, 234, 75,  0,   26,  197, 62,  94,  252, 219, 203, 117,
-    35,  11,  32,  57,  177, 33,  88,  237, 149, 56,  87,  174, 20,  125, 136,
-    171, 168, 68,  175, 74,  165, 71,  134, 139, 48,  27,  166, 77,  146, 158,
-    231, 83,  111, 229, 122, 60,  211, 133, 230, 220, 105, 92,  41,  55,  46,
-    245, 40,  244, 102, 143, 54,  65,  25,  63,  161, 1,   216, 80,  73,  209,
-    76,  132, 187, 208, 89,  18,  169, 200, 196, 135, 130, 116, 188, 159, 86,
-    164, 100, 109, 198, 173, 186, 3,   64,  52,  217, 226, 250, 124, 123, 5,
-    202, 38,  147, 118, 126, 255, 82,  85,  212, 207, 206, 59,  227, 47,  16,
-    58,  17,  182, 189, 28,  42,  223, 183, 170, 213, 119, 248, 152, 2,   44,
-    154, 163, 70,  221, 153, 101, 155, 167, 43,  172, 9,   129, 22,  39,  253,
-    19,  98,  108, 110, 79,  113, 224, 232, 178, 185, 112, 104, 218, 246, 97,
-    228, 251, 34,  242, 193, 238, 210, 144, 12,  191, 179, 162, 241, 81,  51,
-    145, 235, 249, 14,  239, 107, 49,  192, 214, 31,  181, 199, 106, 157, 184,
-    84,  204, 176, 115, 121, 50,  45,  127, 4,   150, 254, 138, 236, 205, 93,
-    222, 114, 67,  29,  24,  72,  243, 141, 128, 195, 78,  66,  215, 61,  156,
-    180};
 static constexpr std::array<vec3, 12> GRAD3 = {
     vec3(1.0f, 1.0f, 0.0f),  vec3(-1.0f, 1.0f, 0.0f),
     vec3(1.0f, -1.0f, 0.0f), vec3(-1.0f, -1.0f, 0.0f),
@@ -35,6 +25,15 @@ static constexpr std::array<vec3, 12> GRAD3 = {
     vec3(1.0f, 0.0f, -1.0f), vec3(-1.0f, 0.0f, -1.0f),
     vec3(0.0f, 1.0f, 1.0f),  vec3(0.0f, -1.0f, 1.0f),
     vec3(0.0f, 1.0f, -1.0f), vec3(0.0f, -1.0f, -1.0f)};
+// Structure-of-arrays view of GRAD3 so a gathered gradient index can fetch
+// each component independently.
+static constexpr std::array<float, 12> GRAD3X = {
+    1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+static constexpr std::array<float, 12> GRAD3Y = {
+    1.0f, 1.0f, -1.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, -1.0f, 1.0f, -1.0f};
+static constexpr std::array<float, 12> GRAD3Z = {
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f};
+
 static float Dot(const vec3& a, const vec3& b) {
   return dot(a, b);  // Use GLM's dot product
 }
@@ -46,8 +45,171 @@ static float Fade(float t) {
 static int FastFloor(float x) {
   return (x > 0.0f) ? static_cast<int>(x) : static_cast<int>(x - 1.0f);
 }
+
+#if defined(__AVX2__)
+
+static __m256 Fade8(__m256 t) {
+  // t^3 * (t * (t * 6 - 15) + 10)
+  __m256 t3 = _mm256_mul_ps(_mm256_mul_ps(t, t), t);
+  __m256 a = _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)),
+                           _mm256_set1_ps(15.0f));
+  __m256 b = _mm256_add_ps(_mm256_mul_ps(t, a), _mm256_set1_ps(10.0f));
+  return _mm256_mul_ps(t3, b);
+}
+
+static __m256 Mix8(__m256 a, __m256 b, __m256 t) {
+  return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+}
+
+// Dot product of GRAD3[perm[latticeIdx] % 12] with (x, y, z) for 8 lanes.
+static __m256 GradDot8(const NoiseTables& tables, __m256i latticeIdx, __m256 x,
+                       __m256 y, __m256 z) {
+  __m256i gi = _mm256_i32gather_epi32(tables.permMod12.data(), latticeIdx, 4);
+  __m256 gx = _mm256_i32gather_ps(GRAD3X.data(), gi, 4);
+  __m256 gy = _mm256_i32gather_ps(GRAD3Y.data(), gi, 4);
+  __m256 gz = _mm256_i32gather_ps(GRAD3Z.data(), gi, 4);
+  return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(gx, x), _mm256_mul_ps(gy, y)),
+                       _mm256_mul_ps(gz, z));
+}
+
+// 8-lane port of NoiseProvider::SimplexNoise. The permutation chain mirrors
+// the scalar path exactly; gradient dots come from the SoA GRAD3 tables.
+static __m256 SimplexNoise8(const NoiseTables& tables, __m256 x, __m256 y,
+                            __m256 z) {
+  const __m256i wrap = _mm256_set1_epi32(255);
+  const __m256i one = _mm256_set1_epi32(1);
+
+  __m256 fx = _mm256_floor_ps(x);
+  __m256 fy = _mm256_floor_ps(y);
+  __m256 fz = _mm256_floor_ps(z);
+  __m256i X = _mm256_and_si256(_mm256_cvttps_epi32(fx), wrap);
+  __m256i Y = _mm256_and_si256(_mm256_cvttps_epi32(fy), wrap);
+  __m256i Z = _mm256_and_si256(_mm256_cvttps_epi32(fz), wrap);
+  x = _mm256_sub_ps(x, fx);
+  y = _mm256_sub_ps(y, fy);
+  z = _mm256_sub_ps(z, fz);
+
+  __m256i Z1 = _mm256_add_epi32(Z, one);
+  __m256i permX = _mm256_i32gather_epi32(tables.perm32.data(), X, 4);
+  __m256i permXY = _mm256_and_si256(_mm256_add_epi32(permX, Y), wrap);
+  permXY = _mm256_i32gather_epi32(tables.perm32.data(), permXY, 4);
+  __m256i permX1Y = _mm256_and_si256(
+      _mm256_add_epi32(permX, _mm256_add_epi32(Y, one)), wrap);
+  permX1Y = _mm256_i32gather_epi32(tables.perm32.data(), permX1Y, 4);
+  __m256i permX1 = _mm256_i32gather_epi32(
+      tables.perm32.data(), _mm256_and_si256(_mm256_add_epi32(X, one), wrap), 4);
+  __m256i permX1Y1 = _mm256_and_si256(_mm256_add_epi32(permX1, Y), wrap);
+  permX1Y1 = _mm256_i32gather_epi32(tables.perm32.data(), permX1Y1, 4);
+
+  __m256i iXYZ = _mm256_and_si256(_mm256_add_epi32(permXY, Z), wrap);
+  __m256i iXYZ1 = _mm256_and_si256(_mm256_add_epi32(permXY, Z1), wrap);
+  __m256i iX1YZ = _mm256_and_si256(_mm256_add_epi32(permX1Y, Z), wrap);
+  __m256i iX1YZ1 = _mm256_and_si256(_mm256_add_epi32(permX1Y, Z1), wrap);
+  __m256i iX1Y1Z = _mm256_and_si256(_mm256_add_epi32(permX1Y1, Z), wrap);
+  __m256i iX1Y1Z1 = _mm256_and_si256(_mm256_add_epi32(permX1Y1, Z1), wrap);
+
+  const __m256 m1 = _mm256_set1_ps(1.0f);
+  __m256 xm1 = _mm256_sub_ps(x, m1);
+  __m256 ym1 = _mm256_sub_ps(y, m1);
+  __m256 zm1 = _mm256_sub_ps(z, m1);
+
+  __m256 n000 = GradDot8(tables, iXYZ, x, y, z);
+  __m256 n001 = GradDot8(tables, iXYZ1, x, y, zm1);
+  __m256 n010 = GradDot8(tables, iX1YZ, x, ym1, z);
+  __m256 n011 = GradDot8(tables, iX1YZ1, x, ym1, zm1);
+  __m256 n100 = GradDot8(tables, iX1Y1Z, xm1, y, z);
+  __m256 n101 = GradDot8(tables, iX1Y1Z1, xm1, y, zm1);
+  __m256 n110 = GradDot8(tables, iX1Y1Z, xm1, ym1, z);
+  __m256 n111 = GradDot8(tables, iX1Y1Z1, xm1, ym1, zm1);
+
+  __m256 u = Fade8(x);
+  __m256 v = Fade8(y);
+  __m256 w = Fade8(z);
+
+  __m256 nx00 = Mix8(n000, n100, u);
+  __m256 nx01 = Mix8(n001, n101, u);
+  __m256 nx10 = Mix8(n010, n110, u);
+  __m256 nx11 = Mix8(n011, n111, u);
+
+  return Mix8(Mix8(nx00, nx10, v), Mix8(nx01, nx11, v), w);
+}
+
+#elif defined(__ARM_NEON)
+
+static float32x4_t Fade4(float32x4_t t) {
+  float32x4_t t3 = vmulq_f32(vmulq_f32(t, t), t);
+  float32x4_t a = vsubq_f32(vmulq_f32(t, vdupq_n_f32(6.0f)), vdupq_n_f32(15.0f));
+  float32x4_t b = vaddq_f32(vmulq_f32(t, a), vdupq_n_f32(10.0f));
+  return vmulq_f32(t3, b);
+}
+
+static float32x4_t Mix4(float32x4_t a, float32x4_t b, float32x4_t t) {
+  return vaddq_f32(a, vmulq_f32(t, vsubq_f32(b, a)));
+}
+
+// 4-lane NEON port. NEON has no gather, so the permutation chain runs per
+// lane into corner arrays; fade/mix interpolation stays vectorized.
+static float32x4_t SimplexNoise4(const NoiseTables& tables, float32x4_t x,
+                                 float32x4_t y, float32x4_t z) {
+  alignas(16) float px[4], py[4], pz[4];
+  alignas(16) float fx[4], fy[4], fz[4];
+  alignas(16) float corners[8][4];
+  vst1q_f32(px, x);
+  vst1q_f32(py, y);
+  vst1q_f32(pz, z);
+
+  for (int lane = 0; lane < 4; ++lane) {
+    int X = FastFloor(px[lane]);
+    int Y = FastFloor(py[lane]);
+    int Z = FastFloor(pz[lane]);
+    float lx = px[lane] - X;
+    float ly = py[lane] - Y;
+    float lz = pz[lane] - Z;
+    X &= 255;
+    Y &= 255;
+    Z &= 255;
+    uint8_t permX = tables.perm[X];
+    uint8_t permXY = tables.perm[(permX + Y) & 255];
+    uint8_t permX1Y = tables.perm[(permX + (Y + 1)) & 255];
+    uint8_t permX1 = tables.perm[(X + 1) & 255];
+    uint8_t permX1Y1 = tables.perm[(permX1 + Y) & 255];
+    int iXYZ = tables.permMod12[(permXY + Z) & 255];
+    int iXYZ1 = tables.permMod12[(permXY + (Z + 1)) & 255];
+    int iX1YZ = tables.permMod12[(permX1Y + Z) & 255];
+    int iX1YZ1 = tables.permMod12[(permX1Y + (Z + 1)) & 255];
+    int iX1Y1Z = tables.permMod12[(permX1Y1 + Z) & 255];
+    int iX1Y1Z1 = tables.permMod12[(permX1Y1 + (Z + 1)) & 255];
+    corners[0][lane] = Dot(GRAD3[iXYZ], vec3(lx, ly, lz));
+    corners[1][lane] = Dot(GRAD3[iXYZ1], vec3(lx, ly, lz - 1));
+    corners[2][lane] = Dot(GRAD3[iX1YZ], vec3(lx, ly - 1, lz));
+    corners[3][lane] = Dot(GRAD3[iX1YZ1], vec3(lx, ly - 1, lz - 1));
+    corners[4][lane] = Dot(GRAD3[iX1Y1Z], vec3(lx - 1, ly, lz));
+    corners[5][lane] = Dot(GRAD3[iX1Y1Z1], vec3(lx - 1, ly, lz - 1));
+    corners[6][lane] = Dot(GRAD3[iX1Y1Z], vec3(lx - 1, ly - 1, lz));
+    corners[7][lane] = Dot(GRAD3[iX1Y1Z1], vec3(lx - 1, ly - 1, lz - 1));
+    fx[lane] = lx;
+    fy[lane] = ly;
+    fz[lane] = lz;
+  }
+
+  float32x4_t u = Fade4(vld1q_f32(fx));
+  float32x4_t v = Fade4(vld1q_f32(fy));
+  float32x4_t w = Fade4(vld1q_f32(fz));
+
+  float32x4_t nx00 = Mix4(vld1q_f32(corners[0]), vld1q_f32(corners[4]), u);
+  float32x4_t nx01 = Mix4(vld1q_f32(corners[1]), vld1q_f32(corners[5]), u);
+  float32x4_t nx10 = Mix4(vld1q_f32(corners[2]), vld1q_f32(corners[6]), u);
+  float32x4_t nx11 = Mix4(vld1q_f32(corners[3]), vld1q_f32(corners[7]), u);
+
+  return Mix4(Mix4(nx00, nx10, v), Mix4(nx01, nx11, v), w);
+}
+
+#endif
 NoiseProvider::NoiseProvider(float persistence, float lacunarity, int octaves)
-    : m_persistence(persistence), m_lacunarity(lacunarity), m_octaves(octaves) {
+    : m_persistence(persistence),
+      m_lacunarity(lacunarity),
+      m_octaves(octaves),
+      m_tables(NoiseTableRegistry::Get(kCanonicalTableSeed)) {
   if (octaves < 1) {
     throw std::invalid_argument("Octaves must be at least 1");
   }
@@ -61,6 +223,58 @@ float NoiseProvider::GetNoise(const vec3& pos) {
   return GetNoise(pos.x, pos.y, pos.z);
 }
 
+void NoiseProvider::GetNoiseBatch(const float* xs, const float* ys,
+                                  const float* zs, float* out, size_t count) {
+  if (xs == nullptr || ys == nullptr || zs == nullptr || out == nullptr) {
+    throw std::invalid_argument("GetNoiseBatch requires non-null arrays");
+  }
+  size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 8 <= count; i += 8) {
+    __m256 x = _mm256_loadu_ps(xs + i);
+    __m256 y = _mm256_loadu_ps(ys + i);
+    __m256 z = _mm256_loadu_ps(zs + i);
+    __m256 total = _mm256_setzero_ps();
+    float frequency = 1.0f;
+    float amplitude = 1.0f;
+    float maxValue = 0.0f;
+    for (int octave = 0; octave < m_octaves; octave++) {
+      __m256 freq = _mm256_set1_ps(frequency);
+      __m256 n = SimplexNoise8(*m_tables, _mm256_mul_ps(x, freq),
+                               _mm256_mul_ps(y, freq), _mm256_mul_ps(z, freq));
+      total = _mm256_add_ps(total, _mm256_mul_ps(n, _mm256_set1_ps(amplitude)));
+      maxValue += amplitude;
+      amplitude *= m_persistence;
+      frequency *= m_lacunarity;
+    }
+    _mm256_storeu_ps(out + i, _mm256_div_ps(total, _mm256_set1_ps(maxValue)));
+  }
+#elif defined(__ARM_NEON)
+  for (; i + 4 <= count; i += 4) {
+    float32x4_t x = vld1q_f32(xs + i);
+    float32x4_t y = vld1q_f32(ys + i);
+    float32x4_t z = vld1q_f32(zs + i);
+    float32x4_t total = vdupq_n_f32(0.0f);
+    float frequency = 1.0f;
+    float amplitude = 1.0f;
+    float maxValue = 0.0f;
+    for (int octave = 0; octave < m_octaves; octave++) {
+      float32x4_t freq = vdupq_n_f32(frequency);
+      float32x4_t n = SimplexNoise4(*m_tables, vmulq_f32(x, freq),
+                                    vmulq_f32(y, freq), vmulq_f32(z, freq));
+      total = vaddq_f32(total, vmulq_f32(n, vdupq_n_f32(amplitude)));
+      maxValue += amplitude;
+      amplitude *= m_persistence;
+      frequency *= m_lacunarity;
+    }
+    vst1q_f32(out + i, vmulq_f32(total, vdupq_n_f32(1.0f / maxValue)));
+  }
+#endif
+  for (; i < count; ++i) {
+    out[i] = FractalNoise(xs[i], ys[i], zs[i]);
+  }
+}
+
 void NoiseProvider::SetPersistence(float persistence) {
   m_persistence = persistence;
 }
@@ -76,6 +290,12 @@ void NoiseProvider::SetOctaves(int octaves) {
   m_octaves = octaves;
 }
 
+void NoiseProvider::SetSeed(int seed) {
+  // Shared immutable block from the registry: instances with the same seed
+  // reference one table instead of rebuilding their own.
+  m_tables = NoiseTableRegistry::Get(seed);
+}
+
 float NoiseProvider::SimplexNoise(float x, float y, float z) {
   int X = FastFloor(x);
   int Y = FastFloor(y);
@@ -86,17 +306,18 @@ float NoiseProvider::SimplexNoise(float x, float y, float z) {
   X &= 255;
   Y &= 255;
   Z &= 255;
-  uint8_t permX = PERM[X];
-  uint8_t permXY = PERM[(permX + Y) & 255];
-  uint8_t permXYZ = PERM[(permXY + Z) & 255];
-  uint8_t permXYZ1 = PERM[(permXY + (Z + 1)) & 255];
-  uint8_t permX1Y = PERM[(permX + (Y + 1)) & 255];
-  uint8_t permX1YZ = PERM[(permX1Y + Z) & 255];
-  uint8_t permX1YZ1 = PERM[(permX1Y + (Z + 1)) & 255];
-  uint8_t permX1 = PERM[(X + 1) & 255];
-  uint8_t permX1Y1 = PERM[(permX1 + Y) & 255];
-  uint8_t permX1Y1Z = PERM[(permX1Y1 + Z) & 255];
-  uint8_t permX1Y1Z1 = PERM[(permX1Y1 + (Z + 1)) & 255];
+  const auto& perm = m_tables->perm;
+  uint8_t permX = perm[X];
+  uint8_t permXY = perm[(permX + Y) & 255];
+  uint8_t permXYZ = perm[(permXY + Z) & 255];
+  uint8_t permXYZ1 = perm[(permXY + (Z + 1)) & 255];
+  uint8_t permX1Y = perm[(permX + (Y + 1)) & 255];
+  uint8_t permX1YZ = perm[(permX1Y + Z) & 255];
+  uint8_t permX1YZ1 = perm[(permX1Y + (Z + 1)) & 255];
+  uint8_t permX1 = perm[(X + 1) & 255];
+  uint8_t permX1Y1 = perm[(permX1 + Y) & 255];
+  uint8_t permX1Y1Z = perm[(permX1Y1 + Z) & 255];
+  uint8_t permX1Y1Z1 = perm[(permX1Y1 + (Z + 1)) & 255];
 
   float n000 = Dot(GRAD3[permXYZ % 12], vec3(x, y, z));
   float n001 = Dot(GRAD3[permXYZ1 % 12], vec3(x, y, z - 1));
@@ -29,7 +29,9 @@ float SimpleNoiseWrapper::GetNoise(const vec3& pos) {
 
 void SimpleNoiseWrapper::SetSeed(int seed) {
   m_seed = seed;
-  // TODO: Implement seed-based randomization
+  // Shared seed-keyed tables come from the registry, so instances with the
+  // same seed reference one immutable block.
+  m_noise->SetSeed(seed);
 }
 
 void SimpleNoiseWrapper::SetFrequency(float freq) {
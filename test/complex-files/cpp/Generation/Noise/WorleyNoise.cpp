@@ -1,11 +1,13 @@
 module;
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <cstddef>
 #include <cstdint>
 #include <algorithm>
 #include <cmath>
 #include <limits>
 #include <random>
+#include <vector>
 
 module WorleyNoise; // implement the module (no export)
 
@@ -13,6 +15,49 @@ import GLMModule;
 
 namespace PlanetGen::Rendering::Noise {
 
+namespace {
+
+// 21 bits per axis covers +/-1M cells, far beyond any map we generate.
+uint64_t PackCellKey(int x, int y, int z) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(x) & 0x1FFFFF) << 42) |
+         (static_cast<uint64_t>(static_cast<uint32_t>(y) & 0x1FFFFF) << 21) |
+         static_cast<uint64_t>(static_cast<uint32_t>(z) & 0x1FFFFF);
+}
+
+// Small per-thread open-addressing cache of recently computed cell feature
+// points. Dense sampling revisits the same 27-cell neighborhoods constantly,
+// so most lookups hit instead of rehashing the cell. The cache is keyed per
+// seed and reset when a generator with a different seed uses the thread.
+struct CellCache {
+  static constexpr uint32_t kSlots = 2048;  // power of two
+  static constexpr uint64_t kEmptyKey = ~0ull;  // PackCellKey never yields this
+  static constexpr uint32_t kProbes = 2;
+
+  struct Entry {
+    uint64_t key = kEmptyKey;
+    vec3 point{0.0f, 0.0f, 0.0f};
+  };
+
+  int seed = 0;
+  bool valid = false;
+  std::vector<Entry> entries{kSlots};
+
+  void Reset(int newSeed) {
+    entries.assign(kSlots, Entry{});
+    seed = newSeed;
+    valid = true;
+  }
+
+  static uint32_t Slot(uint64_t key) {
+    return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 32) &
+           (kSlots - 1);
+  }
+};
+
+thread_local CellCache t_cellCache;
+
+}  // namespace
+
 WorleyNoise::WorleyNoise(int seed, float frequency, int octaves)
     : m_seed(seed), m_frequency(frequency), m_octaves(octaves), m_rng(seed) {}
 
@@ -63,7 +108,7 @@ float WorleyNoise::WorleyNoise3D(float x, float y, float z) const {
     for (int dy = -1; dy <= 1; dy++) {
       for (int dx = -1; dx <= 1; dx++) {
         vec3 featurePoint =
-            GenerateFeaturePoint(cellX + dx, cellY + dy, cellZ + dz);
+            CachedFeaturePoint(cellX + dx, cellY + dy, cellZ + dz);
         float dist = length(vec3(x, y, z) - featurePoint);
         minDist = std::min(minDist, dist);
       }
@@ -73,6 +118,121 @@ float WorleyNoise::WorleyNoise3D(float x, float y, float z) const {
                   minDist / 1.732f); // sqrt(3) is max distance in unit cube
 }
 
+void WorleyNoise::GetNoiseRow(float startX, float y, float z, float stepX,
+                              float *out, size_t count) {
+  if (count == 0) {
+    return;
+  }
+  const float f = m_frequency;
+  if (m_octaves <= 1) {
+    RowSweep(startX * f, y * f, z * f, stepX * f, out, count, 1.0f, false);
+    return;
+  }
+
+  float amplitude = 1.0f;
+  float frequency = 1.0f;
+  float maxValue = 0.0f;
+  for (int i = 0; i < m_octaves; i++) {
+    RowSweep(startX * f * frequency, y * f * frequency, z * f * frequency,
+             stepX * f * frequency, out, count, amplitude, i > 0);
+    maxValue += amplitude;
+    amplitude *= 0.5f; // Persistence
+    frequency *= 2.0f; // Lacunarity
+  }
+  for (size_t i = 0; i < count; i++) {
+    out[i] /= maxValue;
+  }
+}
+
+vec3 WorleyNoise::CachedFeaturePoint(int cellX, int cellY, int cellZ) const {
+  CellCache &cache = t_cellCache;
+  if (!cache.valid || cache.seed != m_seed) {
+    cache.Reset(m_seed);
+  }
+
+  const uint64_t key = PackCellKey(cellX, cellY, cellZ);
+  const uint32_t slot = CellCache::Slot(key);
+  for (uint32_t p = 0; p < CellCache::kProbes; p++) {
+    CellCache::Entry &entry =
+        cache.entries[(slot + p) & (CellCache::kSlots - 1)];
+    if (entry.key == key) {
+      return entry.point;
+    }
+    if (entry.key == CellCache::kEmptyKey) {
+      entry.key = key;
+      entry.point = GenerateFeaturePoint(cellX, cellY, cellZ);
+      return entry.point;
+    }
+  }
+
+  // All probe slots taken by other cells: evict the home slot.
+  CellCache::Entry &entry = cache.entries[slot];
+  entry.key = key;
+  entry.point = GenerateFeaturePoint(cellX, cellY, cellZ);
+  return entry.point;
+}
+
+void WorleyNoise::RowSweep(float x0, float y, float z, float dx, float *out,
+                           size_t count, float amplitude,
+                           bool accumulate) const {
+  const int cellY = static_cast<int>(std::floor(y));
+  const int cellZ = static_cast<int>(std::floor(z));
+
+  // Sliding 3-column window of the 27-neighborhood: window[c] holds the 9
+  // feature points for x-column baseCellX - 1 + c. Only the column entered
+  // when the sweep crosses a cell boundary is recomputed.
+  vec3 window[3][9];
+  int baseCellX = static_cast<int>(std::floor(x0));
+
+  auto fillColumn = [&](int c, int cellX) {
+    int n = 0;
+    for (int dz = -1; dz <= 1; dz++) {
+      for (int dy = -1; dy <= 1; dy++) {
+        window[c][n++] = CachedFeaturePoint(cellX, cellY + dy, cellZ + dz);
+      }
+    }
+  };
+  fillColumn(0, baseCellX - 1);
+  fillColumn(1, baseCellX);
+  fillColumn(2, baseCellX + 1);
+
+  for (size_t i = 0; i < count; i++) {
+    const float x = x0 + static_cast<float>(i) * dx;
+    const int cellX = static_cast<int>(std::floor(x));
+    if (cellX != baseCellX) {
+      if (cellX == baseCellX + 1) {
+        // Advance one cell: shift columns left, hash only the new one.
+        for (int n = 0; n < 9; n++) {
+          window[0][n] = window[1][n];
+          window[1][n] = window[2][n];
+        }
+        fillColumn(2, cellX + 1);
+      } else {
+        // Large or backward jump: rebuild the whole window.
+        fillColumn(0, cellX - 1);
+        fillColumn(1, cellX);
+        fillColumn(2, cellX + 1);
+      }
+      baseCellX = cellX;
+    }
+
+    float minDist = std::numeric_limits<float>::max();
+    const vec3 sample(x, y, z);
+    for (int c = 0; c < 3; c++) {
+      for (int n = 0; n < 9; n++) {
+        minDist = std::min(minDist, length(sample - window[c][n]));
+      }
+    }
+    const float value =
+        amplitude * std::min(1.0f, minDist / 1.732f); // sqrt(3) max distance
+    if (accumulate) {
+      out[i] += value;
+    } else {
+      out[i] = value;
+    }
+  }
+}
+
 vec3 WorleyNoise::GenerateFeaturePoint(int cellX, int cellY,
                                             int cellZ) const {
   uint32_t hash = HashCell(cellX, cellY, cellZ);
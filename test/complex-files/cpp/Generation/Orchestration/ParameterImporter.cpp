@@ -13,6 +13,8 @@ module;
 
 module ParameterImporter;
 
+import Core.Parameters.Registry;
+
 using json = nlohmann::json;
 
 namespace PlanetGen::Generation::Configuration {
@@ -380,6 +382,70 @@ std::vector<ParameterConstraint> GetPhysicsConstraints() {
     };
 }
 
+PlanetGen::Core::Parameters::ParameterBatch BuildParameterBatch(
+    const ParameterSet& params, const std::vector<ParameterConstraint>& constraints) {
+    // Index constraints once so staging stays O(n) for large sets
+    std::unordered_map<std::string, const ParameterConstraint*> constraintIndex;
+    for (const auto& constraint : constraints) {
+        constraintIndex[constraint.parameterName] = &constraint;
+    }
+
+    PlanetGen::Core::Parameters::ParameterBatch batch;
+
+    for (const auto& [key, value] : params.floatParameters) {
+        auto it = constraintIndex.find(key);
+        if (it != constraintIndex.end()) {
+            batch.DefineParameter<float>(key, value, it->second->minValue, it->second->maxValue);
+        } else {
+            batch.DefineParameter<float>(key, value);
+        }
+    }
+
+    for (const auto& [key, value] : params.boolParameters) {
+        batch.DefineParameter<bool>(key, value);
+    }
+
+    // Strings and arrays have no constraint model; stage them as overrides,
+    // matching how LoadFromJson publishes them
+    for (const auto& [key, value] : params.stringParameters) {
+        batch.SetOverride<std::string>(key, value);
+    }
+
+    for (const auto& [key, value] : params.arrayParameters) {
+        batch.SetOverride<std::vector<float>>(key, value);
+    }
+
+    return batch;
+}
+
+bool ApplyToRegistry(const ParameterSet& params,
+                     PlanetGen::Core::Parameters::ParameterRegistry& registry,
+                     const std::vector<ParameterConstraint>& constraints) {
+    // Check required/range constraints up front so a bad set never reaches
+    // the registry; ImportBatch then re-validates the staged batch as a
+    // whole before the atomic publish
+    for (const auto& constraint : constraints) {
+        auto it = params.floatParameters.find(constraint.parameterName);
+        if (it == params.floatParameters.end()) {
+            if (constraint.required) {
+                std::cerr << "[ParameterUtils] Missing required parameter: "
+                         << constraint.parameterName << std::endl;
+                return false;
+            }
+            continue;
+        }
+
+        if (it->second < constraint.minValue || it->second > constraint.maxValue) {
+            std::cerr << "[ParameterUtils] Parameter " << constraint.parameterName
+                     << " value " << it->second << " outside range ["
+                     << constraint.minValue << ", " << constraint.maxValue << "]" << std::endl;
+            return false;
+        }
+    }
+
+    return registry.ImportBatch(BuildParameterBatch(params, constraints));
+}
+
 } // namespace ParameterUtils
 
 } // namespace PlanetGen::Generation::Configuration
\ No newline at end of file
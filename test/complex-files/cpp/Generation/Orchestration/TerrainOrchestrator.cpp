@@ -9,6 +9,7 @@ module;
 module TerrainOrchestrator;
 
 import Core.Logging.Logger;
+import Core.Threading.JobSystem;
 import GenerationTypes;
 import TerrainAnalysisTypes;
 import EarthProcessor;
@@ -19,6 +20,12 @@ import BufferCore;
 
 namespace PlanetGen::Rendering {
 
+namespace {
+// Set while orchestration work runs inside a JobSystem job; scheduling more
+// jobs and blocking on them from a worker thread can deadlock the JobSystem
+thread_local bool g_inOrchestrationJob = false;
+} // namespace
+
 // =============================================================================
 // CONSTRUCTOR/DESTRUCTOR
 // =============================================================================
@@ -77,18 +84,77 @@ std::vector<PlanetGen::Generation::OrchestrationResult> TerrainOrchestrator::Gen
     const PlanetGen::Generation::PlanetaryDesignTemplate& baseDesign,
     uint32_t numVariations,
     float variationIntensity) {
-    
+
+    constexpr uint32_t kVariationResolution = 2048;
+
     std::vector<PlanetGen::Generation::OrchestrationResult> results;
-    results.reserve(numVariations);
-    
-    for (uint32_t i = 0; i < numVariations; ++i) {
-        PlanetGen::Generation::FeatureDistribution distribution;
-        results.push_back(GeneratePlanet(baseDesign, distribution, 2048));
+    if (numVariations == 0) {
+        return results;
     }
-    
+
+    uint32_t concurrency = EffectiveVariationConcurrency(kVariationResolution);
+    if (concurrency <= 1 || numVariations == 1 || g_inOrchestrationJob) {
+        results.reserve(numVariations);
+        for (uint32_t i = 0; i < numVariations; ++i) {
+            PlanetGen::Generation::FeatureDistribution distribution;
+            results.push_back(GeneratePlanet(baseDesign, distribution, kVariationResolution));
+        }
+        return results;
+    }
+
+    // Batch mode: run variations concurrently in waves of `concurrency`.
+    // The base design is shared read-only across workers; waves bound the
+    // peak working set to concurrency * per-variation memory.
+    LOG_INFO("TerrainOrchestrator", "Generating {} variations ({} concurrent)",
+             numVariations, concurrency);
+
+    using namespace PlanetGen::Core::Threading;
+
+    results.resize(numVariations);
+    for (uint32_t waveBegin = 0; waveBegin < numVariations; waveBegin += concurrency) {
+        uint32_t waveEnd = std::min(waveBegin + concurrency, numVariations);
+
+        std::vector<Job*> jobs;
+        jobs.reserve(waveEnd - waveBegin);
+
+        for (uint32_t i = waveBegin; i < waveEnd; ++i) {
+            auto job = JobSystem::Instance().CreateJob<PlanetGen::Generation::OrchestrationResult>(
+                [this, &baseDesign]() -> PlanetGen::Generation::OrchestrationResult {
+                    g_inOrchestrationJob = true;
+                    PlanetGen::Generation::FeatureDistribution distribution;
+                    auto result = GeneratePlanet(baseDesign, distribution, kVariationResolution);
+                    g_inOrchestrationJob = false;
+                    return result;
+                },
+                "PlanetVariation"
+            );
+            jobs.push_back(job);
+        }
+
+        JobSystem::Instance().ScheduleBatch(jobs);
+
+        for (uint32_t i = waveBegin; i < waveEnd; ++i) {
+            auto* typedJob = static_cast<TypedJob<PlanetGen::Generation::OrchestrationResult>*>(jobs[i - waveBegin]);
+            results[i] = typedJob->GetResult();
+            delete jobs[i - waveBegin];
+        }
+    }
+
     return results;
 }
 
+uint32_t TerrainOrchestrator::EffectiveVariationConcurrency(uint32_t resolution) const {
+    // Estimate the per-variation working set: four float modality grids,
+    // doubled to account for pipeline-internal copies and GPU staging
+    size_t perVariationBytes = static_cast<size_t>(resolution) * resolution * sizeof(float) * 4 * 2;
+    size_t budgetBytes = m_variationMemoryBudgetMB * 1024ull * 1024ull;
+
+    uint32_t memoryCap = static_cast<uint32_t>(
+        std::max<size_t>(1, budgetBytes / std::max<size_t>(1, perVariationBytes)));
+
+    return std::max(1u, std::min(m_maxVariationConcurrency, memoryCap));
+}
+
 // =============================================================================
 // PRIVATE METHODS
 // =============================================================================
@@ -130,39 +196,51 @@ void TerrainOrchestrator::ApplyGenerationPipeline(
             // Use the actual PlanetaryGenerator for real data!
             PlanetGen::Generation::PlanetaryData generatedData = m_planetaryGenerator->GeneratePlanet(design, resolution);
             
-            // Use the generated data instead of empty arrays
-            data = generatedData;
+            // Use the generated data instead of empty arrays (moved, not copied)
+            data = std::move(generatedData);
         } else {
             // Fallback: create basic data structure using PlanetaryModality
             size_t dataSize = resolution * resolution;
-            
-            data.elevation.data.resize(dataSize, 0.0f);
-            data.elevation.width = resolution;
-            data.elevation.height = resolution;
-            data.elevation.minValue = 0.0f;
-            data.elevation.maxValue = 8848.0f; // Everest height
-            data.elevation.name = "elevation";
-            
-            data.temperature.data.resize(dataSize, 15.0f);
-            data.temperature.width = resolution;
-            data.temperature.height = resolution;
-            data.temperature.minValue = -50.0f;
-            data.temperature.maxValue = 50.0f;
-            data.temperature.name = "temperature";
-            
-            data.precipitation.data.resize(dataSize, 500.0f);
-            data.precipitation.width = resolution;
-            data.precipitation.height = resolution;
-            data.precipitation.minValue = 0.0f;
-            data.precipitation.maxValue = 2000.0f;
-            data.precipitation.name = "precipitation";
-            
-            data.vegetation.data.resize(dataSize, 0.5f);
-            data.vegetation.width = resolution;
-            data.vegetation.height = resolution;
-            data.vegetation.minValue = 0.0f;
-            data.vegetation.maxValue = 1.0f;
-            data.vegetation.name = "vegetation";
+
+            auto fillModality = [&](PlanetGen::Generation::PlanetaryModality& modality,
+                                    float fillValue, float minValue, float maxValue,
+                                    const char* name) {
+                modality.data.resize(dataSize, fillValue);
+                modality.width = resolution;
+                modality.height = resolution;
+                modality.minValue = minValue;
+                modality.maxValue = maxValue;
+                modality.name = name;
+            };
+
+            if (m_pipelinedExecution && !g_inOrchestrationJob) {
+                // The four grids are independent: fill them concurrently
+                using namespace PlanetGen::Core::Threading;
+                std::vector<Job*> fillJobs;
+                fillJobs.reserve(3);
+                fillJobs.push_back(JobSystem::Instance().CreateJob<void>(
+                    [&] { fillModality(data.temperature, 15.0f, -50.0f, 50.0f, "temperature"); },
+                    "FillTemperature"));
+                fillJobs.push_back(JobSystem::Instance().CreateJob<void>(
+                    [&] { fillModality(data.precipitation, 500.0f, 0.0f, 2000.0f, "precipitation"); },
+                    "FillPrecipitation"));
+                fillJobs.push_back(JobSystem::Instance().CreateJob<void>(
+                    [&] { fillModality(data.vegetation, 0.5f, 0.0f, 1.0f, "vegetation"); },
+                    "FillVegetation"));
+                JobSystem::Instance().ScheduleBatch(fillJobs);
+
+                fillModality(data.elevation, 0.0f, 0.0f, 8848.0f, "elevation"); // Everest height
+
+                for (Job* job : fillJobs) {
+                    static_cast<TypedJob<void>*>(job)->GetResult();
+                    delete job;
+                }
+            } else {
+                fillModality(data.elevation, 0.0f, 0.0f, 8848.0f, "elevation"); // Everest height
+                fillModality(data.temperature, 15.0f, -50.0f, 50.0f, "temperature");
+                fillModality(data.precipitation, 500.0f, 0.0f, 2000.0f, "precipitation");
+                fillModality(data.vegetation, 0.5f, 0.0f, 1.0f, "vegetation");
+            }
         }
         
         // Stage 3: Apply geological features using EarthProcessor
@@ -180,9 +258,24 @@ void TerrainOrchestrator::ApplyGenerationPipeline(
                 BufferUsageHints{}
             );
             
+            // Pipelined mode: the mountain-pass decision below only reads the
+            // CPU-side elevation copy, so scan it while the GPU upload and
+            // erosion dispatch are in flight instead of waiting for them
+            using namespace PlanetGen::Core::Threading;
+            TypedJob<float>* maxElevationScan = nullptr;
+            if (m_pipelinedExecution && !g_inOrchestrationJob) {
+                maxElevationScan = JobSystem::Instance().CreateJob<float>(
+                    [&data]() -> float {
+                        return *std::max_element(data.elevation.data.begin(), data.elevation.data.end());
+                    },
+                    "ElevationMaxScan"
+                );
+                JobSystem::Instance().Schedule(maxElevationScan);
+            }
+
             // Upload CPU data to GPU buffer
             elevationBuffer->UpdateData(data.elevation.data.data(), dataSize);
-            
+
             // Set up parameters for terrain processing
             PlanetGen::Rendering::Terrain::EarthParams params;
             params.inputElevation = elevationBuffer;
@@ -190,13 +283,19 @@ void TerrainOrchestrator::ApplyGenerationPipeline(
             params.width = resolution;
             params.height = resolution;
             params.strength = 0.5f; // Moderate processing strength
-            
+
             // Apply basic erosion to make terrain more realistic
             m_earthProcessor->ProcessEarth(PlanetGen::Rendering::Terrain::EarthOperation::Erosion_Unified, params);
-            
+
             // Apply mountain formation if elevation suggests mountains
-            auto minMax = std::minmax_element(data.elevation.data.begin(), data.elevation.data.end());
-            if (*minMax.second > data.seaLevel + 1000.0f) { // High elevation detected
+            float maxElevation;
+            if (maxElevationScan) {
+                maxElevation = maxElevationScan->GetResult();
+                delete maxElevationScan;
+            } else {
+                maxElevation = *std::max_element(data.elevation.data.begin(), data.elevation.data.end());
+            }
+            if (maxElevation > data.seaLevel + 1000.0f) { // High elevation detected
                 params.strength = 0.3f; // Gentler mountain processing
                 m_earthProcessor->ProcessEarth(PlanetGen::Rendering::Terrain::EarthOperation::Mountain_Unified, params);
             }
@@ -222,7 +321,7 @@ void TerrainOrchestrator::ApplyGenerationPipeline(
         
         // Set result
         result.generationSuccessful = true;
-        result.planetaryData = data;
+        result.planetaryData = std::move(data);
         result.generationTimeMs = static_cast<float>(duration.count());
         
         // Set additional result fields required by OrchestrationResult
@@ -3,12 +3,17 @@ module;
 #include <stdexcept>
 #include <algorithm>
 #include <cmath>
+#include <exception>
 #include <future>
+#include <string>
+#include <thread>
+#include <vector>
 #include <Core/Logging/LoggerMacros.h>
 
 module PlanetaryGenerator;
 
 import Core.Logging.Logger;
+import Core.Threading.JobSystem;
 import GLMModule;
 
 namespace PlanetGen::Generation {
@@ -44,6 +49,59 @@ std::future<PlanetaryData> PlanetaryGenerator::GeneratePlanetAsync(const Planeta
     });
 }
 
+std::future<PlanetaryData> PlanetaryGenerator::GeneratePlanetProgressive(const PlanetaryDesignTemplate& designTemplate,
+                                                                        uint32_t finalResolution,
+                                                                        ProgressiveLODCallback onLODReady,
+                                                                        uint32_t seed,
+                                                                        uint32_t previewResolution) {
+    if (m_isGenerating) {
+        throw std::runtime_error("Generation already in progress");
+    }
+
+    if (previewResolution == 0) {
+        throw std::invalid_argument("Preview resolution must be positive");
+    }
+
+    return std::async(std::launch::async,
+                      [this, designTemplate, finalResolution, onLODReady, seed, previewResolution]() {
+        // LOD ladder: preview resolution, doubling each pass, ending exactly
+        // at the requested final resolution. Each pass runs the full phase
+        // pipeline, so every intermediate dataset is complete and renderable.
+        uint32_t lodResolution = std::min(previewResolution, finalResolution);
+        PlanetaryData lodData;
+
+        while (true) {
+            bool isFinal = (lodResolution >= finalResolution);
+
+            // Reclaim the previous pass's grids before generating the next.
+            if (m_arena && !lodData.elevation.data.empty()) {
+                m_arena->Recycle(std::move(lodData));
+            }
+
+            lodData = GeneratePlanetImpl(designTemplate, lodResolution, seed);
+
+            LOG_INFO("PlanetaryGenerator", "Progressive LOD ready at resolution {}", lodResolution);
+
+            if (onLODReady && !onLODReady(lodData, lodResolution, isFinal)) {
+                LOG_INFO("PlanetaryGenerator", "Progressive refinement stopped by consumer at resolution {}", lodResolution);
+                return lodData;
+            }
+
+            if (isFinal) {
+                return lodData;
+            }
+
+            // GeneratePlanetImpl clears the cancellation flag on entry, so a
+            // cancel raised between passes has to be honoured here.
+            if (ShouldCancelGeneration()) {
+                throw std::runtime_error("Generation cancelled");
+            }
+
+            lodResolution = std::min(lodResolution * 2, finalResolution);
+        }
+    });
+}
+
 void PlanetaryGenerator::CancelGeneration() {
     m_cancellationRequested = true;
     LOG_INFO("PlanetaryGenerator", "Generation cancellation requested");
@@ -55,7 +113,13 @@ PlanetaryData PlanetaryGenerator::GeneratePlanetImpl(const PlanetaryDesignTempla
     m_isGenerating = true;
     m_cancellationRequested = false;
     m_progress = 0.0f;
-    
+
+    // One scratch arena per run; generation is serialized by m_isGenerating,
+    // so reusing the instance across runs keeps its largest chunk warm.
+    if (!m_scratchArena) {
+        m_scratchArena = std::make_unique<Core::Memory::BumpArena>();
+    }
+
     try {
         LOG_INFO("PlanetaryGenerator", "Starting planet generation - resolution: {}, seed: {}", resolution, seed);
         
@@ -103,18 +167,23 @@ PlanetaryData PlanetaryGenerator::GeneratePlanetImpl(const PlanetaryDesignTempla
             throw std::runtime_error("Generation cancelled");
         }
         
-        // Phase 5: Assemble final planetary data
+        // Phase 5: Assemble final planetary data (modalities are moved, not copied)
         LOG_INFO("PlanetaryGenerator", "Phase 5: Assembling planetary data");
-        auto planetaryData = AssemblePlanetaryData(designTemplate, elevation, temperature, precipitation, vegetation);
+        auto planetaryData = AssemblePlanetaryData(designTemplate, std::move(elevation), std::move(temperature),
+                                                   std::move(precipitation), std::move(vegetation));
         UpdateProgress(1.0f);
         
         LOG_INFO("PlanetaryGenerator", "Planet generation completed successfully");
-        
+
+        // Result is published; reclaim every transient allocation wholesale
+        m_scratchArena->Reset();
+
         m_isGenerating = false;
         return planetaryData;
-        
+
     } catch (const std::exception& e) {
         LOG_ERROR("PlanetaryGenerator", "Generation failed: {}", e.what());
+        m_scratchArena->Reset();
         m_isGenerating = false;
         throw;
     }
@@ -131,7 +200,7 @@ PlanetaryModality PlanetaryGenerator::GenerateElevation(const PlanetaryDesignTem
     elevation.name = "elevation";
     elevation.width = resolution;
     elevation.height = resolution;
-    elevation.data.resize(resolution * resolution);
+    elevation.data = AcquireBuffer(static_cast<size_t>(resolution) * resolution);
     
     // Configure noise parameters from design template
     NoiseParameters noiseParams;
@@ -150,10 +219,13 @@ PlanetaryModality PlanetaryGenerator::GenerateElevation(const PlanetaryDesignTem
     m_noiseProvider->SetPersistence(noiseParams.persistence);
     m_noiseProvider->SetLacunarity(noiseParams.lacunarity);
     
-    // Generate noise data using batch sampling
-    std::vector<vec3> positions;
-    positions.reserve(resolution * resolution);
-    
+    // Generate noise data using batch sampling; the position grid is pure
+    // scratch, so it lives in the per-run bump arena and is reclaimed
+    // wholesale when the result is published
+    Core::Memory::ArenaVector<vec3> positions{
+        Core::Memory::ArenaStlAllocator<vec3>(*m_scratchArena)};
+    positions.reserve(static_cast<size_t>(resolution) * resolution);
+
     for (uint32_t y = 0; y < resolution; ++y) {
         for (uint32_t x = 0; x < resolution; ++x) {
             float u = static_cast<float>(x) / static_cast<float>(resolution - 1);
@@ -161,32 +233,41 @@ PlanetaryModality PlanetaryGenerator::GenerateElevation(const PlanetaryDesignTem
             positions.emplace_back(u, v, 0.0f);
         }
     }
-    
-    auto noiseData = m_noiseProvider->SampleBatch(positions);
+
+    auto noiseData = m_noiseProvider->SampleBatch(positions.data(), positions.size());
     
     // Apply planetary scaling and constraints
     float planetRadius = designTemplate.planetRadius;
     float maxElevation = designTemplate.maxElevation;
     float heightScale = designTemplate.heightScale;
     
-    for (uint32_t i = 0; i < resolution * resolution; ++i) {
-        if (ShouldCancelGeneration()) {
-            throw std::runtime_error("Generation cancelled");
-        }
-        
-        // Scale noise to elevation range
-        float normalizedNoise = (noiseData[i] + 1.0f) * 0.5f; // Convert from [-1,1] to [0,1]
-        float elevationValue = normalizedNoise * maxElevation * heightScale;
-        
-        // Apply water coverage constraint
-        float waterThreshold = designTemplate.waterCoverage;
-        if (normalizedNoise < waterThreshold) {
-            elevationValue = std::min(elevationValue, 0.0f); // Below sea level
+    ParallelForRows(resolution, [&](uint32_t rowBegin, uint32_t rowEnd) {
+        for (uint32_t y = rowBegin; y < rowEnd; ++y) {
+            if (ShouldCancelGeneration()) {
+                throw std::runtime_error("Generation cancelled");
+            }
+
+            for (uint32_t i = y * resolution; i < (y + 1) * resolution; ++i) {
+                // Scale noise to elevation range
+                float normalizedNoise = (noiseData[i] + 1.0f) * 0.5f; // Convert from [-1,1] to [0,1]
+                float elevationValue = normalizedNoise * maxElevation * heightScale;
+
+                // Apply water coverage constraint
+                float waterThreshold = designTemplate.waterCoverage;
+                if (normalizedNoise < waterThreshold) {
+                    elevationValue = std::min(elevationValue, 0.0f); // Below sea level
+                }
+
+                elevation.data[i] = elevationValue;
+            }
         }
-        
-        elevation.data[i] = elevationValue;
+    });
+
+    // Return the noise scratch buffer to the arena for the next generation.
+    if (m_arena) {
+        m_arena->Recycle(std::move(noiseData));
     }
-    
+
     LOG_INFO("PlanetaryGenerator", "Generated elevation data with {} samples", elevation.data.size());
     return elevation;
 }
@@ -198,33 +279,35 @@ PlanetaryModality PlanetaryGenerator::GenerateTemperature(const PlanetaryDesignT
     temperature.name = "temperature";
     temperature.width = resolution;
     temperature.height = resolution;
-    temperature.data.resize(resolution * resolution);
+    temperature.data = AcquireBuffer(static_cast<size_t>(resolution) * resolution);
     
     float avgTemp = designTemplate.averageTemperature;
     float tempRange = designTemplate.temperatureRange;
     
-    for (uint32_t y = 0; y < resolution; ++y) {
-        for (uint32_t x = 0; x < resolution; ++x) {
+    ParallelForRows(resolution, [&](uint32_t rowBegin, uint32_t rowEnd) {
+        for (uint32_t y = rowBegin; y < rowEnd; ++y) {
             if (ShouldCancelGeneration()) {
                 throw std::runtime_error("Generation cancelled");
             }
-            
-            uint32_t index = y * resolution + x;
-            
-            // Latitude-based temperature (equator is warmer)
-            float latitude = (static_cast<float>(y) / resolution - 0.5f) * 2.0f; // [-1, 1]
-            float latitudeTemp = avgTemp - (std::abs(latitude) * tempRange * 0.5f);
-            
-            // Elevation-based temperature (higher is colder)
-            float elevationEffect = elevation.data[index] * -0.006f; // 6°C per km
-            
-            // Atmospheric effects
-            float atmosphereEffect = designTemplate.atmosphereDensity * 2.0f;
-            float greenhouseEffect = designTemplate.greenhouseEffect * 3.0f;
-            
-            temperature.data[index] = latitudeTemp + elevationEffect + atmosphereEffect + greenhouseEffect;
+
+            for (uint32_t x = 0; x < resolution; ++x) {
+                uint32_t index = y * resolution + x;
+
+                // Latitude-based temperature (equator is warmer)
+                float latitude = (static_cast<float>(y) / resolution - 0.5f) * 2.0f; // [-1, 1]
+                float latitudeTemp = avgTemp - (std::abs(latitude) * tempRange * 0.5f);
+
+                // Elevation-based temperature (higher is colder)
+                float elevationEffect = elevation.data[index] * -0.006f; // 6°C per km
+
+                // Atmospheric effects
+                float atmosphereEffect = designTemplate.atmosphereDensity * 2.0f;
+                float greenhouseEffect = designTemplate.greenhouseEffect * 3.0f;
+
+                temperature.data[index] = latitudeTemp + elevationEffect + atmosphereEffect + greenhouseEffect;
+            }
         }
-    }
+    });
     
     LOG_INFO("PlanetaryGenerator", "Generated temperature data with {} samples", temperature.data.size());
     return temperature;
@@ -238,31 +321,33 @@ PlanetaryModality PlanetaryGenerator::GeneratePrecipitation(const PlanetaryDesig
     precipitation.name = "precipitation";
     precipitation.width = resolution;
     precipitation.height = resolution;
-    precipitation.data.resize(resolution * resolution);
+    precipitation.data = AcquireBuffer(static_cast<size_t>(resolution) * resolution);
     
     float basePrecipitation = designTemplate.precipitationLevel;
     
-    for (uint32_t y = 0; y < resolution; ++y) {
-        for (uint32_t x = 0; x < resolution; ++x) {
+    ParallelForRows(resolution, [&](uint32_t rowBegin, uint32_t rowEnd) {
+        for (uint32_t y = rowBegin; y < rowEnd; ++y) {
             if (ShouldCancelGeneration()) {
                 throw std::runtime_error("Generation cancelled");
             }
-            
-            uint32_t index = y * resolution + x;
-            
-            // Temperature-based precipitation (warmer air holds more moisture)
-            float tempEffect = std::max(0.0f, temperature.data[index] / 30.0f); // Normalize to ~30°C
-            
-            // Elevation-based precipitation (orographic effect)
-            float elevationEffect = std::max(0.0f, elevation.data[index] / 1000.0f); // Per km
-            
-            // Distance from equator (tropical rain belt)
-            float latitude = (static_cast<float>(y) / resolution - 0.5f) * 2.0f; // [-1, 1]
-            float latitudeEffect = 1.0f - std::abs(latitude);
-            
-            precipitation.data[index] = basePrecipitation * tempEffect * (1.0f + elevationEffect * 0.3f) * latitudeEffect;
+
+            for (uint32_t x = 0; x < resolution; ++x) {
+                uint32_t index = y * resolution + x;
+
+                // Temperature-based precipitation (warmer air holds more moisture)
+                float tempEffect = std::max(0.0f, temperature.data[index] / 30.0f); // Normalize to ~30°C
+
+                // Elevation-based precipitation (orographic effect)
+                float elevationEffect = std::max(0.0f, elevation.data[index] / 1000.0f); // Per km
+
+                // Distance from equator (tropical rain belt)
+                float latitude = (static_cast<float>(y) / resolution - 0.5f) * 2.0f; // [-1, 1]
+                float latitudeEffect = 1.0f - std::abs(latitude);
+
+                precipitation.data[index] = basePrecipitation * tempEffect * (1.0f + elevationEffect * 0.3f) * latitudeEffect;
+            }
         }
-    }
+    });
     
     LOG_INFO("PlanetaryGenerator", "Generated precipitation data with {} samples", precipitation.data.size());
     return precipitation;
@@ -277,46 +362,117 @@ PlanetaryModality PlanetaryGenerator::GenerateVegetation(const PlanetaryDesignTe
     vegetation.name = "vegetation";
     vegetation.width = resolution;
     vegetation.height = resolution;
-    vegetation.data.resize(resolution * resolution);
+    vegetation.data = AcquireBuffer(static_cast<size_t>(resolution) * resolution);
     
     float baseVegetation = designTemplate.vegetationCoverage;
     
-    for (uint32_t i = 0; i < resolution * resolution; ++i) {
-        if (ShouldCancelGeneration()) {
-            throw std::runtime_error("Generation cancelled");
-        }
-        
-        // Water areas have no vegetation
-        if (elevation.data[i] <= 0.0f) {
-            vegetation.data[i] = 0.0f;
-            continue;
+    ParallelForRows(resolution, [&](uint32_t rowBegin, uint32_t rowEnd) {
+        for (uint32_t y = rowBegin; y < rowEnd; ++y) {
+            if (ShouldCancelGeneration()) {
+                throw std::runtime_error("Generation cancelled");
+            }
+
+            for (uint32_t i = y * resolution; i < (y + 1) * resolution; ++i) {
+                // Water areas have no vegetation
+                if (elevation.data[i] <= 0.0f) {
+                    vegetation.data[i] = 0.0f;
+                    continue;
+                }
+
+                // Temperature suitability (optimal around 20-25°C)
+                float tempSuitability = 1.0f - std::abs(temperature.data[i] - 22.5f) / 40.0f;
+                tempSuitability = std::max(0.0f, std::min(1.0f, tempSuitability));
+
+                // Precipitation suitability (more rain = more vegetation)
+                float precipSuitability = std::min(1.0f, precipitation.data[i] / 1000.0f);
+
+                // Elevation suitability (too high = less vegetation)
+                float elevSuitability = std::max(0.0f, 1.0f - elevation.data[i] / 4000.0f);
+
+                vegetation.data[i] = baseVegetation * tempSuitability * precipSuitability * elevSuitability;
+            }
         }
-        
-        // Temperature suitability (optimal around 20-25°C)
-        float tempSuitability = 1.0f - std::abs(temperature.data[i] - 22.5f) / 40.0f;
-        tempSuitability = std::max(0.0f, std::min(1.0f, tempSuitability));
-        
-        // Precipitation suitability (more rain = more vegetation)
-        float precipSuitability = std::min(1.0f, precipitation.data[i] / 1000.0f);
-        
-        // Elevation suitability (too high = less vegetation)
-        float elevSuitability = std::max(0.0f, 1.0f - elevation.data[i] / 4000.0f);
-        
-        vegetation.data[i] = baseVegetation * tempSuitability * precipSuitability * elevSuitability;
-    }
+    });
     
     LOG_INFO("PlanetaryGenerator", "Generated vegetation data with {} samples", vegetation.data.size());
     return vegetation;
 }
 
 void PlanetaryGenerator::UpdateProgress(float progress) {
-    m_progress = std::max(0.0f, std::min(1.0f, progress));
+    // Monotonic CAS update so concurrent phases can report progress without
+    // the displayed value ever moving backwards.
+    float clamped = std::max(0.0f, std::min(1.0f, progress));
+    float current = m_progress.load(std::memory_order_relaxed);
+    while (clamped > current &&
+           !m_progress.compare_exchange_weak(current, clamped, std::memory_order_relaxed)) {
+    }
 }
 
 bool PlanetaryGenerator::ShouldCancelGeneration() const {
     return m_cancellationRequested;
 }
 
+void PlanetaryGenerator::ParallelForRows(uint32_t rowCount, const std::function<void(uint32_t, uint32_t)>& body) const {
+    // Small grids are not worth the scheduling overhead.
+    constexpr uint32_t kMinRowsPerBand = 16;
+    const uint32_t workerCount = std::max(1u, std::thread::hardware_concurrency());
+
+    if (!m_parallelGeneration || rowCount < kMinRowsPerBand * 2) {
+        body(0, rowCount);
+        return;
+    }
+
+    const uint32_t bandCount = std::min(workerCount, rowCount / kMinRowsPerBand);
+    const uint32_t rowsPerBand = (rowCount + bandCount - 1) / bandCount;
+
+    auto& jobSystem = PlanetGen::Core::Threading::JobSystem::Instance();
+    std::vector<PlanetGen::Core::Threading::Job*> jobs;
+    jobs.reserve(bandCount);
+
+    for (uint32_t band = 0; band < bandCount; ++band) {
+        uint32_t rowBegin = band * rowsPerBand;
+        uint32_t rowEnd = std::min(rowBegin + rowsPerBand, rowCount);
+        if (rowBegin >= rowEnd) {
+            break;
+        }
+
+        std::string jobName = "PlanetaryGen_RowBand_" + std::to_string(band);
+        jobs.push_back(jobSystem.CreateJob<void>([&body, rowBegin, rowEnd]() {
+            body(rowBegin, rowEnd);
+        }, jobName.c_str()));
+    }
+
+    auto handles = jobSystem.ScheduleBatch(jobs);
+
+    // Wait for every band; the first stored exception (e.g. cancellation)
+    // is re-thrown after all bands are accounted for.
+    std::exception_ptr firstError;
+    for (auto& handle : handles) {
+        try {
+            handle.Wait();
+        } catch (...) {
+            if (!firstError) {
+                firstError = std::current_exception();
+            }
+        }
+    }
+
+    for (auto* job : jobs) {
+        delete job;
+    }
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+std::vector<float> PlanetaryGenerator::AcquireBuffer(size_t count) const {
+    if (m_arena) {
+        return m_arena->Acquire(count);
+    }
+    return std::vector<float>(count);
+}
+
 void PlanetaryGenerator::ValidateDesignTemplate(const PlanetaryDesignTemplate& designTemplate) const {
     if (designTemplate.planetRadius <= 0.0f) {
         throw std::invalid_argument("Planet radius must be positive");
@@ -338,35 +494,38 @@ void PlanetaryGenerator::ValidateDesignTemplate(const PlanetaryDesignTemplate& d
 }
 
 PlanetaryData PlanetaryGenerator::AssemblePlanetaryData(const PlanetaryDesignTemplate& designTemplate,
-                                                       const PlanetaryModality& elevation,
-                                                       const PlanetaryModality& temperature,
-                                                       const PlanetaryModality& precipitation,
-                                                       const PlanetaryModality& vegetation) const {
+                                                       PlanetaryModality elevation,
+                                                       PlanetaryModality temperature,
+                                                       PlanetaryModality precipitation,
+                                                       PlanetaryModality vegetation) const {
     PlanetaryData data;
-    
+
     // Copy basic properties from template
     data.planetRadius = static_cast<uint32_t>(designTemplate.planetRadius);
     data.seaLevel = 0.0f; // Standard sea level
     data.axialTilt = vec3(23.5f, 0.0f, 0.0f); // Earth-like axial tilt
+
+    // Move the modalities into the structure - the grids are never copied
+    data.elevation = std::move(elevation);
+    data.temperature = std::move(temperature);
+    data.precipitation = std::move(precipitation);
+    data.vegetation = std::move(vegetation);
     
-    // Assign the modalities to the structure
-    data.elevation = elevation;
-    data.temperature = temperature;
-    data.precipitation = precipitation;
-    data.vegetation = vegetation;
-    
-    // Initialize other modalities with empty data
-    data.humidity = PlanetaryModality{"humidity", {}, elevation.width, elevation.height, 0.0f, 100.0f};
-    data.windSpeed = PlanetaryModality{"windSpeed", {}, elevation.width, elevation.height, 0.0f, 50.0f};
-    data.geology = PlanetaryModality{"geology", {}, elevation.width, elevation.height, 0.0f, 1.0f};
-    data.landUse = PlanetaryModality{"landUse", {}, elevation.width, elevation.height, 0.0f, 1.0f};
-    data.slope = PlanetaryModality{"slope", {}, elevation.width, elevation.height, 0.0f, 90.0f};
-    data.aspect = PlanetaryModality{"aspect", {}, elevation.width, elevation.height, 0.0f, 360.0f};
-    data.drainage = PlanetaryModality{"drainage", {}, elevation.width, elevation.height, 0.0f, 1.0f};
-    data.erosion = PlanetaryModality{"erosion", {}, elevation.width, elevation.height, 0.0f, 1.0f};
-    
+    // Initialize other modalities with empty data (the local modalities were
+    // moved from above, so dimensions come from the assembled structure)
+    uint32_t gridWidth = data.elevation.width;
+    uint32_t gridHeight = data.elevation.height;
+    data.humidity = PlanetaryModality{"humidity", {}, gridWidth, gridHeight, 0.0f, 100.0f};
+    data.windSpeed = PlanetaryModality{"windSpeed", {}, gridWidth, gridHeight, 0.0f, 50.0f};
+    data.geology = PlanetaryModality{"geology", {}, gridWidth, gridHeight, 0.0f, 1.0f};
+    data.landUse = PlanetaryModality{"landUse", {}, gridWidth, gridHeight, 0.0f, 1.0f};
+    data.slope = PlanetaryModality{"slope", {}, gridWidth, gridHeight, 0.0f, 90.0f};
+    data.aspect = PlanetaryModality{"aspect", {}, gridWidth, gridHeight, 0.0f, 360.0f};
+    data.drainage = PlanetaryModality{"drainage", {}, gridWidth, gridHeight, 0.0f, 1.0f};
+    data.erosion = PlanetaryModality{"erosion", {}, gridWidth, gridHeight, 0.0f, 1.0f};
+
     // Initialize empty data for the empty modalities
-    size_t dataSize = elevation.width * elevation.height;
+    size_t dataSize = static_cast<size_t>(gridWidth) * gridHeight;
     data.humidity.data.resize(dataSize, 50.0f); // Default humidity
     data.windSpeed.data.resize(dataSize, 0.0f);
     data.geology.data.resize(dataSize, 0.5f);
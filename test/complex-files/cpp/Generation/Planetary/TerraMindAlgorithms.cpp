@@ -8,6 +8,12 @@ module;
 #include <iostream>
 #include <unordered_map>
 
+#include "Core/Math/MathUtils.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -82,6 +88,129 @@ float PlanetaryModality::sample(float x, float y) const {
 
 namespace PlanetGen::Generation {
 
+namespace {
+
+namespace FastMath = PlanetGen::Core::Math::MathUtils;
+
+// Span kernels for the modality transformation rules below. Each processes a
+// contiguous run of samples; the AVX2 path handles 8 lanes per iteration with
+// a scalar tail that uses the same fast approximations, so both paths agree.
+
+// out[i] = max(200, rowBaseTemp - elev[i] * lapseRate) for one latitude row
+void ElevationToTemperatureRow(const float* elev, float* out, size_t count, float rowBaseTemp) {
+    constexpr float kLapseRate = 0.0065f;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 base = _mm256_set1_ps(rowBaseTemp);
+    const __m256 negLapse = _mm256_set1_ps(-kLapseRate);
+    const __m256 floor = _mm256_set1_ps(200.0f);
+    for (; i + 8 <= count; i += 8) {
+        __m256 e = _mm256_loadu_ps(elev + i);
+        __m256 t = _mm256_fmadd_ps(e, negLapse, base);
+        _mm256_storeu_ps(out + i, _mm256_max_ps(t, floor));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        out[i] = std::max(200.0f, rowBaseTemp - elev[i] * kLapseRate);
+    }
+}
+
+// Orographic precipitation: rises with elevation up to 3000m, falls above
+void ElevationToPrecipitationSpan(const float* elev, float* out, size_t count) {
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 basePrecip = _mm256_set1_ps(500.0f);
+    const __m256 lowSlope = _mm256_set1_ps(0.3f);
+    const __m256 highIntercept = _mm256_set1_ps(1700.0f);   // 1400 + 3000 * 0.1
+    const __m256 negHighSlope = _mm256_set1_ps(-0.1f);
+    const __m256 ridge = _mm256_set1_ps(3000.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 8 <= count; i += 8) {
+        __m256 e = _mm256_loadu_ps(elev + i);
+        __m256 mid = _mm256_fmadd_ps(e, lowSlope, basePrecip);
+        __m256 high = _mm256_fmadd_ps(e, negHighSlope, highIntercept);
+        __m256 p = _mm256_blendv_ps(basePrecip, mid,
+                                    _mm256_cmp_ps(e, zero, _CMP_GT_OQ));
+        p = _mm256_blendv_ps(p, high, _mm256_cmp_ps(e, ridge, _CMP_GE_OQ));
+        _mm256_storeu_ps(out + i, _mm256_max_ps(p, zero));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        float elevation = elev[i];
+        float basePrecipValue = 500.0f;
+        if (elevation > 0.0f && elevation < 3000.0f) {
+            basePrecipValue += elevation * 0.3f;
+        } else if (elevation >= 3000.0f) {
+            basePrecipValue = 1400.0f - (elevation - 3000.0f) * 0.1f;
+        }
+        out[i] = std::max(0.0f, basePrecipValue);
+    }
+}
+
+// Bell curve around 293K: clamp01(exp(-((t - 293) / 30)^2))
+void TemperatureToVegetationSpan(const float* temp, float* out, size_t count) {
+    constexpr float kOptimalTemp = 293.0f;
+    constexpr float kInvTempRange = 1.0f / 30.0f;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 optimal = _mm256_set1_ps(kOptimalTemp);
+    const __m256 invRange = _mm256_set1_ps(kInvTempRange);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    for (; i + 8 <= count; i += 8) {
+        __m256 t = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(temp + i), optimal), invRange);
+        __m256 density = FastMath::fastExp8(_mm256_mul_ps(_mm256_sub_ps(zero, t), t));
+        _mm256_storeu_ps(out + i, _mm256_max_ps(zero, _mm256_min_ps(one, density)));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        float t = (temp[i] - kOptimalTemp) * kInvTempRange;
+        float density = FastMath::fastExp(-t * t);
+        out[i] = std::max(0.0f, std::min(1.0f, density));
+    }
+}
+
+// Generic rule: out = sin(n * PI) * 0.8 + n * 0.2 with n normalized to [0,1]
+void GenericSineTransformSpan(const float* in, float* out, size_t count,
+                              float minValue, float invRange) {
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256 minVal = _mm256_set1_ps(minValue);
+    const __m256 invRangeV = _mm256_set1_ps(invRange);
+    const __m256 pi = _mm256_set1_ps(static_cast<float>(M_PI));
+    const __m256 sineWeight = _mm256_set1_ps(0.8f);
+    const __m256 linearWeight = _mm256_set1_ps(0.2f);
+    for (; i + 8 <= count; i += 8) {
+        __m256 n = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(in + i), minVal), invRangeV);
+        __m256 s = FastMath::fastSin8(_mm256_mul_ps(n, pi));
+        _mm256_storeu_ps(out + i, _mm256_fmadd_ps(s, sineWeight,
+                                                  _mm256_mul_ps(n, linearWeight)));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        float n = (in[i] - minValue) * invRange;
+        out[i] = FastMath::fastSin(n * static_cast<float>(M_PI)) * 0.8f + n * 0.2f;
+    }
+}
+
+// Uniform scale of one row; plain loop - the compiler vectorizes a bare
+// multiply without help.
+void ScaleSpan(float* data, size_t count, float factor) {
+    for (size_t i = 0; i < count; ++i) {
+        data[i] *= factor;
+    }
+}
+
+} // namespace
+
 // Additional implementations for PlanetaryGenerator inspired by TerraMind's approach
 
 // TerraMind-inspired modality processing functions
@@ -96,69 +225,37 @@ PlanetaryModality PlanetaryGenerator::GenerateFromModality(const PlanetaryModali
     std::cout << "[PlanetaryGenerator] Generating " << targetModalityType 
               << " from " << input.name << " using TerraMind-inspired algorithms" << std::endl;
     
-    // TerraMind-inspired transformation rules
+    // TerraMind-inspired transformation rules, dispatched to the span kernels
     if (input.name == "elevation" && targetModalityType == "temperature") {
-        // Elevation-to-temperature transformation
-        for (size_t i = 0; i < input.data.size(); ++i) {
-            uint32_t y = i / input.width;
+        // Elevation-to-temperature transformation; base temperature from
+        // latitude is constant per row, lapse rate is 6.5°C per 1000m
+        for (uint32_t y = 0; y < input.height; ++y) {
             float latitude = (static_cast<float>(y) / (input.height - 1) - 0.5f) * 180.0f;
-            float elevation = input.data[i];
-            
-            // Base temperature from latitude
-            float baseTemp = 288.0f - std::abs(latitude) * 0.5f;
-            // Lapse rate (6.5°C per 1000m)
-            baseTemp -= elevation * 0.0065f;
-            
-            output.data[i] = std::max(200.0f, baseTemp);  // Minimum 200K
+            float rowBaseTemp = 288.0f - std::abs(latitude) * 0.5f;
+            size_t rowStart = static_cast<size_t>(y) * input.width;
+            ElevationToTemperatureRow(input.data.data() + rowStart,
+                                      output.data.data() + rowStart,
+                                      input.width, rowBaseTemp);
         }
     }
     else if (input.name == "elevation" && targetModalityType == "precipitation") {
         // Elevation-to-precipitation transformation (orographic effects)
-        for (size_t i = 0; i < input.data.size(); ++i) {
-            float elevation = input.data[i];
-            
-            // More precipitation at higher elevations (up to a point)
-            float basePrecip = 500.0f;  // Base precipitation
-            if (elevation > 0.0f && elevation < 3000.0f) {
-                basePrecip += elevation * 0.3f;  // Increase with elevation
-            } else if (elevation >= 3000.0f) {
-                basePrecip = 1400.0f - (elevation - 3000.0f) * 0.1f;  // Decrease at very high elevations
-            }
-            
-            output.data[i] = std::max(0.0f, basePrecip);
-        }
+        ElevationToPrecipitationSpan(input.data.data(), output.data.data(), input.data.size());
     }
     else if (input.name == "temperature" && targetModalityType == "vegetation") {
-        // Temperature-to-vegetation transformation
-        for (size_t i = 0; i < input.data.size(); ++i) {
-            float temp = input.data[i];
-            
-            // Vegetation density based on temperature (bell curve around 20°C = 293K)
-            float optimalTemp = 293.0f;
-            float tempRange = 30.0f;
-            float vegDensity = std::exp(-std::pow((temp - optimalTemp) / tempRange, 2.0f));
-            
-            output.data[i] = std::max(0.0f, std::min(1.0f, vegDensity));
-        }
+        // Temperature-to-vegetation transformation (bell curve around 20°C = 293K)
+        TemperatureToVegetationSpan(input.data.data(), output.data.data(), input.data.size());
     }
     else {
         // Generic transformation using statistical relationships
-        std::cout << "[PlanetaryGenerator] Using generic transformation for " 
+        std::cout << "[PlanetaryGenerator] Using generic transformation for "
                   << input.name << " -> " << targetModalityType << std::endl;
-        
+
         // Apply a learned transformation (simplified version of TerraMind's approach)
-        for (size_t i = 0; i < input.data.size(); ++i) {
-            float value = input.data[i];
-            
-            // Normalize input value
-            float normalizedInput = (value - input.minValue) / (input.maxValue - input.minValue);
-            
-            // Apply non-linear transformation
-            float transformedValue = std::sin(normalizedInput * M_PI) * 0.8f + 
-                                   normalizedInput * 0.2f;
-            
-            output.data[i] = transformedValue;
-        }
+        float range = input.maxValue - input.minValue;
+        float invRange = (range != 0.0f) ? 1.0f / range : 0.0f;
+        GenericSineTransformSpan(input.data.data(), output.data.data(),
+                                 input.data.size(), input.minValue, invRange);
     }
     
     // Calculate output statistics
@@ -324,13 +421,11 @@ void PlanetaryGenerator::ApplySeasonalVariation(PlanetaryModality& modality, flo
         float latitude = (static_cast<float>(y) / (modality.height - 1) - 0.5f) * 180.0f;
         
         // Calculate seasonal effect based on latitude and day of year
-        float seasonalEffect = std::sin((dayOfYear - 80.0f) * 2.0f * M_PI / 365.25f) * 
+        float seasonalEffect = std::sin((dayOfYear - 80.0f) * 2.0f * M_PI / 365.25f) *
                               std::sin(latitude * M_PI / 180.0f) * 0.2f;
-        
-        for (uint32_t x = 0; x < modality.width; ++x) {
-            size_t idx = y * modality.width + x;
-            modality.data[idx] *= (1.0f + seasonalEffect);
-        }
+
+        ScaleSpan(modality.data.data() + static_cast<size_t>(y) * modality.width,
+                  modality.width, 1.0f + seasonalEffect);
     }
 }
 
@@ -3,6 +3,8 @@ module;
 #include <algorithm>
 #include <vector>
 
+#include "Core/Math/MathUtils.h"
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -128,7 +130,8 @@ PlanetaryModality PlanetaryGenerator::GenerateHumidity(const PlanetaryModality&
         // But if there's no precipitation, it will be dry
         float tempEffect = 1.0f;
         if (temp > 273.0f && temp < 313.0f) { // 0°C to 40°C
-            tempEffect = 0.5f + 0.5f * std::sin((temp - 273.0f) / 40.0f * M_PI);
+            // Argument is within [0, PI], inside the fast approximation's domain
+            tempEffect = 0.5f + 0.5f * Core::Math::MathUtils::fastSin((temp - 273.0f) / 40.0f * M_PI);
         } else if (temp <= 273.0f) {
             tempEffect = 0.3f; // Cold air holds less moisture
         } else {
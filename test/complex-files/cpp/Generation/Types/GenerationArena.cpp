@@ -0,0 +1,79 @@
+module;
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+module GenerationArena;
+
+namespace PlanetGen::Generation {
+
+std::vector<float> GenerationArena::Acquire(size_t count) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Best-fit scan: the pool stays small (a handful of modality-sized
+        // buffers), so linear search beats maintaining a sorted structure.
+        size_t bestIndex = m_pool.size();
+        size_t bestCapacity = 0;
+        for (size_t i = 0; i < m_pool.size(); ++i) {
+            size_t capacity = m_pool[i].capacity();
+            if (capacity >= count && (bestIndex == m_pool.size() || capacity < bestCapacity)) {
+                bestIndex = i;
+                bestCapacity = capacity;
+            }
+        }
+
+        if (bestIndex != m_pool.size()) {
+            std::vector<float> buffer = std::move(m_pool[bestIndex]);
+            m_pool.erase(m_pool.begin() + bestIndex);
+            buffer.resize(count);
+            return buffer;
+        }
+    }
+
+    return std::vector<float>(count);
+}
+
+void GenerationArena::Recycle(std::vector<float>&& buffer) {
+    if (buffer.capacity() == 0) {
+        return;
+    }
+    buffer.clear();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pool.push_back(std::move(buffer));
+}
+
+void GenerationArena::Recycle(PlanetaryData&& data) {
+    Recycle(std::move(data.elevation.data));
+    Recycle(std::move(data.temperature.data));
+    Recycle(std::move(data.precipitation.data));
+    Recycle(std::move(data.humidity.data));
+    Recycle(std::move(data.windSpeed.data));
+    Recycle(std::move(data.vegetation.data));
+    Recycle(std::move(data.geology.data));
+    Recycle(std::move(data.landUse.data));
+    Recycle(std::move(data.slope.data));
+    Recycle(std::move(data.aspect.data));
+    Recycle(std::move(data.drainage.data));
+    Recycle(std::move(data.erosion.data));
+}
+
+void GenerationArena::Reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pool.clear();
+    m_pool.shrink_to_fit();
+}
+
+size_t GenerationArena::GetPooledBytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t bytes = 0;
+    for (const auto& buffer : m_pool) {
+        bytes += buffer.capacity() * sizeof(float);
+    }
+    return bytes;
+}
+
+} // namespace PlanetGen::Generation
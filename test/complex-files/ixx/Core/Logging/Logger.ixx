@@ -15,6 +15,9 @@ module;
 #include <source_location>
 #include <csignal>
 #include <cstdio>
+#include <cstdint>
+#include <thread>
+#include <vector>
 
 export module Core.Logging.Logger;
 
@@ -44,6 +47,9 @@ export namespace Core::Logging {
         }
         
         ~Logger() {
+            // Drain pending async records before touching the file stream
+            stopAsyncSink();
+
             // Ensure file is properly closed and flushed
             std::lock_guard lock(m_fileMutex);
             if (m_fileStream) {
@@ -52,6 +58,21 @@ export namespace Core::Logging {
             }
         }
 
+        // Enable/disable the asynchronous backend. When enabled, log() only
+        // formats its arguments and pushes a record into a per-thread
+        // lock-free ring; a dedicated sink thread assembles the final line
+        // (timestamp, level, location) and performs console/file I/O. A full
+        // ring drops the record and counts it rather than blocking the
+        // producer - the sink reports the gap when it next drains that ring.
+        // Disabling (or destroying the logger) drains everything first.
+        void setAsyncEnabled(bool enabled) {
+            if (enabled) {
+                startAsyncSink();
+            } else {
+                stopAsyncSink();
+            }
+        }
+
         // Set global log level (affects both console and file)
         void setLevel(LogLevel level) {
             m_globalLevel.store(level);
@@ -100,10 +121,8 @@ export namespace Core::Logging {
         // Smart logging: log a message only once
         template<typename... Args>
         void logOnce(LogLevel level, const LogContext& context, std::string_view format, Args&&... args) {
-            std::string key = std::string(context.component) + ":" + 
-                std::string(context.location.file_name()) + ":" + 
-                std::to_string(context.location.line());
-            
+            uint64_t key = callSiteKey(context);
+
             std::lock_guard lock(m_onceMutex);
             if (m_onceMessages.find(key) != m_onceMessages.end()) {
                 return; // Already logged
@@ -116,9 +135,7 @@ export namespace Core::Logging {
         // Rate-limited logging: log at most N times per second
         template<typename... Args>
         void logRateLimited(LogLevel level, const LogContext& context, int maxPerSecond, std::string_view format, Args&&... args) {
-            std::string key = std::string(context.component) + ":" + 
-                std::string(context.location.file_name()) + ":" + 
-                std::to_string(context.location.line());
+            uint64_t key = callSiteKey(context);
             auto now = std::chrono::steady_clock::now();
             
             std::lock_guard lock(m_rateLimitMutex);
@@ -210,22 +227,18 @@ export namespace Core::Logging {
             } else {
                 message = std::string(format);
             }
-            
-            auto timestamp = getCurrentTimestamp();
-            auto levelStr = getLevelString(level);
-            
-            // Format the final message - use runtime format to avoid C++23 compile-time checks
-            std::string formattedMessage;
-            formattedMessage.reserve(256); // Pre-allocate for performance
-            formattedMessage = "[" + timestamp + "] [" + levelStr + "] [" + std::string(context.component) + "] " + message;
 
-            // Add location info for debug and trace levels
-            if (level <= LogLevel::DEBUG) {
-                formattedMessage += " (" + std::string(context.location.file_name()) + ":" + 
-                    std::to_string(context.location.line()) + ")";
+            // Async path: hand the record to the sink thread and return.
+            // Timestamp/level/location assembly and the actual I/O happen
+            // off the calling thread.
+            if (m_asyncEnabled.load(std::memory_order_relaxed)) {
+                enqueueAsync(level, context, std::move(message));
+                return;
             }
 
-            output(formattedMessage, level);
+            emitRecord(level, context.component, context.location.file_name(),
+                       context.location.line(), message,
+                       std::chrono::system_clock::now());
         }
 
         // Convenience methods
@@ -316,8 +329,30 @@ export namespace Core::Logging {
             return level >= m_globalLevel.load();
         }
 
-        std::string getCurrentTimestamp() const {
-            auto now = std::chrono::system_clock::now();
+        // Assembles the final log line and writes it. Shared by the
+        // synchronous path (calling thread) and the async sink thread.
+        void emitRecord(LogLevel level, std::string_view component,
+                        const char* fileName, uint32_t line,
+                        const std::string& message,
+                        std::chrono::system_clock::time_point when) {
+            auto timestamp = formatTimestamp(when);
+            auto levelStr = getLevelString(level);
+
+            // Format the final message - use runtime format to avoid C++23 compile-time checks
+            std::string formattedMessage;
+            formattedMessage.reserve(256); // Pre-allocate for performance
+            formattedMessage = "[" + timestamp + "] [" + levelStr + "] [" + std::string(component) + "] " + message;
+
+            // Add location info for debug and trace levels
+            if (level <= LogLevel::DEBUG && fileName) {
+                formattedMessage += " (" + std::string(fileName) + ":" +
+                    std::to_string(line) + ")";
+            }
+
+            output(formattedMessage, level);
+        }
+
+        std::string formatTimestamp(std::chrono::system_clock::time_point now) const {
             auto time_t_val = std::chrono::system_clock::to_time_t(now);
             auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
                 now.time_since_epoch()) % 1000;
@@ -388,16 +423,200 @@ export namespace Core::Logging {
         
         // Smart logging state
         std::mutex m_onceMutex;
-        std::unordered_set<std::string> m_onceMessages;
-        
+        std::unordered_set<uint64_t> m_onceMessages;
+
         struct RateLimitInfo {
             int count = 0;
             int suppressedCount = 0;
             std::chrono::steady_clock::time_point lastReset = std::chrono::steady_clock::now();
         };
-        
+
         std::mutex m_rateLimitMutex;
-        std::unordered_map<std::string, RateLimitInfo> m_rateLimitInfo;
+        std::unordered_map<uint64_t, RateLimitInfo> m_rateLimitInfo;
+
+        // Call sites are uniquely identified by the source_location's
+        // static-storage file-name pointer and line number, so the once/
+        // rate-limit bookkeeping avoids building a string key per call
+        static uint64_t callSiteKey(const LogContext& context) {
+            return (reinterpret_cast<uint64_t>(context.location.file_name()) << 12) ^
+                   static_cast<uint64_t>(context.location.line());
+        }
+
+        // ---- Asynchronous backend ----
+
+        // Record handed from a producing thread to the sink thread. The
+        // message arguments are already formatted (std::format_args cannot
+        // be stored past the call), but timestamp rendering, line assembly
+        // and I/O all happen on the sink.
+        struct AsyncRecord {
+            LogLevel level = LogLevel::INFO;
+            std::chrono::system_clock::time_point time;
+            std::string component;
+            std::string message;
+            const char* fileName = nullptr;   // Static storage from source_location
+            uint32_t line = 0;
+        };
+
+        // Fixed-capacity single-producer/single-consumer ring. The owning
+        // thread is the only pusher and the sink thread the only popper, so
+        // one release store per side is enough - no locks, no CAS. A full
+        // ring drops the record and bumps m_dropped instead of blocking.
+        class AsyncLogRing {
+        public:
+            bool TryPush(AsyncRecord&& record) {
+                size_t tail = m_tail.load(std::memory_order_relaxed);
+                size_t head = m_head.load(std::memory_order_acquire);
+                if (tail - head >= kCapacity) {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                m_slots[tail & kMask] = std::move(record);
+                m_tail.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            bool TryPop(AsyncRecord& out) {
+                size_t head = m_head.load(std::memory_order_relaxed);
+                if (head == m_tail.load(std::memory_order_acquire)) {
+                    return false;
+                }
+                out = std::move(m_slots[head & kMask]);
+                m_head.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            bool IsEmpty() const {
+                return m_head.load(std::memory_order_acquire) ==
+                       m_tail.load(std::memory_order_acquire);
+            }
+
+            // Returns and clears the overflow count accumulated since the
+            // last drain
+            uint64_t TakeDroppedCount() {
+                return m_dropped.exchange(0, std::memory_order_relaxed);
+            }
+
+            void MarkRetired() { m_retired.store(true, std::memory_order_release); }
+            bool IsRetired() const { return m_retired.load(std::memory_order_acquire); }
+
+        private:
+            static constexpr size_t kCapacity = 1024;
+            static constexpr size_t kMask = kCapacity - 1;
+
+            std::vector<AsyncRecord> m_slots{kCapacity};
+            std::atomic<size_t> m_head{0};
+            std::atomic<size_t> m_tail{0};
+            std::atomic<uint64_t> m_dropped{0};
+            std::atomic<bool> m_retired{false};
+        };
+
+        // Marks the thread's ring retired when the thread exits so the sink
+        // can drain it one last time and unregister it
+        struct ThreadRingHandle {
+            std::shared_ptr<AsyncLogRing> ring;
+            ~ThreadRingHandle() {
+                if (ring) {
+                    ring->MarkRetired();
+                }
+            }
+        };
+
+        std::shared_ptr<AsyncLogRing> getThreadRing() {
+            thread_local ThreadRingHandle t_handle;
+            if (!t_handle.ring) {
+                t_handle.ring = std::make_shared<AsyncLogRing>();
+                std::lock_guard lock(m_ringRegistryMutex);
+                m_rings.push_back(t_handle.ring);
+            }
+            return t_handle.ring;
+        }
+
+        void enqueueAsync(LogLevel level, const LogContext& context, std::string&& message) {
+            AsyncRecord record;
+            record.level = level;
+            record.time = std::chrono::system_clock::now();
+            record.component = std::string(context.component);
+            record.message = std::move(message);
+            record.fileName = context.location.file_name();
+            record.line = context.location.line();
+            getThreadRing()->TryPush(std::move(record));  // Drop-and-count on overflow
+        }
+
+        void startAsyncSink() {
+            std::lock_guard lock(m_sinkLifecycleMutex);
+            if (m_sinkRunning.load()) {
+                return;
+            }
+            m_sinkRunning.store(true);
+            m_asyncEnabled.store(true, std::memory_order_relaxed);
+            m_sinkThread = std::thread([this] { sinkLoop(); });
+        }
+
+        void stopAsyncSink() {
+            std::lock_guard lock(m_sinkLifecycleMutex);
+            if (!m_sinkRunning.load()) {
+                return;
+            }
+            // New messages go back to the synchronous path while the sink
+            // finishes whatever is already queued
+            m_asyncEnabled.store(false, std::memory_order_relaxed);
+            m_sinkRunning.store(false);
+            if (m_sinkThread.joinable()) {
+                m_sinkThread.join();
+            }
+            drainAllRings();
+        }
+
+        void sinkLoop() {
+            while (m_sinkRunning.load(std::memory_order_relaxed)) {
+                if (drainAllRings() == 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+            drainAllRings();  // Final pass after the stop flag flips
+        }
+
+        // Drains every registered ring, emits the records, and reports any
+        // overflow gaps. Returns the number of records written.
+        size_t drainAllRings() {
+            std::vector<std::shared_ptr<AsyncLogRing>> rings;
+            {
+                std::lock_guard lock(m_ringRegistryMutex);
+                rings = m_rings;
+            }
+
+            size_t drained = 0;
+            AsyncRecord record;
+            for (auto& ring : rings) {
+                while (ring->TryPop(record)) {
+                    emitRecord(record.level, record.component, record.fileName,
+                               record.line, record.message, record.time);
+                    ++drained;
+                }
+                if (uint64_t dropped = ring->TakeDroppedCount()) {
+                    emitRecord(LogLevel::WARN, "Logger", nullptr, 0,
+                               "Dropped " + std::to_string(dropped) +
+                                   " log records (producer ring full)",
+                               std::chrono::system_clock::now());
+                }
+            }
+
+            // Unregister rings whose threads have exited once they are empty
+            {
+                std::lock_guard lock(m_ringRegistryMutex);
+                std::erase_if(m_rings, [](const std::shared_ptr<AsyncLogRing>& ring) {
+                    return ring->IsRetired() && ring->IsEmpty();
+                });
+            }
+            return drained;
+        }
+
+        std::atomic<bool> m_asyncEnabled{false};
+        std::atomic<bool> m_sinkRunning{false};
+        std::mutex m_sinkLifecycleMutex;
+        std::thread m_sinkThread;
+        std::mutex m_ringRegistryMutex;
+        std::vector<std::shared_ptr<AsyncLogRing>> m_rings;
     };
 
 } // namespace Core::Logging
\ No newline at end of file
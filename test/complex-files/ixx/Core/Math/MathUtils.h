@@ -3,9 +3,16 @@
 #include "Core/Math/Vector3.h"
 #include <glm/glm.hpp>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <random>
+#include <span>
 #include <type_traits>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace PlanetGen {
 namespace Core {
 namespace Math {
@@ -146,6 +153,143 @@ inline float fastInvSqrt(float x) {
     return x;
 }
 
+// Fast exponential via 2^x splitting: x*log2(e) is separated into integer
+// and fractional parts, a cubic fit evaluates 2^frac, and the integer part
+// is applied through the float exponent bits. Max relative error ~3e-4.
+// Intended for falloff/weighting curves, not precision-sensitive analysis.
+inline float fastExp(float x) {
+    if (x < -87.0f) return 0.0f;   // Below float denormal range for e^x
+    if (x > 87.0f) x = 87.0f;      // Avoid exponent overflow
+
+    float t = x * 1.44269504f;     // log2(e)
+    float fi = std::floor(t);
+    float f = t - fi;
+
+    // Cubic fit of 2^f on [0, 1]
+    float p = 1.0f + f * (0.6951590f + f * (0.2285491f + f * 0.0782680f));
+
+    uint32_t bits = static_cast<uint32_t>(static_cast<int>(fi) + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+// Parabolic sine approximation for x in [-PI, PI], with one refinement
+// step. Max absolute error ~1e-3 - fine for climate falloff and seasonal
+// weighting, not for coordinate math.
+inline float fastSin(float x) {
+    constexpr float B = 4.0f / PI;
+    constexpr float C = -4.0f / (PI * PI);
+    float y = B * x + C * x * std::abs(x);
+    return 0.225f * (y * std::abs(y) - y) + y;
+}
+
+// Wraps an angle into [-PI, PI) so the range-limited approximations above
+// accept arbitrary input
+inline float wrapPi(float x) {
+    return x - TWO_PI * std::floor((x + PI) / TWO_PI);
+}
+
+// Cosine via the phase-shifted sine; wraps internally, so any input is
+// valid. Same ~1e-3 max absolute error as fastSin.
+inline float fastCos(float x) {
+    return fastSin(wrapPi(x + HALF_PI));
+}
+
+// Base-2 logarithm: exponent bits give the integer part, a cubic minimax
+// fit on the mantissa in [1, 2) gives the rest. Max absolute error ~3e-4.
+// Input must be positive and finite.
+inline float fastLog2(float x) {
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    float exponent = static_cast<float>(static_cast<int>(bits >> 23) - 127);
+
+    uint32_t mantissaBits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    float m;
+    std::memcpy(&m, &mantissaBits, sizeof(m));
+
+    float p = -1.49278f + (2.11263f + (-0.729104f + 0.10969f * m) * m) * m;
+    return exponent + p;
+}
+
+// 2^x through the same split as fastExp. Max relative error ~3e-4.
+inline float fastExp2(float x) {
+    if (x < -126.0f) return 0.0f;
+    if (x > 127.0f) x = 127.0f;
+
+    float fi = std::floor(x);
+    float f = x - fi;
+    float p = 1.0f + f * (0.6951590f + f * (0.2285491f + f * 0.0782680f));
+
+    uint32_t bits = static_cast<uint32_t>(static_cast<int>(fi) + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+// pow for positive bases as 2^(exponent * log2(base)). Relative error is
+// roughly 3e-4 plus 2e-4 * |exponent|, so keep exponents modest; use
+// std::pow where the result feeds analysis or coordinates.
+inline float fastPow(float base, float exponent) {
+    return fastExp2(exponent * fastLog2(base));
+}
+
+#if defined(__AVX2__)
+// 8-lane variants of the approximations above, for span kernels that
+// process modality grids. Same accuracy characteristics as the scalar forms.
+inline __m256 fastExp8(__m256 x) {
+    const __m256 lowCutoff = _mm256_set1_ps(-87.0f);
+    x = _mm256_min_ps(x, _mm256_set1_ps(87.0f));
+
+    __m256 t = _mm256_mul_ps(x, _mm256_set1_ps(1.44269504f));
+    __m256 fi = _mm256_floor_ps(t);
+    __m256 f = _mm256_sub_ps(t, fi);
+
+    __m256 p = _mm256_fmadd_ps(f, _mm256_set1_ps(0.0782680f), _mm256_set1_ps(0.2285491f));
+    p = _mm256_fmadd_ps(f, p, _mm256_set1_ps(0.6951590f));
+    p = _mm256_fmadd_ps(f, p, _mm256_set1_ps(1.0f));
+
+    __m256i bits = _mm256_slli_epi32(
+        _mm256_add_epi32(_mm256_cvtps_epi32(fi), _mm256_set1_epi32(127)), 23);
+    __m256 result = _mm256_mul_ps(p, _mm256_castsi256_ps(bits));
+
+    // Flush lanes below the representable range to zero
+    __m256 underflow = _mm256_cmp_ps(x, lowCutoff, _CMP_LT_OQ);
+    return _mm256_andnot_ps(underflow, result);
+}
+
+inline __m256 fastSin8(__m256 x) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 b = _mm256_set1_ps(4.0f / PI);
+    const __m256 c = _mm256_set1_ps(-4.0f / (PI * PI));
+
+    __m256 absX = _mm256_andnot_ps(signMask, x);
+    __m256 y = _mm256_fmadd_ps(_mm256_mul_ps(c, x), absX, _mm256_mul_ps(b, x));
+    __m256 absY = _mm256_andnot_ps(signMask, y);
+    return _mm256_fmadd_ps(_mm256_set1_ps(0.225f),
+                           _mm256_fmsub_ps(y, absY, y), y);
+}
+
+inline __m256 wrapPi8(__m256 x) {
+    const __m256 twoPi = _mm256_set1_ps(TWO_PI);
+    __m256 cycles = _mm256_floor_ps(
+        _mm256_div_ps(_mm256_add_ps(x, _mm256_set1_ps(PI)), twoPi));
+    return _mm256_fnmadd_ps(twoPi, cycles, x);
+}
+
+inline __m256 fastCos8(__m256 x) {
+    return fastSin8(wrapPi8(_mm256_add_ps(x, _mm256_set1_ps(HALF_PI))));
+}
+#endif
+
+// Span kernels over modality-sized arrays: 8-lane AVX2 inner loops with a
+// scalar tail, plain scalar loops elsewhere. Accuracy matches the scalar
+// approximations, which is why each call site opts in explicitly instead of
+// these replacing the libm routines globally.
+void fastSinSpan(std::span<const float> input, std::span<float> output);
+void fastCosSpan(std::span<const float> input, std::span<float> output);
+void fastExpSpan(std::span<const float> input, std::span<float> output);
+
 // Spherical harmonics basis functions (useful for atmospheric scattering)
 float sphericalHarmonicY00(const Vector3& dir);
 float sphericalHarmonicY1m1(const Vector3& dir);
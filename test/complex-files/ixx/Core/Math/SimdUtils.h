@@ -0,0 +1,62 @@
+#pragma once
+
+/**
+ * Internal SIMD helpers shared by the Core/Math batch kernels.
+ *
+ * Detects the available instruction set and provides the AoS<->SoA shuffles
+ * needed to run vertical SIMD over packed vec3 arrays. Scalar fallbacks are
+ * selected automatically when neither SSE nor NEON is available.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PLANETGEN_MATH_SSE 1
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#define PLANETGEN_MATH_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace PlanetGen {
+namespace Core {
+namespace Math {
+namespace detail {
+
+#if defined(PLANETGEN_MATH_SSE)
+
+/**
+ * De-interleaves four packed vec3s (12 consecutive floats) into x/y/z lanes.
+ * Standard 3-component AoS->SoA shuffle sequence.
+ */
+inline void LoadVec3SoA4(const float* p, __m128& x, __m128& y, __m128& z) {
+    __m128 x0y0z0x1 = _mm_loadu_ps(p);
+    __m128 y1z1x2y2 = _mm_loadu_ps(p + 4);
+    __m128 z2x3y3z3 = _mm_loadu_ps(p + 8);
+
+    __m128 x2y2x3y3 = _mm_shuffle_ps(y1z1x2y2, z2x3y3z3, _MM_SHUFFLE(2, 1, 3, 2));
+    __m128 y0z0y1z1 = _mm_shuffle_ps(x0y0z0x1, y1z1x2y2, _MM_SHUFFLE(1, 0, 2, 1));
+
+    x = _mm_shuffle_ps(x0y0z0x1, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+    z = _mm_shuffle_ps(y0z0y1z1, z2x3y3z3, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+/**
+ * Re-interleaves x/y/z lanes into four packed vec3s (12 consecutive floats)
+ */
+inline void StoreVec3SoA4(float* p, __m128 x, __m128 y, __m128 z) {
+    __m128 x0x2y0y2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 y1y3z1z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+    __m128 z0z2x1x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+    _mm_storeu_ps(p,     _mm_shuffle_ps(x0x2y0y2, z0z2x1x3, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(p + 4, _mm_shuffle_ps(y1y3z1z3, x0x2y0y2, _MM_SHUFFLE(3, 1, 2, 0)));
+    _mm_storeu_ps(p + 8, _mm_shuffle_ps(z0z2x1x3, y1y3z1z3, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+#endif // PLANETGEN_MATH_SSE
+
+} // namespace detail
+} // namespace Math
+} // namespace Core
+} // namespace PlanetGen
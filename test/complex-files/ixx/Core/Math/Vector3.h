@@ -4,6 +4,7 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <cmath>
 #include <ostream>
+#include <span>
 
 namespace PlanetGen {
 namespace Core {
@@ -15,8 +16,12 @@ namespace Math {
  * This class provides essential 3D vector operations needed for terrain
  * generation, mesh manipulation, and spatial calculations. It wraps glm::vec3
  * for performance while providing a clean interface.
+ *
+ * Storage is 16-byte aligned (one float of padding) so instances can be
+ * loaded and stored with aligned SIMD moves. Bulk work on packed vec3 arrays
+ * should go through the batch kernels below instead of per-instance calls.
  */
-class Vector3 {
+class alignas(16) Vector3 {
 public:
     // Constructors
     Vector3() = default;
@@ -111,6 +116,25 @@ inline Vector3 operator*(float scalar, const Vector3& vec) {
     return vec * scalar;
 }
 
+/**
+ * @brief Normalizes an array of packed vec3s with vertical SIMD
+ *
+ * Processes four vectors per iteration on SSE/NEON (scalar fallback
+ * otherwise); input and output may alias for in-place use. Zero-length
+ * vectors produce non-finite results, matching glm::normalize.
+ *
+ * @param input Packed source vectors
+ * @param output Destination, at least input.size() elements
+ */
+void NormalizeBatch(std::span<const glm::vec3> input, std::span<glm::vec3> output);
+
+/**
+ * @brief In-place overload of NormalizeBatch
+ */
+inline void NormalizeBatch(std::span<glm::vec3> vectors) {
+    NormalizeBatch({vectors.data(), vectors.size()}, vectors);
+}
+
 } // namespace Math
 } // namespace Core
 } // namespace PlanetGen 
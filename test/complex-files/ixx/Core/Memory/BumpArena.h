@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace PlanetGen {
+namespace Core {
+namespace Memory {
+
+/**
+ * A bump-pointer arena for transient allocations within a single unit of work.
+ *
+ * Allocation advances an offset into the current chunk; there is no per-object
+ * free. When the owning run publishes its result, Reset reclaims everything
+ * wholesale while retaining the largest chunk, so steady-state runs perform no
+ * allocator calls at all. Chunks grow geometrically when the arena overflows.
+ *
+ * The arena is intentionally not thread-safe: it is meant to be owned by one
+ * generation run and used from its coordinating thread. Use MemoryPool or
+ * ObjectPool for concurrent fixed-size allocation instead.
+ */
+class BumpArena {
+public:
+    /**
+     * Creates a new arena
+     * @param chunkSize Size in bytes of the first chunk
+     */
+    explicit BumpArena(size_t chunkSize = 1 << 20);
+
+    /**
+     * Destructor - implicitly frees all chunks
+     */
+    ~BumpArena() = default;
+
+    /**
+     * Allocates raw memory by bumping the current chunk's offset
+     * @param bytes Number of bytes to allocate
+     * @param alignment Required alignment, must be a power of two
+     * @return Pointer to the allocated memory
+     */
+    void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * Reclaims every allocation wholesale. The largest chunk is retained and
+     * rewound so the next run reuses its capacity; the rest are freed.
+     */
+    void Reset();
+
+    /**
+     * Gets the number of bytes currently bump-allocated
+     * @return Bytes in use across all chunks
+     */
+    size_t GetUsedBytes() const;
+
+    /**
+     * Gets the total capacity across all chunks
+     * @return Capacity in bytes
+     */
+    size_t GetCapacityBytes() const;
+
+    /**
+     * Disallow copying and moving - outstanding allocations point into chunks
+     */
+    BumpArena(const BumpArena&) = delete;
+    BumpArena& operator=(const BumpArena&) = delete;
+    BumpArena(BumpArena&&) = delete;
+    BumpArena& operator=(BumpArena&&) = delete;
+
+private:
+    struct Chunk {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size = 0;
+        size_t offset = 0;
+    };
+
+    // Appends a chunk large enough for the pending allocation
+    void AddChunk(size_t minBytes);
+
+    const size_t m_chunkSize;
+    std::vector<Chunk> m_chunks;
+};
+
+/**
+ * STL-compatible allocator adapter over a BumpArena.
+ *
+ * Containers built with this allocator draw their storage from the arena;
+ * deallocate is a no-op because the arena is reset wholesale. The arena must
+ * outlive every container using it.
+ *
+ * @tparam T The element type
+ */
+template <typename T>
+class ArenaStlAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaStlAllocator(BumpArena& arena) noexcept : m_arena(&arena) {}
+
+    template <typename U>
+    ArenaStlAllocator(const ArenaStlAllocator<U>& other) noexcept
+        : m_arena(other.GetArena()) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(m_arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {
+        // Individual frees are no-ops; the arena reclaims wholesale on Reset
+    }
+
+    BumpArena* GetArena() const noexcept { return m_arena; }
+
+private:
+    BumpArena* m_arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaStlAllocator<T>& lhs, const ArenaStlAllocator<U>& rhs) noexcept {
+    return lhs.GetArena() == rhs.GetArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaStlAllocator<T>& lhs, const ArenaStlAllocator<U>& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+/**
+ * Convenience alias for arena-backed vectors
+ */
+template <typename T>
+using ArenaVector = std::vector<T, ArenaStlAllocator<T>>;
+
+} // namespace Memory
+} // namespace Core
+} // namespace PlanetGen
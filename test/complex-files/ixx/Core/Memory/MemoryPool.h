@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cassert>
+#include <array>
 #include <vector>
 #include <mutex>
 
@@ -20,6 +21,13 @@ namespace Memory {
  * The pool grows automatically when full, and can be pre-allocated to avoid
  * runtime allocations. It is also thread-safe, allowing concurrent allocation
  * and deallocation from multiple threads.
+ *
+ * Each thread keeps a small magazine of blocks that is refilled from and
+ * flushed to the shared backing store in bulk, so the common-case
+ * Allocate/Deallocate is thread-local pointer bumping with no lock; the
+ * shared mutex is only taken once per magazine exchange. The pool must
+ * outlive any thread that allocates from it, since per-thread magazines are
+ * flushed back on thread exit.
  */
 class MemoryPool {
 public:
@@ -55,7 +63,9 @@ public:
     size_t GetTotalBlocks() const;
     
     /**
-     * Gets the number of blocks currently allocated from the pool
+     * Gets the number of blocks currently checked out of the shared store.
+     * Includes blocks sitting in per-thread magazines, so this is an upper
+     * bound on the number of blocks actually held by callers.
      * @return Number of blocks in use
      */
     size_t GetUsedBlocks() const;
@@ -81,22 +91,47 @@ public:
     MemoryPool& operator=(MemoryPool&&) = delete;
 
 private:
-    // Grows the pool by allocating a new chunk of memory
-    bool Grow();
-    
+    // Number of blocks exchanged with the shared store per refill/flush
+    static constexpr size_t kMagazineSize = 64;
+
+    // Per-thread block cache; refilled/flushed in bulk from the shared pool
+    struct Magazine {
+        std::array<void*, kMagazineSize> blocks;
+        size_t count = 0;
+    };
+
+    // Thread-local registry mapping pools to magazines; defined in the
+    // translation unit, flushes outstanding blocks back on thread exit
+    struct ThreadCache;
+    friend struct ThreadCache;
+
+    // Looks up (or rebinds) this thread's magazine for this pool
+    Magazine& GetMagazine();
+
+    // Bulk exchange with the shared free list; these take m_mutex once
+    bool RefillMagazine(Magazine& magazine);
+    void FlushMagazine(Magazine& magazine, size_t keepCount);
+
+    // Grows the pool by allocating a new chunk of memory; m_mutex must be held
+    bool GrowLocked();
+
+    // Capacity without taking the lock; m_mutex must be held
+    size_t TotalBlocksLocked() const;
+
     // Constants
     static constexpr size_t m_initialChunkSize = 32;
-    
+
     // Configuration
     const size_t m_blockSize;
     const float m_growthFactor;
-    
+
     // State
+    const uint64_t m_poolId;                     // Guards thread caches against pool address reuse
     std::vector<std::vector<uint8_t>> m_blocks;  // Raw memory chunks
     void* m_freeList = nullptr;                  // Linked list of free blocks
-    size_t m_usedBlocks = 0;                     // Number of blocks in use
+    size_t m_usedBlocks = 0;                     // Blocks checked out of the shared store
     size_t m_blocksPerChunk = m_initialChunkSize; // Blocks per chunk
-    mutable std::mutex m_mutex;                  // For thread safety
+    mutable std::mutex m_mutex;                  // Protects the shared backing store
 };
 
 } // namespace Memory
@@ -4,6 +4,9 @@
 #include <type_traits>
 #include <new>
 #include <cassert>
+#include <atomic>
+#include <array>
+#include <unordered_map>
 
 namespace PlanetGen {
 namespace Core {
@@ -12,7 +15,14 @@ namespace Memory {
 /**
  * A type-safe memory pool that efficiently allocates and deallocates objects of a specific type.
  * Provides automatic construction and destruction of objects.
- * 
+ *
+ * Released objects are recycled through a lock-free Treiber-stack free list
+ * (tagged-pointer head, so ABA during concurrent pop/push is harmless) and
+ * only fall through to the backing MemoryPool when the free list is empty.
+ * For high-churn object types, per-thread shards can be enabled so most
+ * Create/Destroy pairs never touch the shared stack at all. Acquisition and
+ * release counters are kept for sizing pools from production telemetry.
+ *
  * @tparam T The type of objects to manage
  */
 template <typename T>
@@ -22,9 +32,15 @@ public:
      * Creates a new object pool
      * @param initialCapacity Number of objects to pre-allocate
      * @param growthFactor Factor by which to grow the pool when full
+     * @param perThreadShards Enable per-thread free-list shards for
+     *                        high-churn types; the pool must then outlive
+     *                        any thread that uses it
      */
-    ObjectPool(size_t initialCapacity = 32, float growthFactor = 2.0f)
-        : m_memoryPool(sizeof(T), initialCapacity, growthFactor) 
+    ObjectPool(size_t initialCapacity = 32, float growthFactor = 2.0f,
+               bool perThreadShards = false)
+        : m_memoryPool(sizeof(T), initialCapacity, growthFactor)
+        , m_poolId(s_nextPoolId.fetch_add(1, std::memory_order_relaxed))
+        , m_useShards(perThreadShards)
     {
         // Ensure T is not too large or has complex alignment requirements
         static_assert(sizeof(T) >= sizeof(void*), "Type T must be at least the size of a pointer");
@@ -42,11 +58,11 @@ public:
      * @return Pointer to the new object, or nullptr if allocation failed
      */
     T* Create() {
-        void* memory = m_memoryPool.Allocate();
+        void* memory = AcquireBlock();
         if (!memory) {
             return nullptr;
         }
-        
+
         // Construct the object in-place
         return new(memory) T();
     }
@@ -57,11 +73,11 @@ public:
      * @return Pointer to the new object, or nullptr if allocation failed
      */
     T* Create(const T& other) {
-        void* memory = m_memoryPool.Allocate();
+        void* memory = AcquireBlock();
         if (!memory) {
             return nullptr;
         }
-        
+
         // Construct the object in-place with copy constructor
         return new(memory) T(other);
     }
@@ -73,11 +89,11 @@ public:
      */
     template <typename... Args>
     T* Create(Args&&... args) {
-        void* memory = m_memoryPool.Allocate();
+        void* memory = AcquireBlock();
         if (!memory) {
             return nullptr;
         }
-        
+
         // Construct the object in-place with the provided arguments
         return new(memory) T(std::forward<Args>(args)...);
     }
@@ -90,9 +106,9 @@ public:
         if (object) {
             // Call the destructor manually
             object->~T();
-            
-            // Return memory to pool
-            m_memoryPool.Deallocate(object);
+
+            // Recycle the memory through the free list
+            ReleaseBlock(object);
         }
     }
     
@@ -105,12 +121,31 @@ public:
     }
     
     /**
-     * Gets the number of objects currently allocated from the pool
+     * Gets the number of objects currently allocated from the pool.
+     * Blocks parked on the recycling free list still count as allocated
+     * from the backing store; use the acquisition/release counters for
+     * live-object telemetry.
      * @return Number of objects in use
      */
     size_t GetAllocatedCount() const {
         return m_memoryPool.GetUsedBlocks();
     }
+
+    /**
+     * Gets the number of successful object acquisitions since construction
+     * @return Monotonic acquisition counter for telemetry
+     */
+    uint64_t GetAcquisitionCount() const {
+        return m_acquisitions.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Gets the number of objects released back to the pool since construction
+     * @return Monotonic release counter for telemetry
+     */
+    uint64_t GetReleaseCount() const {
+        return m_releases.load(std::memory_order_relaxed);
+    }
     
     /**
      * Ensures the pool has capacity for at least the specified number of objects
@@ -129,7 +164,139 @@ public:
     ObjectPool& operator=(ObjectPool&&) = delete;
 
 private:
+    // Free-list node embedded in the recycled block itself
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    // Tagged-pointer packing for the Treiber-stack head: low 48 bits hold
+    // the node address (canonical on x86-64/AArch64), high 16 bits hold an
+    // ABA tag bumped on every successful exchange, so a popped-and-repushed
+    // node can never satisfy a stale compare-exchange
+    static constexpr uint64_t kPointerMask = 0x0000FFFFFFFFFFFFull;
+    static constexpr unsigned kTagShift = 48;
+
+    static FreeNode* UnpackNode(uint64_t head) {
+        return reinterpret_cast<FreeNode*>(head & kPointerMask);
+    }
+
+    static uint64_t PackHead(FreeNode* node, uint64_t previousHead) {
+        uint64_t tag = ((previousHead >> kTagShift) + 1) & 0xFFFFull;
+        return (reinterpret_cast<uint64_t>(node) & kPointerMask) | (tag << kTagShift);
+    }
+
+    // Per-thread free-list shard (only used when enabled in the constructor)
+    static constexpr size_t kShardSize = 32;
+
+    struct Shard {
+        std::array<void*, kShardSize> blocks;
+        size_t count = 0;
+    };
+
+    // Thread-local registry mapping pools to shards; flushes outstanding
+    // blocks to the shared stack on thread exit
+    struct ShardCache {
+        struct Entry {
+            ObjectPool* pool = nullptr;
+            uint64_t poolId = 0;
+            Shard shard;
+        };
+
+        std::unordered_map<const void*, Entry> entries;
+
+        ~ShardCache() {
+            for (auto& [key, entry] : entries) {
+                while (entry.pool && entry.shard.count > 0) {
+                    entry.pool->PushShared(entry.shard.blocks[--entry.shard.count]);
+                }
+            }
+        }
+    };
+
+    Shard& GetShard() {
+        thread_local ShardCache t_cache;
+
+        typename ShardCache::Entry& entry = t_cache.entries[this];
+        if (entry.pool != this || entry.poolId != m_poolId) {
+            // First use on this thread, or a stale binding left by a
+            // destroyed pool that reused this address
+            entry.pool = this;
+            entry.poolId = m_poolId;
+            entry.shard.count = 0;
+        }
+        return entry.shard;
+    }
+
+    void* AcquireBlock() {
+        if (m_useShards) {
+            Shard& shard = GetShard();
+            if (shard.count > 0) {
+                m_acquisitions.fetch_add(1, std::memory_order_relaxed);
+                return shard.blocks[--shard.count];
+            }
+        }
+
+        // Lock-free pop from the shared Treiber stack
+        uint64_t head = m_freeHead.load(std::memory_order_acquire);
+        while (UnpackNode(head)) {
+            FreeNode* node = UnpackNode(head);
+            uint64_t next = PackHead(node->next, head);
+            if (m_freeHead.compare_exchange_weak(head, next,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_acquire)) {
+                m_acquisitions.fetch_add(1, std::memory_order_relaxed);
+                return node;
+            }
+        }
+
+        // Free list empty - fall through to the backing store
+        void* memory = m_memoryPool.Allocate();
+        if (memory) {
+            m_acquisitions.fetch_add(1, std::memory_order_relaxed);
+        }
+        return memory;
+    }
+
+    void ReleaseBlock(void* block) {
+        m_releases.fetch_add(1, std::memory_order_relaxed);
+
+        if (m_useShards) {
+            Shard& shard = GetShard();
+            if (shard.count == kShardSize) {
+                // Spill half to the shared stack, keep the rest hot
+                while (shard.count > kShardSize / 2) {
+                    PushShared(shard.blocks[--shard.count]);
+                }
+            }
+            shard.blocks[shard.count++] = block;
+            return;
+        }
+
+        PushShared(block);
+    }
+
+    void PushShared(void* block) {
+        auto* node = static_cast<FreeNode*>(block);
+        uint64_t head = m_freeHead.load(std::memory_order_relaxed);
+        for (;;) {
+            node->next = UnpackNode(head);
+            uint64_t desired = PackHead(node, head);
+            if (m_freeHead.compare_exchange_weak(head, desired,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    static inline std::atomic<uint64_t> s_nextPoolId{1};
+
     MemoryPool m_memoryPool;
+    const uint64_t m_poolId;       // Guards thread shards against pool address reuse
+    const bool m_useShards;
+    std::atomic<uint64_t> m_freeHead{0};
+    std::atomic<uint64_t> m_acquisitions{0};
+    std::atomic<uint64_t> m_releases{0};
 };
 
 } // namespace Memory
@@ -1,6 +1,7 @@
 module;
 
 #include <any>
+#include <atomic>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -55,6 +56,61 @@ enum class ParameterMergeStrategy {
     UseHigherPriority
 };
 
+// Stable integer handle for the lock-free read path. IDs are handed out
+// when a parameter is first registered and never change afterwards.
+using ParameterId = uint32_t;
+inline constexpr ParameterId kInvalidParameterId = std::numeric_limits<ParameterId>::max();
+
+class ParameterRegistry;
+
+// Staged parameter batch for bulk import. Definitions and overrides are
+// collected without touching any registry lock, then published as a whole
+// via ParameterRegistry::ImportBatch. Intended for large imports (e.g.
+// optimization result sets) where per-parameter locking dominates.
+class ParameterBatch {
+public:
+    ParameterBatch() = default;
+
+    // Move-only, like the registry it publishes into
+    ParameterBatch(const ParameterBatch&) = delete;
+    ParameterBatch& operator=(const ParameterBatch&) = delete;
+    ParameterBatch(ParameterBatch&&) = default;
+    ParameterBatch& operator=(ParameterBatch&&) = default;
+
+    // Stage a parameter definition with constraints
+    template<typename T>
+    void DefineParameter(const std::string& name,
+                        T defaultValue,
+                        T minValue = std::numeric_limits<T>::min(),
+                        T maxValue = std::numeric_limits<T>::max()) {
+        auto param = std::make_shared<Parameter<T>>(defaultValue, minValue, maxValue);
+        m_parameters[name] = param;
+        m_typeMap.emplace(name, std::type_index(typeid(T)));
+    }
+
+    // Stage a runtime override
+    template<typename T>
+    void SetOverride(const std::string& name, T value) {
+        m_overrides[name] = value;
+    }
+
+    size_t Size() const { return m_parameters.size() + m_overrides.size(); }
+    bool Empty() const { return m_parameters.empty() && m_overrides.empty(); }
+
+    void Clear() {
+        m_parameters.clear();
+        m_typeMap.clear();
+        m_overrides.clear();
+    }
+
+private:
+    friend class ParameterRegistry;
+
+    std::unordered_map<std::string, std::any> m_parameters;
+    std::unordered_map<std::string, std::type_index> m_typeMap;
+    std::unordered_map<std::string, std::any> m_overrides;
+};
+
 class ParameterRegistry {
 public:
     ParameterRegistry() = default;
@@ -77,7 +133,9 @@ public:
         auto param = std::make_shared<Parameter<T>>(defaultValue, minValue, maxValue);
         m_parameters[name] = param;
         m_typeMap.emplace(name, std::type_index(typeid(T)));
-        
+        InternLocked(name);
+        RepublishSnapshotLocked();
+
         // Note: Can't use LOG_TRACE in template function - will log from non-template code
     }
     
@@ -128,6 +186,31 @@ public:
             return fallback;
         }
     }
+
+    // Resolve a name to its stable ID (one string hash, at setup time).
+    // Returns kInvalidParameterId if the parameter has not been registered.
+    ParameterId GetParameterId(const std::string& name) const;
+
+    // RCU-style hot-path read: grabs the current immutable snapshot and
+    // indexes it by ID - no mutex, no string hashing. Writers republish a
+    // new snapshot, so a reader sees a consistent table throughout.
+    template<typename T>
+    T GetFast(ParameterId id) const {
+        auto snapshot = m_snapshot.load(std::memory_order_acquire);
+        if (snapshot && id < snapshot->entries.size()) {
+            const std::any& entry = snapshot->entries[id];
+            // Runtime overrides are captured as bare values, registered
+            // parameters as their shared definition
+            if (const T* direct = std::any_cast<T>(&entry)) {
+                return *direct;
+            }
+            if (auto param = std::any_cast<std::shared_ptr<Parameter<T>>>(&entry)) {
+                return (*param)->value;
+            }
+            throw std::runtime_error("Type mismatch for parameter id " + std::to_string(id));
+        }
+        throw std::runtime_error("Unknown parameter id: " + std::to_string(id));
+    }
     
     // Set runtime override
     template<typename T>
@@ -150,7 +233,8 @@ public:
         }
         
         m_runtimeOverrides[name] = value;
-        
+        RepublishSnapshotLocked();
+
         // Trigger change callbacks
         auto callbackIt = m_changeCallbacks.find(name);
         if (callbackIt != m_changeCallbacks.end()) {
@@ -226,6 +310,13 @@ public:
     
     // Merge configurations
     void MergeFrom(const ParameterRegistry& other, ParameterMergeStrategy strategy);
+
+    // Bulk import: validate the staged batch as a whole, then publish it
+    // under a single lock acquisition. All-or-nothing - if any staged value
+    // fails validation the registry is left untouched and false is returned.
+    // The batch is consumed on success.
+    bool ImportBatch(ParameterBatch&& batch,
+                     ParameterMergeStrategy strategy = ParameterMergeStrategy::OverrideExisting);
     
     // Validation
     bool Validate() const;
@@ -246,11 +337,37 @@ public:
     std::type_index GetParameterType(const std::string& name) const;
     
 private:
+    // Immutable effective-value table, indexed by ParameterId. Republished
+    // wholesale by writers; readers hold it alive via shared_ptr.
+    struct Snapshot {
+        std::vector<std::any> entries;
+    };
+
+    // Assign an ID on first registration (caller holds m_mutex)
+    ParameterId InternLocked(const std::string& name) {
+        auto it = m_idMap.find(name);
+        if (it != m_idMap.end()) {
+            return it->second;
+        }
+        ParameterId id = static_cast<ParameterId>(m_idNames.size());
+        m_idMap.emplace(name, id);
+        m_idNames.push_back(name);
+        return id;
+    }
+
+    // Rebuild and publish the snapshot (caller holds m_mutex)
+    void RepublishSnapshotLocked();
+
     mutable std::mutex m_mutex;
     std::unordered_map<std::string, std::any> m_parameters;
     std::unordered_map<std::string, std::any> m_runtimeOverrides;
     std::unordered_map<std::string, std::type_index> m_typeMap;
     std::unordered_map<std::string, std::vector<std::function<void(const std::any&)>>> m_changeCallbacks;
+
+    // Lock-free read path state
+    std::unordered_map<std::string, ParameterId> m_idMap;
+    std::vector<std::string> m_idNames;
+    std::atomic<std::shared_ptr<const Snapshot>> m_snapshot;
     
     // Usage tracking
     bool m_trackUsage = false;
@@ -36,6 +36,16 @@ public:
     static void SetRuntimeOverride(const std::string& name, T value) {
         GetRegistry()->SetRuntimeOverride(name, value);
     }
+
+    /// Resolve a parameter name to its stable integer ID. Do this once at
+    /// setup; per-sample reads should go through GetFast.
+    static ParameterId GetParameterId(const std::string& name);
+
+    /// Lock-free hot-path read through the registry's current snapshot
+    template<typename T>
+    static T GetFast(ParameterId id) {
+        return GetRegistry()->GetFast<T>(id);
+    }
     
     /// Apply a quality preset
     static void ApplyQualityPreset(const std::string& preset);
@@ -57,4 +67,7 @@ public:
 #define PARAM_SET(name, value) \
     PlanetGen::Core::Parameters::ParameterSystemAdapter::SetRuntimeOverride(name, value)
 
+#define PARAM_GET_FAST(type, id) \
+    PlanetGen::Core::Parameters::ParameterSystemAdapter::GetFast<type>(id)
+
 } // namespace PlanetGen::Core::Parameters
\ No newline at end of file
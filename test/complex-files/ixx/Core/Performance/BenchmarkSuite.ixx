@@ -0,0 +1,67 @@
+module;
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+export module BenchmarkSuite;
+
+export namespace PlanetGen::Core::Performance {
+
+// Run control for a benchmark session. Seeds are fixed by default so runs
+// are reproducible and comparable across commits.
+struct BenchmarkOptions {
+    uint32_t warmupIterations = 3;   // Discarded iterations before timing
+    uint32_t measuredIterations = 10;
+    uint32_t seed = 1337;            // Propagated to registered workloads
+    std::string filter;              // Substring match on benchmark name; empty runs all
+};
+
+struct BenchmarkResult {
+    std::string name;
+    std::string category;
+    uint32_t iterations = 0;
+    uint64_t itemsPerIteration = 0;  // Work units per call (samples, tasks, allocations)
+
+    double meanMs = 0.0;
+    double minMs = 0.0;
+    double maxMs = 0.0;
+    double stdDevMs = 0.0;
+    double itemsPerSecond = 0.0;     // itemsPerIteration / mean iteration time
+};
+
+// Registry of microbenchmarks for the generation hot paths. Workloads are
+// registered as plain callables (one call = one iteration); the registry
+// owns warmup, timing, aggregation, and JSON export so every benchmark
+// reports comparable numbers.
+class BenchmarkRegistry {
+public:
+    using BenchmarkFn = std::function<void()>;
+
+    void Register(std::string name, std::string category,
+                  uint64_t itemsPerIteration, BenchmarkFn fn);
+
+    // Runs every registered benchmark matching options.filter: warmup
+    // iterations first (untimed), then measured iterations timed
+    // individually so min/max/stddev expose run-to-run jitter.
+    std::vector<BenchmarkResult> RunAll(const BenchmarkOptions& options) const;
+
+    // Writes results as JSON keyed the same way as the PerformanceMonitor
+    // exports, so regression tooling can diff runs against stored baselines.
+    static bool ExportJSON(const std::vector<BenchmarkResult>& results,
+                           const BenchmarkOptions& options,
+                           const std::string& filepath);
+
+private:
+    struct Entry {
+        std::string name;
+        std::string category;
+        uint64_t itemsPerIteration;
+        BenchmarkFn fn;
+    };
+
+    std::vector<Entry> m_entries;
+};
+
+} // namespace PlanetGen::Core::Performance
@@ -1,6 +1,7 @@
 module;
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -67,6 +68,17 @@ struct PerformanceEvent {
     std::unordered_map<std::string, std::string> metadata;
 };
 
+// Compact record produced by the thread-local instrumentation mode.
+// Timestamps are nanoseconds from the calibrated trace clock (TSC-based
+// where available), threadId is a small stable per-thread ordinal.
+struct TraceEvent {
+    std::string name;
+    std::string category;
+    uint64_t beginNs = 0;
+    uint64_t endNs = 0;
+    uint32_t threadId = 0;
+};
+
 // Configuration for performance monitoring
 struct PerformanceConfig {
     bool enableFrameStats = true;
@@ -79,6 +91,14 @@ struct PerformanceConfig {
     uint32_t maxFrameHistory = 300; // Maximum frame data points to keep
     
     bool enableRealTimeLogging = false;
+
+    // Thread-local instrumentation mode: Begin/EndEvent write into per-thread
+    // fixed-capacity buffers instead of the shared history, so measuring a
+    // multithreaded run does not serialize it. Buffers are drained by
+    // FlushThreadEvents() after the run.
+    bool enableThreadLocalEvents = false;
+    uint32_t threadEventCapacity = 65536; // Events per thread before drop-and-count
+
     bool enablePerformanceAlerts = true;
     float fpsAlertThreshold = 30.0f; // Alert if FPS drops below this
     float frameTimeAlertThreshold = 33.3f; // Alert if frame time exceeds this (ms)
@@ -151,6 +171,20 @@ public:
     virtual void UpdateConfig(const PerformanceConfig& config) = 0;
     virtual const PerformanceConfig& GetConfig() const = 0;
     
+    // Thread-local trace instrumentation. Implemented by the detailed
+    // monitor (see PerformanceMonitorFactory::CreateDetailedMonitor); the
+    // default implementations are no-ops so lightweight monitors pay nothing.
+    // FlushThreadEvents must only be called while the instrumented threads
+    // are quiescent (e.g. after JobSystem::WaitForAll).
+    virtual void FlushThreadEvents() {}
+    virtual const std::vector<TraceEvent>& GetTraceEvents() const {
+        static const std::vector<TraceEvent> s_empty;
+        return s_empty;
+    }
+    // Writes flushed events in the chrome://tracing JSON format so a planet
+    // generation's actual JobSystem schedule can be inspected visually
+    virtual bool ExportChromeTrace(const std::string& /*filepath*/) const { return false; }
+
     // Data export
     virtual bool ExportToJSON(const std::string& filepath) const = 0;
     virtual bool ExportToCSV(const std::string& filepath) const = 0;
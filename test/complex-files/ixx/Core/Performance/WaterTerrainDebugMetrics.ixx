@@ -1,7 +1,9 @@
 module;
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include <chrono>
 #include <functional>
@@ -112,6 +114,59 @@ public:
         std::string summary;
     };
     
+    /**
+     * @brief Configuration for statistical sampling mode
+     *
+     * When enabled, AnalyzeSampled evaluates only a random subset of
+     * samples per frame, stratified over a latitude/longitude tile grid so
+     * coverage stays even across the planet. Tiles whose streaming
+     * estimates cross the alert thresholds (judged by the confidence
+     * interval, not the point estimate) escalate to dense evaluation until
+     * the estimate recovers.
+     */
+    struct SamplingConfig {
+        bool enabled = false;
+        float sampleFraction = 0.01f;       // Fraction of samples evaluated per frame
+        uint32_t latitudeBands = 8;         // Stratification grid
+        uint32_t longitudeBands = 16;
+        uint32_t minSamplesForAlert = 64;   // Per-tile samples before alerts can fire
+        float confidenceZ = 1.96f;          // 95% confidence intervals
+        float waterCoverageAlertPercent = 70.0f; // Escalate tile above this coverage
+        float waterDepthAlertMeters = 500.0f;    // ...or above this mean depth
+    };
+
+    /**
+     * @brief Streaming mean/variance estimate (Welford) with confidence interval
+     */
+    struct StreamingEstimate {
+        uint64_t count = 0;
+        double mean = 0.0;
+        double m2 = 0.0;
+
+        void Add(double value) {
+            ++count;
+            double delta = value - mean;
+            mean += delta / static_cast<double>(count);
+            m2 += delta * (value - mean);
+        }
+
+        double Variance() const {
+            return count > 1 ? m2 / static_cast<double>(count - 1) : 0.0;
+        }
+
+        // Half-width of the confidence interval at the given z score
+        double ConfidenceHalfWidth(double z) const;
+    };
+
+    /**
+     * @brief Per-tile streaming state for the stratified sampling grid
+     */
+    struct TileEstimate {
+        StreamingEstimate waterFraction;    // 0/1 water indicator per sample
+        StreamingEstimate waterDepth;       // Depth of sampled water vertices
+        bool denseEvaluation = false;       // Escalated to evaluating every sample
+    };
+
     /**
      * @brief Callback types for debug metrics
      */
@@ -137,6 +192,28 @@ public:
     void RecordWaterMeshValidation(bool isValid, float qualityScore);
     void RecordBoundaryComplexity(float complexity);
     
+    // Statistical sampling mode
+    void SetSamplingConfig(const SamplingConfig& config);
+    const SamplingConfig& GetSamplingConfig() const { return m_samplingConfig; }
+
+    /**
+     * @brief Per-frame sampled water/terrain analysis
+     *
+     * Evaluates roughly sampleFraction of the given samples (all samples of
+     * escalated tiles), updates the streaming per-tile and global estimates,
+     * and returns an analysis extrapolated from them. Coordinates are
+     * (latitude, longitude) degrees matching the generation layer; water is
+     * any elevation at or below seaLevel. Deterministic per frame counter,
+     * so replays sample identically.
+     */
+    WaterTerrainAnalysis AnalyzeSampled(const float* elevations,
+                                        const std::pair<float, float>* coordinates,
+                                        size_t count,
+                                        float seaLevel);
+
+    const std::vector<TileEstimate>& GetTileEstimates() const { return m_tileEstimates; }
+    uint32_t GetDenseTileCount() const;
+
     // Session management
     void BeginDebugSession(const std::string& sessionName, const std::string& debugMode);
     void EndDebugSession();
@@ -191,6 +268,13 @@ private:
     // Configuration
     uint32_t m_maxHistorySize = 1000;
     bool m_isSessionActive = false;
+
+    // Sampling mode state
+    SamplingConfig m_samplingConfig;
+    std::vector<TileEstimate> m_tileEstimates;  // latitudeBands x longitudeBands
+    StreamingEstimate m_globalWaterFraction;
+    StreamingEstimate m_globalWaterDepth;
+    uint64_t m_samplingFrame = 0;
     
     // Statistics
     float m_totalAnalysisTime = 0.0f;
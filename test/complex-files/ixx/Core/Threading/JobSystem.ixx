@@ -8,6 +8,8 @@ module;
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -23,8 +25,6 @@ module;
 #include <utility>
 export module Core.Threading.JobSystem;
 
-import ThreadPool;
-
 export namespace PlanetGen::Core::Threading
 {
 
@@ -320,6 +320,99 @@ export namespace PlanetGen::Core::Threading
     Job *m_job;
   };
 
+  // Scheduled unit of work owned by the scheduler
+  struct ScheduledTask
+  {
+    std::function<void()> work;
+  };
+
+  // Chase-Lev work-stealing deque. The owning worker pushes and pops at the
+  // bottom (LIFO, cache-hot), thieves steal from the top (FIFO). Bounded; a
+  // full deque falls back to the worker inboxes in the scheduler.
+  class WorkStealingDeque
+  {
+  public:
+    explicit WorkStealingDeque(size_t capacity = 4096)
+        : m_mask(capacity - 1), m_buffer(capacity), m_top(0), m_bottom(0)
+    {
+      // Capacity must be a power of two for the index mask to work
+    }
+
+    // Owner only
+    bool Push(ScheduledTask *task)
+    {
+      int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+      int64_t top = m_top.load(std::memory_order_acquire);
+      if (bottom - top > static_cast<int64_t>(m_mask))
+      {
+        return false; // Full
+      }
+      m_buffer[bottom & m_mask].store(task, std::memory_order_relaxed);
+      m_bottom.store(bottom + 1, std::memory_order_release);
+      return true;
+    }
+
+    // Owner only, takes the most recently pushed task
+    ScheduledTask *Pop()
+    {
+      int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+      m_bottom.store(bottom, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t top = m_top.load(std::memory_order_relaxed);
+
+      if (top > bottom)
+      {
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr; // Empty
+      }
+
+      ScheduledTask *task = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+      if (top == bottom)
+      {
+        // Last element - race against thieves for it
+        if (!m_top.compare_exchange_strong(top, top + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed))
+        {
+          task = nullptr; // A thief won
+        }
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+      }
+      return task;
+    }
+
+    // Any thread, takes the oldest task
+    ScheduledTask *Steal()
+    {
+      int64_t top = m_top.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+      if (top >= bottom)
+      {
+        return nullptr; // Empty
+      }
+
+      ScheduledTask *task = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+      if (!m_top.compare_exchange_strong(top, top + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed))
+      {
+        return nullptr; // Lost the race
+      }
+      return task;
+    }
+
+  private:
+    size_t m_mask;
+    std::vector<std::atomic<ScheduledTask *>> m_buffer;
+    std::atomic<int64_t> m_top;
+    std::atomic<int64_t> m_bottom;
+  };
+
+  // Index of the worker running on this thread, -1 off the worker pool
+  inline thread_local int t_workerIndex = -1;
+
   // Job system
   class JobSystem
   {
@@ -363,38 +456,8 @@ export namespace PlanetGen::Core::Threading
         m_activeJobNames.push_back(jobName);
       }
 
-      // Wait for dependencies before scheduling
-      m_threadPool.Submit([this, job, jobName]()
-                          {
-      // Wait until the job is ready (dependencies complete)
-      int spinCount = 0;
-      while (!job->IsReady()) {
-        if (spinCount < 1000) {
-          spinCount++;
-          continue;
-        }
-        spinCount = 0;
-        std::this_thread::yield();
-      }
-
-      try {
-        job->ExecuteInternal();
-      } catch (...) {
-        // Remove from active jobs even if job fails
-        std::lock_guard<std::mutex> lock(m_activeJobsMutex);
-        auto it = std::find(m_activeJobNames.begin(), m_activeJobNames.end(), jobName);
-        if (it != m_activeJobNames.end()) {
-          m_activeJobNames.erase(it);
-        }
-        throw;
-      }
-
-      // Remove from active jobs after completion
-      std::lock_guard<std::mutex> lock(m_activeJobsMutex);
-      auto it = std::find(m_activeJobNames.begin(), m_activeJobNames.end(), jobName);
-      if (it != m_activeJobNames.end()) {
-        m_activeJobNames.erase(it);
-      } });
+      SubmitTask([this, job, jobName]()
+                 { RunScheduledJob(job, jobName); });
 
       return JobHandle(job);
     }
@@ -533,7 +596,11 @@ export namespace PlanetGen::Core::Threading
         }
       }
 
-      m_threadPool.WaitForAll();
+      {
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        m_waitCondition.wait(lock, [this]
+                             { return m_outstandingTasks.load(std::memory_order_acquire) == 0; });
+      }
 
       // Verify no jobs are left
       {
@@ -552,19 +619,66 @@ export namespace PlanetGen::Core::Threading
 
     bool WaitForAll(std::chrono::milliseconds timeout)
     {
-      return m_threadPool.WaitForAll(timeout);
+      std::unique_lock<std::mutex> lock(m_waitMutex);
+      return m_waitCondition.wait_for(lock, timeout, [this]
+                                      { return m_outstandingTasks.load(std::memory_order_acquire) == 0; });
     }
 
-    size_t GetWorkerCount() const { return m_threadPool.GetWorkerCount(); }
+    size_t GetWorkerCount() const { return m_workers.size(); }
 
     size_t GetPendingJobCount() const
     {
-      return m_threadPool.GetQueueSize() + m_threadPool.GetActiveJobCount();
+      return m_outstandingTasks.load(std::memory_order_acquire);
+    }
+
+    // Raw submission for schedulers that manage readiness themselves (see
+    // JobGraphHandle). The task must be runnable immediately: it bypasses
+    // the IsReady spin/requeue path and the active-name bookkeeping.
+    void SubmitDetached(std::function<void()> work)
+    {
+      SubmitTask(std::move(work));
     }
 
   private:
-    JobSystem() : m_threadPool(std::thread::hardware_concurrency()) {}
-    ~JobSystem() = default;
+    // Per-worker scheduling state. The deque holds work pushed by this
+    // worker; the inbox receives work from external threads and deque
+    // overflow, and may be drained by thieves as well.
+    struct Worker
+    {
+      WorkStealingDeque deque;
+      std::mutex inboxMutex;
+      std::deque<ScheduledTask *> inbox;
+    };
+
+    JobSystem()
+    {
+      size_t workerCount = std::max(1u, std::thread::hardware_concurrency());
+      m_workers.reserve(workerCount);
+      for (size_t i = 0; i < workerCount; ++i)
+      {
+        m_workers.push_back(std::make_unique<Worker>());
+      }
+
+      m_threads.reserve(workerCount);
+      for (size_t i = 0; i < workerCount; ++i)
+      {
+        m_threads.emplace_back([this, i]
+                               { WorkerLoop(i); });
+      }
+    }
+
+    ~JobSystem()
+    {
+      m_shutdown.store(true, std::memory_order_release);
+      m_sleepCondition.notify_all();
+      for (auto &thread : m_threads)
+      {
+        if (thread.joinable())
+        {
+          thread.join();
+        }
+      }
+    }
 
     // Delete copy and move
     JobSystem(const JobSystem &) = delete;
@@ -572,7 +686,156 @@ export namespace PlanetGen::Core::Threading
     JobSystem(JobSystem &&) = delete;
     JobSystem &operator=(JobSystem &&) = delete;
 
-    ThreadPool m_threadPool;
+    void SubmitTask(std::function<void()> work)
+    {
+      auto *task = new ScheduledTask{std::move(work)};
+      m_outstandingTasks.fetch_add(1, std::memory_order_release);
+
+      // Workers push onto their own deque: LIFO keeps freshly spawned work
+      // cache-hot and contention-free
+      int workerIndex = t_workerIndex;
+      if (workerIndex >= 0 && m_workers[workerIndex]->deque.Push(task))
+      {
+        m_sleepCondition.notify_one();
+        return;
+      }
+
+      // External thread (or full deque): distribute round-robin so no
+      // single queue becomes the bottleneck
+      size_t target = m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+      {
+        std::lock_guard<std::mutex> lock(m_workers[target]->inboxMutex);
+        m_workers[target]->inbox.push_back(task);
+      }
+      m_sleepCondition.notify_one();
+    }
+
+    void RunScheduledJob(Job *job, const std::string &jobName)
+    {
+      // Brief spin for almost-complete dependencies, then requeue instead
+      // of parking a worker on an unready job
+      if (!job->IsReady())
+      {
+        for (int spin = 0; spin < 1000 && !job->IsReady(); ++spin)
+        {
+        }
+        if (!job->IsReady())
+        {
+          std::this_thread::yield();
+          SubmitTask([this, job, jobName]()
+                     { RunScheduledJob(job, jobName); });
+          return;
+        }
+      }
+
+      try
+      {
+        job->ExecuteInternal();
+      }
+      catch (...)
+      {
+        // Job records its own exception; keep the worker alive
+      }
+
+      // Remove from active jobs after completion
+      std::lock_guard<std::mutex> lock(m_activeJobsMutex);
+      auto it = std::find(m_activeJobNames.begin(), m_activeJobNames.end(), jobName);
+      if (it != m_activeJobNames.end())
+      {
+        m_activeJobNames.erase(it);
+      }
+    }
+
+    ScheduledTask *FindTask(size_t index)
+    {
+      // 1. Own deque, newest first
+      if (auto *task = m_workers[index]->deque.Pop())
+      {
+        return task;
+      }
+
+      // 2. Own inbox, oldest first
+      {
+        std::lock_guard<std::mutex> lock(m_workers[index]->inboxMutex);
+        if (!m_workers[index]->inbox.empty())
+        {
+          auto *task = m_workers[index]->inbox.front();
+          m_workers[index]->inbox.pop_front();
+          return task;
+        }
+      }
+
+      // 3. Steal FIFO from the other workers, starting at a rotating victim
+      size_t workerCount = m_workers.size();
+      size_t start = m_stealSeed.fetch_add(1, std::memory_order_relaxed);
+      for (size_t offset = 1; offset < workerCount; ++offset)
+      {
+        size_t victim = (index + start + offset) % workerCount;
+        if (victim == index)
+        {
+          continue;
+        }
+
+        if (auto *task = m_workers[victim]->deque.Steal())
+        {
+          return task;
+        }
+
+        // Also relieve a victim stuck on a long job of its inbox backlog
+        if (m_workers[victim]->inboxMutex.try_lock())
+        {
+          std::lock_guard<std::mutex> lock(m_workers[victim]->inboxMutex, std::adopt_lock);
+          if (!m_workers[victim]->inbox.empty())
+          {
+            auto *task = m_workers[victim]->inbox.front();
+            m_workers[victim]->inbox.pop_front();
+            return task;
+          }
+        }
+      }
+
+      return nullptr;
+    }
+
+    void WorkerLoop(size_t index)
+    {
+      t_workerIndex = static_cast<int>(index);
+
+      while (true)
+      {
+        if (auto *task = FindTask(index))
+        {
+          task->work();
+          delete task;
+
+          if (m_outstandingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+          {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+            m_waitCondition.notify_all();
+          }
+          continue;
+        }
+
+        if (m_shutdown.load(std::memory_order_acquire))
+        {
+          break; // Shut down only once all queues drained
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepCondition.wait_for(lock, std::chrono::milliseconds(1));
+      }
+    }
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_shutdown{false};
+    std::atomic<size_t> m_outstandingTasks{0};
+    std::atomic<size_t> m_nextWorker{0};
+    std::atomic<size_t> m_stealSeed{0};
+    std::mutex m_sleepMutex;
+    std::condition_variable m_sleepCondition;
+    std::mutex m_waitMutex;
+    std::condition_variable m_waitCondition;
     std::mutex m_activeJobsMutex;
     std::vector<std::string> m_activeJobNames; // Track active job names
   };
@@ -661,6 +924,243 @@ export namespace PlanetGen::Core::Threading
     std::function<void(const PlanetChunkParams &)> m_processFunc;
   };
 
+  // Adaptive auto-partitioner for heterogeneous chunk batches. Fixed-size
+  // chunking forces the caller to guess a grain: too small drowns in
+  // scheduling overhead, too large leaves cores idle at the tail when
+  // per-chunk cost varies (cheap ocean tiles vs expensive mountain tiles).
+  // Here ranges start large - roughly 8 per worker - and are split in half
+  // on the fly: a range that executes on a different worker than the one
+  // that pushed it was stolen, which means someone ran dry, so it keeps
+  // splitting down to the minimum grain to share its tail. Ranges popped
+  // locally run whole, so grain size adapts to the actual per-element cost.
+  class AdaptiveBatchHandle
+  {
+  public:
+    using ChunkParams = PlanetGenBatchJob::PlanetChunkParams;
+
+    AdaptiveBatchHandle() = default;
+
+    static AdaptiveBatchHandle Schedule(
+        std::vector<ChunkParams> chunks,
+        std::function<void(const ChunkParams &)> processFunc,
+        size_t minGrain = 1)
+    {
+      if (chunks.empty())
+      {
+        return AdaptiveBatchHandle();
+      }
+
+      auto state = std::make_shared<BatchState>();
+      state->chunks = std::move(chunks);
+      state->process = std::move(processFunc);
+      state->minGrain = std::max<size_t>(1, minGrain);
+
+      size_t workerCount = JobSystem::Instance().GetWorkerCount();
+      state->targetGrain = std::max(state->minGrain,
+                                    state->chunks.size() / (workerCount * 8 + 1) + 1);
+      state->remaining.store(state->chunks.size(), std::memory_order_relaxed);
+
+      // Single root range; splitting happens as workers pick it apart
+      size_t count = state->chunks.size();
+      int origin = t_workerIndex;
+      JobSystem::Instance().SubmitDetached([state, count, origin]
+                                           { RunRange(state, 0, count, origin); });
+
+      return AdaptiveBatchHandle(state);
+    }
+
+    bool IsValid() const { return m_state != nullptr; }
+
+    bool IsComplete() const
+    {
+      return !m_state || m_state->completed.load(std::memory_order_acquire);
+    }
+
+    void Wait()
+    {
+      if (!m_state)
+      {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(m_state->mutex);
+      m_state->condition.wait(lock, [state = m_state.get()]
+                              { return state->completed.load(std::memory_order_acquire); });
+    }
+
+    bool WaitFor(std::chrono::milliseconds timeout)
+    {
+      if (!m_state)
+      {
+        return true;
+      }
+      std::unique_lock<std::mutex> lock(m_state->mutex);
+      return m_state->condition.wait_for(lock, timeout, [state = m_state.get()]
+                                         { return state->completed.load(std::memory_order_acquire); });
+    }
+
+  private:
+    struct BatchState
+    {
+      std::vector<ChunkParams> chunks;
+      std::function<void(const ChunkParams &)> process;
+      size_t targetGrain = 1;
+      size_t minGrain = 1;
+      std::atomic<size_t> remaining{0};
+      std::atomic<bool> completed{false};
+      std::mutex mutex;
+      std::condition_variable condition;
+    };
+
+    explicit AdaptiveBatchHandle(std::shared_ptr<BatchState> state)
+        : m_state(std::move(state)) {}
+
+    static void RunRange(const std::shared_ptr<BatchState> &state,
+                         size_t begin, size_t end, int origin)
+    {
+      // Stolen ranges (pushed by one worker, running on another) split
+      // down to the minimum grain so idle workers can share the tail;
+      // locally popped ranges stop at the target grain to keep overhead
+      // low on the happy path
+      bool stolen = origin >= 0 && t_workerIndex != origin;
+      size_t grain = stolen ? state->minGrain : state->targetGrain;
+
+      while (end - begin > grain)
+      {
+        size_t mid = begin + (end - begin) / 2;
+        int self = t_workerIndex;
+        JobSystem::Instance().SubmitDetached([state, mid, end, self]
+                                             { RunRange(state, mid, end, self); });
+        end = mid;
+      }
+
+      for (size_t i = begin; i < end; ++i)
+      {
+        state->process(state->chunks[i]);
+      }
+
+      size_t processed = end - begin;
+      if (state->remaining.fetch_sub(processed, std::memory_order_acq_rel) == processed)
+      {
+        {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          state->completed.store(true, std::memory_order_release);
+        }
+        state->condition.notify_all();
+      }
+    }
+
+    std::shared_ptr<BatchState> m_state;
+  };
+
+  // Handle for a chain compiled by JobChain::ScheduleGraph. Dependency
+  // resolution is counter-based: finishing a job decrements its successors'
+  // atomic counters and batch-releases the newly ready ones straight back
+  // into the work-stealing deques, so each edge costs one atomic operation
+  // instead of a mutex acquisition, and completion of the whole graph is
+  // signaled exactly once through a single remaining-job atomic.
+  class JobGraphHandle
+  {
+  public:
+    JobGraphHandle() = default;
+
+    bool IsValid() const { return m_state != nullptr; }
+
+    bool IsComplete() const
+    {
+      return !m_state || m_state->completed.load(std::memory_order_acquire);
+    }
+
+    void Wait()
+    {
+      if (!m_state)
+      {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(m_state->mutex);
+      m_state->condition.wait(lock, [state = m_state.get()]
+                              { return state->completed.load(std::memory_order_acquire); });
+    }
+
+    bool WaitFor(std::chrono::milliseconds timeout)
+    {
+      if (!m_state)
+      {
+        return true;
+      }
+      std::unique_lock<std::mutex> lock(m_state->mutex);
+      return m_state->condition.wait_for(lock, timeout, [state = m_state.get()]
+                                         { return state->completed.load(std::memory_order_acquire); });
+    }
+
+  private:
+    friend class JobChain;
+
+    struct Node
+    {
+      Job *job = nullptr;
+      std::atomic<uint32_t> pending{0};
+      std::vector<uint32_t> successors;
+    };
+
+    struct GraphState
+    {
+      explicit GraphState(size_t jobCount)
+          : nodes(jobCount), remaining(static_cast<uint32_t>(jobCount)) {}
+
+      std::vector<Node> nodes;
+      std::atomic<uint32_t> remaining;
+      std::atomic<bool> completed{false};
+      std::mutex mutex;
+      std::condition_variable condition;
+    };
+
+    explicit JobGraphHandle(std::shared_ptr<GraphState> state)
+        : m_state(std::move(state)) {}
+
+    static void RunNode(const std::shared_ptr<GraphState> &state, uint32_t index)
+    {
+      Node &node = state->nodes[index];
+      try
+      {
+        node.job->ExecuteInternal();
+      }
+      catch (...)
+      {
+        // Job records its own exception; keep releasing successors so the
+        // graph still drains
+      }
+
+      // Collect every successor this completion made ready, then release
+      // them as a batch; workers push onto their own deque so the batch
+      // lands directly in the work-stealing structures
+      std::vector<uint32_t> ready;
+      for (uint32_t successor : node.successors)
+      {
+        if (state->nodes[successor].pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+          ready.push_back(successor);
+        }
+      }
+      for (uint32_t readyIndex : ready)
+      {
+        JobSystem::Instance().SubmitDetached([state, readyIndex]
+                                             { RunNode(state, readyIndex); });
+      }
+
+      // Single completion signal for the whole graph
+      if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          state->completed.store(true, std::memory_order_release);
+        }
+        state->condition.notify_all();
+      }
+    }
+
+    std::shared_ptr<GraphState> m_state;
+  };
+
   // Job chain builder for complex dependencies
   class JobChain
   {
@@ -670,6 +1170,8 @@ export namespace PlanetGen::Core::Threading
       if (!m_jobs.empty())
       {
         job->DependsOn(m_jobs.back());
+        m_edges.emplace_back(static_cast<uint32_t>(m_jobs.size() - 1),
+                             static_cast<uint32_t>(m_jobs.size()));
       }
       m_jobs.push_back(job);
       return *this;
@@ -692,8 +1194,46 @@ export namespace PlanetGen::Core::Threading
       return handles;
     }
 
+    // Graph scheduler mode: compile the chain into a dependency-count array
+    // and let completions drive the releases. Unlike Schedule, no unready
+    // job ever enters the queues (so nothing spins or requeues waiting on
+    // dependencies) and no per-edge mutex is taken at stage boundaries.
+    JobGraphHandle ScheduleGraph()
+    {
+      if (m_jobs.empty())
+      {
+        return JobGraphHandle();
+      }
+
+      auto state = std::make_shared<JobGraphHandle::GraphState>(m_jobs.size());
+      for (size_t i = 0; i < m_jobs.size(); ++i)
+      {
+        state->nodes[i].job = m_jobs[i];
+      }
+      for (const auto &[from, to] : m_edges)
+      {
+        state->nodes[from].successors.push_back(to);
+        state->nodes[to].pending.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      // Release the roots; everything downstream is released by its last
+      // completing predecessor
+      for (size_t i = 0; i < state->nodes.size(); ++i)
+      {
+        if (state->nodes[i].pending.load(std::memory_order_relaxed) == 0)
+        {
+          uint32_t index = static_cast<uint32_t>(i);
+          JobSystem::Instance().SubmitDetached([state, index]
+                                               { JobGraphHandle::RunNode(state, index); });
+        }
+      }
+
+      return JobGraphHandle(state);
+    }
+
   private:
     std::vector<Job *> m_jobs;
+    std::vector<std::pair<uint32_t, uint32_t>> m_edges;
   };
 
   // Helper functions for specialized jobs
@@ -732,6 +1272,16 @@ export namespace PlanetGen::Core::Threading
     return {job, handle};
   }
 
+  // Auto-partitioning alternative to SchedulePlanetGenBatch: no caller-chosen
+  // chunk size, ranges split on steal instead (see AdaptiveBatchHandle)
+  inline AdaptiveBatchHandle SchedulePlanetGenBatchAdaptive(
+      std::vector<PlanetGenBatchJob::PlanetChunkParams> chunks,
+      std::function<void(const PlanetGenBatchJob::PlanetChunkParams &)> processFunc,
+      size_t minGrain = 1)
+  {
+    return AdaptiveBatchHandle::Schedule(std::move(chunks), std::move(processFunc), minGrain);
+  }
+
   inline std::pair<PlanetGenBatchJob *, JobHandle> SchedulePlanetGenBatch(
       std::vector<PlanetGenBatchJob::PlanetChunkParams> chunks,
       std::function<void(const PlanetGenBatchJob::PlanetChunkParams &)> processFunc,
@@ -4,14 +4,18 @@ module;
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <future>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <queue>
 #include <stdexcept>
 #include <thread>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #ifdef _WIN32
@@ -159,10 +163,167 @@ namespace detail {
 #endif
 }
 
+// Small-buffer-optimized task wrapper. Callables whose state fits in the
+// inline storage are constructed in place - no heap allocation and no
+// shared_ptr. Oversized captures fall back to a single heap allocation.
+// Unlike std::function this supports move-only callables such as
+// std::packaged_task, which is what lets Enqueue drop its make_shared.
+class InlineTask {
+ public:
+  static constexpr size_t kInlineSize = 64;
+
+  InlineTask() = default;
+
+  template <typename F,
+            typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineTask>>>
+  InlineTask(F&& callable) {
+    using Callable = std::decay_t<F>;
+
+    if constexpr (sizeof(Callable) <= kInlineSize &&
+                  alignof(Callable) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible_v<Callable>) {
+      new (m_storage) Callable(std::forward<F>(callable));
+      m_invoke = [](void* storage) { (*static_cast<Callable*>(storage))(); };
+      m_relocate = [](void* dst, void* src) {
+        new (dst) Callable(std::move(*static_cast<Callable*>(src)));
+        static_cast<Callable*>(src)->~Callable();
+      };
+      m_destroy = [](void* storage) { static_cast<Callable*>(storage)->~Callable(); };
+    } else {
+      // Oversized or throwing-move capture: single heap allocation
+      auto* heap = new Callable(std::forward<F>(callable));
+      *reinterpret_cast<Callable**>(m_storage) = heap;
+      m_invoke = [](void* storage) { (**reinterpret_cast<Callable**>(storage))(); };
+      m_relocate = [](void* dst, void* src) {
+        *reinterpret_cast<Callable**>(dst) = *reinterpret_cast<Callable**>(src);
+      };
+      m_destroy = [](void* storage) { delete *reinterpret_cast<Callable**>(storage); };
+    }
+  }
+
+  InlineTask(InlineTask&& other) noexcept { MoveFrom(std::move(other)); }
+
+  InlineTask& operator=(InlineTask&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(std::move(other));
+    }
+    return *this;
+  }
+
+  ~InlineTask() { Reset(); }
+
+  InlineTask(const InlineTask&) = delete;
+  InlineTask& operator=(const InlineTask&) = delete;
+
+  explicit operator bool() const { return m_invoke != nullptr; }
+
+  void operator()() { m_invoke(m_storage); }
+
+ private:
+  void MoveFrom(InlineTask&& other) noexcept {
+    if (other.m_invoke) {
+      other.m_relocate(m_storage, other.m_storage);
+      m_invoke = other.m_invoke;
+      m_relocate = other.m_relocate;
+      m_destroy = other.m_destroy;
+      other.m_invoke = nullptr;
+      other.m_relocate = nullptr;
+      other.m_destroy = nullptr;
+    }
+  }
+
+  void Reset() {
+    if (m_destroy) {
+      m_destroy(m_storage);
+      m_invoke = nullptr;
+      m_relocate = nullptr;
+      m_destroy = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char m_storage[kInlineSize];
+  void (*m_invoke)(void*) = nullptr;
+  void (*m_relocate)(void*, void*) = nullptr;
+  void (*m_destroy)(void*) = nullptr;
+};
+
+// Bounded lock-free MPMC queue (Vyukov-style ring with per-cell sequence
+// numbers). Capacity must be a power of two. A full ring reports failure so
+// the caller can overflow to the mutex-protected queue.
+class MpmcTaskQueue {
+ public:
+  explicit MpmcTaskQueue(size_t capacity)
+      : m_cells(capacity), m_mask(capacity - 1), m_enqueuePos(0), m_dequeuePos(0) {
+    for (size_t i = 0; i < capacity; ++i) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  bool TryPush(InlineTask&& task) {
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = m_cells[pos & m_mask];
+      size_t seq = cell.sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+      if (diff == 0) {
+        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.task = std::move(task);
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // Full
+      } else {
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool TryPop(InlineTask& task) {
+    size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = m_cells[pos & m_mask];
+      size_t seq = cell.sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+      if (diff == 0) {
+        if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          task = std::move(cell.task);
+          cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // Empty
+      } else {
+        pos = m_dequeuePos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  size_t ApproxSize() const {
+    size_t enqueue = m_enqueuePos.load(std::memory_order_acquire);
+    size_t dequeue = m_dequeuePos.load(std::memory_order_acquire);
+    return enqueue > dequeue ? enqueue - dequeue : 0;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    InlineTask task;
+  };
+
+  std::vector<Cell> m_cells;
+  size_t m_mask;
+  std::atomic<size_t> m_enqueuePos;
+  std::atomic<size_t> m_dequeuePos;
+};
+
 class ThreadPool {
  public:
   explicit ThreadPool(size_t numThreads = std::thread::hardware_concurrency())
-      : m_activeJobs(0), m_shutdown(false), m_taskSemaphore(0) {
+      : m_fastTasks(kFastQueueCapacity), m_activeJobs(0), m_shutdown(false), m_taskSemaphore(0) {
     // Ensure at least one thread
     if (numThreads < 1) {
       numThreads = 1;
@@ -195,48 +356,32 @@ class ThreadPool {
       -> std::future<std::invoke_result_t<F, Args...>> {
     using return_type = std::invoke_result_t<F, Args...>;
 
-    // Create packaged task
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
+    // InlineTask handles move-only callables, so the packaged_task goes in
+    // directly - no shared_ptr and no std::function wrapper
+    std::packaged_task<return_type()> task(
         [f = std::forward<F>(f),
          ... args = std::forward<Args>(args)]() mutable {
           return std::invoke(std::move(f), std::move(args)...);
         });
 
-    std::future<return_type> res = task->get_future();
-
-    // Add to queue
-    {
-      detail::lock_guard lock(m_queueMutex);
-
-      // Don't allow enqueueing after stopping
-      if (IsShuttingDown()) {
-        throw std::runtime_error("Enqueue on stopped ThreadPool");
-      }
+    std::future<return_type> res = task.get_future();
 
-      m_tasks.emplace([task = std::move(task)]() { (*task)(); });
-      m_activeJobs.fetch_add(1, std::memory_order_release);
+    if (IsShuttingDown()) {
+      throw std::runtime_error("Enqueue on stopped ThreadPool");
     }
 
-    // Signal a worker thread
-    m_taskSemaphore.release();
+    SubmitTask(InlineTask(std::move(task)));
     return res;
   }
 
   // Submit a job without waiting for result
-  void Submit(std::function<void()> f) {
-    {
-      detail::lock_guard lock(m_queueMutex);
-
-      if (IsShuttingDown()) {
-        throw std::runtime_error("Submit on stopped ThreadPool");
-      }
-
-      m_tasks.emplace(std::move(f));
-      m_activeJobs.fetch_add(1, std::memory_order_release);
+  template <class F>
+  void Submit(F&& f) {
+    if (IsShuttingDown()) {
+      throw std::runtime_error("Submit on stopped ThreadPool");
     }
 
-    // Signal a worker thread
-    m_taskSemaphore.release();
+    SubmitTask(InlineTask(std::forward<F>(f)));
   }
 
   // Wait for all current jobs to complete
@@ -266,7 +411,7 @@ class ThreadPool {
 
   size_t GetQueueSize() const {
     detail::lock_guard lock(m_queueMutex);
-    return m_tasks.size();
+    return m_fastTasks.ApproxSize() + m_tasks.size();
   }
 
   size_t GetActiveJobCount() const {
@@ -288,6 +433,20 @@ class ThreadPool {
   }
 
  private:
+  void SubmitTask(InlineTask&& task) {
+    m_activeJobs.fetch_add(1, std::memory_order_release);
+
+    // Lock-free fast path; overflow to the mutex-protected queue when the
+    // ring is full
+    if (!m_fastTasks.TryPush(std::move(task))) {
+      detail::lock_guard lock(m_queueMutex);
+      m_tasks.emplace(std::move(task));
+    }
+
+    // Signal a worker thread
+    m_taskSemaphore.release();
+  }
+
   void WorkerThread(size_t threadId) {
 #ifdef _WIN32
     // Set thread name for debugging (Windows)
@@ -311,10 +470,10 @@ class ThreadPool {
         break;
       }
 
-      std::function<void()> task;
+      InlineTask task;
 
-      // Get task from queue
-      {
+      // Lock-free queue first, then the overflow queue
+      if (!m_fastTasks.TryPop(task)) {
         detail::lock_guard lock(m_queueMutex);
         if (!m_tasks.empty()) {
           task = std::move(m_tasks.front());
@@ -358,17 +517,25 @@ class ThreadPool {
     // Clear any remaining tasks
     {
       detail::lock_guard lock(m_queueMutex);
-      std::queue<std::function<void()>> empty;
+      std::queue<InlineTask> empty;
       std::swap(m_tasks, empty);
     }
+
+    InlineTask task;
+    while (m_fastTasks.TryPop(task)) {
+      // Drop unexecuted fast-path tasks on shutdown
+    }
   }
 
  private:
+  static constexpr size_t kFastQueueCapacity = 4096;  // Power of two
+
   // Workers using regular std::thread
   std::vector<std::thread> m_workers;
 
-  // Task queue
-  std::queue<std::function<void()>> m_tasks;
+  // Lock-free submission queue (fast path) and overflow queue
+  MpmcTaskQueue m_fastTasks;
+  std::queue<InlineTask> m_tasks;
   mutable detail::PlatformMutex m_queueMutex;
 
   // Cross-platform synchronization
@@ -4,12 +4,14 @@ module;
 #include <memory>
 #include <unordered_map>
 #include <functional>
+#include <cstdint>
 
 #include <utility>
 export module BiomeClassifier;
 
 import GLMModule;
 import TerrainAnalysisTypes;
+import ThreadPool;
 
 export namespace PlanetGen::Generation::Analysis {
 
@@ -42,7 +44,21 @@ public:
         const std::vector<float>& precipitations,
         const std::vector<float>& slopes,
         const std::vector<std::pair<float, float>>& coordinates) const;
-    
+
+    /**
+     * Precompile the classification algorithm into a quantized lookup table
+     * (latitude band x slope band x elevation x temperature x precipitation).
+     * ClassifyPoints then resolves in-range samples with table gathers and
+     * falls back to the exact algorithm for out-of-range ones. The table is
+     * dropped when SetClassificationAlgorithm installs a new algorithm.
+     */
+    void BuildClassificationLUT();
+
+    /**
+     * Enable/disable the LUT fast path in ClassifyPoints (built table required)
+     */
+    void SetLUTClassification(bool enabled) { m_useLUTClassification = enabled; }
+
     /**
      * Get detailed biome analysis for a point including secondary biomes
      */
@@ -57,7 +73,26 @@ public:
         const std::vector<float>& elevations,
         const std::vector<std::pair<float, float>>& coordinates,
         const TerrainAnalysisParams& params) const;
-    
+
+    /**
+     * Grid-aware variant: computes slope with a single blocked stencil pass
+     * (neighbor rows shared between adjacent points) and fuses the climate
+     * computation into the same traversal, chunk-parallel over the attached
+     * ThreadPool. Prefer this over AnalyzePoints when the samples form a
+     * width x height grid.
+     */
+    std::vector<TerrainAnalysisPoint> AnalyzePointsGrid(
+        const std::vector<float>& elevations,
+        const std::vector<std::pair<float, float>>& coordinates,
+        uint32_t width, uint32_t height,
+        const TerrainAnalysisParams& params) const;
+
+    /**
+     * Attach a thread pool for chunk-parallel analysis (borrowed, not owned).
+     * Without one, the batch entry points run serially.
+     */
+    void SetThreadPool(PlanetGen::Core::Threading::ThreadPool* pool) { m_threadPool = pool; }
+
     /**
      * Get biome definition for a specific biome type
      */
@@ -114,7 +149,22 @@ private:
     std::function<BiomeType(float, float, float, float, float, float)> m_classificationAlgorithm;
     bool m_useParallelProcessing = true;
     uint32_t m_chunkSize = 1024;
-    
+    PlanetGen::Core::Threading::ThreadPool* m_threadPool = nullptr;
+
+    // Quantized classification table; 32-bit entries so the AVX2 gather can
+    // index it directly. Empty until BuildClassificationLUT is called.
+    std::vector<int32_t> m_classificationLUT;
+    bool m_useLUTClassification = true;
+
+    // Batch LUT path with exact-classification fallback for out-of-range samples
+    void ClassifyPointsLUT(
+        const std::vector<float>& elevations,
+        const std::vector<float>& temperatures,
+        const std::vector<float>& precipitations,
+        const std::vector<float>& slopes,
+        const std::vector<std::pair<float, float>>& coordinates,
+        std::vector<BiomeType>& results) const;
+
     // Default biome definitions
     void InitializeDefaultBiomes();
     
@@ -131,15 +181,8 @@ private:
     
     // Calculate smooth transitions between biomes
     std::vector<std::pair<BiomeType, float>> CalculateBiomeTransitions(
-        float elevation, float temperature, float precipitation, 
+        float elevation, float temperature, float precipitation,
         float slope, float latitude, float longitude) const;
-    
-    // Parallel processing helpers
-    std::vector<TerrainAnalysisPoint> ProcessChunk(
-        const std::vector<float>& elevations,
-        const std::vector<std::pair<float, float>>& coordinates,
-        const TerrainAnalysisParams& params,
-        uint32_t startIndex, uint32_t endIndex) const;
 };
 
 /**
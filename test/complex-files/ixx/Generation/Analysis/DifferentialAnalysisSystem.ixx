@@ -116,8 +116,18 @@ public:
         const std::vector<std::string>& metricNames,
         const TerrainDataSnapshot& beforeSnapshot,
         const TerrainDataSnapshot& afterSnapshot) const;
-    
+
 private:
+    // Shared body of AnalyzePipelineTransition; allowParallelMetrics is false
+    // when the call already runs inside a pipeline-level job, so transitions
+    // never schedule nested metric batches
+    PipelineAnalysisResult AnalyzeTransitionTask(
+        uint32_t fromStageId,
+        uint32_t toStageId,
+        bool allowParallelMetrics
+    );
+
+
     // Use pImpl idiom to hide implementation details
     class Impl;
     std::unique_ptr<Impl> m_pImpl;
@@ -5,6 +5,7 @@ module;
 #include <complex>
 #include <cmath>
 #include <algorithm>
+#include <future>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -14,6 +15,7 @@ export module FrequencyDomainMetrics;
 
 import ITerrainMetric;
 import AnalysisTypes;
+import ThreadPool;
 
 export namespace PlanetGen::Generation::Analysis {
 
@@ -75,7 +77,15 @@ public:
         return {"elevation"};
     }
 
+    /**
+     * Attach a thread pool for row/column-parallel transforms (borrowed, not
+     * owned). Without one, the spectrum computation runs serially.
+     */
+    void SetThreadPool(PlanetGen::Core::Threading::ThreadPool* pool) { m_threadPool = pool; }
+
 private:
+    PlanetGen::Core::Threading::ThreadPool* m_threadPool = nullptr;
+
     struct FrequencyBand {
         std::string name;
         float minFreq, maxFreq;
@@ -95,131 +105,193 @@ private:
     
     PowerSpectrum ComputePowerSpectrum(const std::vector<float>& data) const {
         PowerSpectrum spectrum{};
-        
+
         // Determine grid dimensions (assume square grid)
         size_t n = data.size();
         size_t width = static_cast<size_t>(std::sqrt(n));
         size_t height = n / width;
-        
+
         if (width < 4 || height < 4) {
             return spectrum; // Too small for meaningful frequency analysis
         }
-        
-        // Compute 1D FFT for each row and column (simplified 2D FFT)
-        std::vector<float> rowMagnitudes, colMagnitudes;
-        
-        // Analyze rows
-        for (size_t y = 0; y < height; ++y) {
-            std::vector<float> rowData;
-            for (size_t x = 0; x < width; ++x) {
-                size_t idx = y * width + x;
-                if (idx < data.size()) {
-                    rowData.push_back(data[idx]);
-                }
+
+        // The FFT requires power-of-two lengths; transform the largest
+        // power-of-two tile of each row and column instead of zero-padding
+        // (padding injects spectral leakage at the tile boundary)
+        const size_t tileWidth = LargestPowerOfTwo(width);
+        const size_t tileHeight = LargestPowerOfTwo(height);
+        const size_t rowBins = tileWidth / 2;
+        const size_t colBins = tileHeight / 2;
+
+        // Row and column transforms are independent; fan them out across the
+        // borrowed thread pool in row/column chunks
+        std::vector<float> rowMagnitudes(height * rowBins, 0.0f);
+        std::vector<float> colMagnitudes(width * colBins, 0.0f);
+
+        auto transformRows = [&](size_t begin, size_t end) {
+            for (size_t y = begin; y < end; ++y) {
+                ComputeRealSpectrum(data.data() + y * width, 1, tileWidth,
+                                    rowMagnitudes.data() + y * rowBins);
             }
-            if (!rowData.empty()) {
-                auto rowSpectrum = Compute1DFFT(rowData);
-                rowMagnitudes.insert(rowMagnitudes.end(), rowSpectrum.begin(), rowSpectrum.end());
+        };
+        auto transformCols = [&](size_t begin, size_t end) {
+            for (size_t x = begin; x < end; ++x) {
+                ComputeRealSpectrum(data.data() + x, width, tileHeight,
+                                    colMagnitudes.data() + x * colBins);
             }
-        }
-        
-        // Analyze columns
-        for (size_t x = 0; x < width; ++x) {
-            std::vector<float> colData;
-            for (size_t y = 0; y < height; ++y) {
-                size_t idx = y * width + x;
-                if (idx < data.size()) {
-                    colData.push_back(data[idx]);
-                }
+        };
+
+        if (m_threadPool && m_threadPool->GetWorkerCount() > 1) {
+            const size_t chunk = std::max<size_t>(1,
+                std::max(height, width) / (m_threadPool->GetWorkerCount() * 4));
+
+            std::vector<std::future<void>> pending;
+            pending.reserve((height + chunk - 1) / chunk + (width + chunk - 1) / chunk);
+
+            for (size_t begin = 0; begin < height; begin += chunk) {
+                size_t end = std::min(height, begin + chunk);
+                pending.push_back(m_threadPool->Enqueue([&transformRows, begin, end] {
+                    transformRows(begin, end);
+                }));
             }
-            if (!colData.empty()) {
-                auto colSpectrum = Compute1DFFT(colData);
-                colMagnitudes.insert(colMagnitudes.end(), colSpectrum.begin(), colSpectrum.end());
+            for (size_t begin = 0; begin < width; begin += chunk) {
+                size_t end = std::min(width, begin + chunk);
+                pending.push_back(m_threadPool->Enqueue([&transformCols, begin, end] {
+                    transformCols(begin, end);
+                }));
             }
+            for (auto& future : pending) {
+                future.get();
+            }
+        } else {
+            transformRows(0, height);
+            transformCols(0, width);
         }
-        
-        // Combine row and column spectra
-        std::vector<float> combinedMagnitudes;
-        combinedMagnitudes.reserve(rowMagnitudes.size() + colMagnitudes.size());
-        combinedMagnitudes.insert(combinedMagnitudes.end(), rowMagnitudes.begin(), rowMagnitudes.end());
-        combinedMagnitudes.insert(combinedMagnitudes.end(), colMagnitudes.begin(), colMagnitudes.end());
-        
-        if (combinedMagnitudes.empty()) {
-            return spectrum;
-        }
-        
-        // Create frequency bins
-        size_t numBins = combinedMagnitudes.size() / 2; // Only positive frequencies
+
+        // Average the per-row and per-column spectra into one radial spectrum
+        // (each bin holds the mean magnitude at that normalized frequency)
+        size_t numBins = std::max(rowBins, colBins);
         spectrum.frequencies.resize(numBins);
-        spectrum.magnitudes.resize(numBins);
-        
+        spectrum.magnitudes.assign(numBins, 0.0f);
+
+        std::vector<float> avgRow(rowBins, 0.0f), avgCol(colBins, 0.0f);
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t k = 0; k < rowBins; ++k) {
+                avgRow[k] += rowMagnitudes[y * rowBins + k];
+            }
+        }
+        for (size_t x = 0; x < width; ++x) {
+            for (size_t k = 0; k < colBins; ++k) {
+                avgCol[k] += colMagnitudes[x * colBins + k];
+            }
+        }
+
         for (size_t i = 0; i < numBins; ++i) {
-            spectrum.frequencies[i] = static_cast<float>(i) / numBins; // Normalized frequency
-            spectrum.magnitudes[i] = combinedMagnitudes[i];
+            spectrum.frequencies[i] = static_cast<float>(i) / numBins; // Normalized frequency (1.0 = Nyquist)
+            float rowValue = avgRow[i * rowBins / numBins] / height;
+            float colValue = avgCol[i * colBins / numBins] / width;
+            spectrum.magnitudes[i] = 0.5f * (rowValue + colValue);
         }
-        
+
         // Compute derived metrics
         spectrum.totalEnergy = 0.0f;
         float weightedFreqSum = 0.0f;
-        
+
         for (size_t i = 0; i < numBins; ++i) {
             float power = spectrum.magnitudes[i] * spectrum.magnitudes[i];
             spectrum.totalEnergy += power;
             weightedFreqSum += spectrum.frequencies[i] * power;
         }
-        
-        spectrum.spectralCentroid = spectrum.totalEnergy > 0.0f ? 
+
+        spectrum.spectralCentroid = spectrum.totalEnergy > 0.0f ?
             weightedFreqSum / spectrum.totalEnergy : 0.0f;
-        
+
         // Find peak frequency
         auto maxIt = std::max_element(spectrum.magnitudes.begin(), spectrum.magnitudes.end());
         if (maxIt != spectrum.magnitudes.end()) {
             size_t peakIdx = std::distance(spectrum.magnitudes.begin(), maxIt);
             spectrum.peakFrequency = spectrum.frequencies[peakIdx];
         }
-        
+
         // Analyze frequency bands
         spectrum.bands = AnalyzeFrequencyBands(spectrum);
-        
+
         return spectrum;
     }
-    
-    std::vector<float> Compute1DFFT(const std::vector<float>& signal) const {
-        // Simplified FFT implementation for magnitude spectrum
-        size_t n = signal.size();
-        if (n < 2) return {};
-        
-        // Find next power of 2
-        size_t fftSize = 1;
-        while (fftSize < n) fftSize <<= 1;
-        
-        // Pad signal to power of 2
-        std::vector<std::complex<float>> fftInput(fftSize, 0.0f);
-        for (size_t i = 0; i < n; ++i) {
-            fftInput[i] = std::complex<float>(signal[i], 0.0f);
+
+    static size_t LargestPowerOfTwo(size_t n) {
+        size_t power = 1;
+        while (power * 2 <= n) power <<= 1;
+        return power;
+    }
+
+    // Iterative radix-2 Cooley-Tukey FFT, in place. Buffer length must be a
+    // power of two.
+    static void FFTRadix2(std::vector<std::complex<float>>& buffer) {
+        const size_t n = buffer.size();
+
+        // Bit-reversal permutation
+        for (size_t i = 1, j = 0; i < n; ++i) {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(buffer[i], buffer[j]);
+            }
         }
-        
-        // Simple DFT (not optimized FFT, but sufficient for analysis)
-        std::vector<std::complex<float>> fftOutput(fftSize);
-        
-        for (size_t k = 0; k < fftSize; ++k) {
-            fftOutput[k] = std::complex<float>(0.0f, 0.0f);
-            for (size_t j = 0; j < fftSize; ++j) {
-                float angle = -2.0f * M_PI * k * j / fftSize;
-                std::complex<float> w(std::cos(angle), std::sin(angle));
-                fftOutput[k] += fftInput[j] * w;
+
+        // Butterfly stages
+        for (size_t len = 2; len <= n; len <<= 1) {
+            const float angle = -2.0f * static_cast<float>(M_PI) / len;
+            const std::complex<float> wlen(std::cos(angle), std::sin(angle));
+
+            for (size_t i = 0; i < n; i += len) {
+                std::complex<float> w(1.0f, 0.0f);
+                for (size_t k = 0; k < len / 2; ++k) {
+                    std::complex<float> u = buffer[i + k];
+                    std::complex<float> v = buffer[i + k + len / 2] * w;
+                    buffer[i + k] = u + v;
+                    buffer[i + k + len / 2] = u - v;
+                    w *= wlen;
+                }
             }
         }
-        
-        // Compute magnitudes
-        std::vector<float> magnitudes;
-        magnitudes.reserve(fftSize / 2);
-        
-        for (size_t i = 0; i < fftSize / 2; ++i) {
-            magnitudes.push_back(std::abs(fftOutput[i]));
+    }
+
+    // Real-input magnitude spectrum of a strided power-of-two tile.
+    // Packs sample pairs into a half-length complex FFT and untangles the
+    // result, so a real transform costs half of a complex one. Writes
+    // tileSize/2 magnitudes (DC through just below Nyquist) to outMagnitudes.
+    static void ComputeRealSpectrum(const float* data, size_t stride,
+                                    size_t tileSize, float* outMagnitudes) {
+        if (tileSize < 4) {
+            return;
+        }
+
+        const size_t half = tileSize / 2;
+        std::vector<std::complex<float>> packed(half);
+        for (size_t m = 0; m < half; ++m) {
+            packed[m] = std::complex<float>(data[(2 * m) * stride],
+                                            data[(2 * m + 1) * stride]);
+        }
+
+        FFTRadix2(packed);
+
+        // Untangle the packed transform into the real signal's spectrum
+        outMagnitudes[0] = std::abs(packed[0].real() + packed[0].imag());
+        for (size_t k = 1; k < half; ++k) {
+            const std::complex<float> zk = packed[k];
+            const std::complex<float> zc = std::conj(packed[half - k]);
+            const std::complex<float> even = 0.5f * (zk + zc);
+            const std::complex<float> odd = std::complex<float>(0.0f, -0.5f) * (zk - zc);
+
+            const float angle = -2.0f * static_cast<float>(M_PI) * k / tileSize;
+            const std::complex<float> w(std::cos(angle), std::sin(angle));
+
+            outMagnitudes[k] = std::abs(even + w * odd);
         }
-        
-        return magnitudes;
     }
     
     std::vector<FrequencyBand> AnalyzeFrequencyBands(const PowerSpectrum& spectrum) const {
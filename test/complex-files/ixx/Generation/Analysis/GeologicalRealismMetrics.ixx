@@ -14,6 +14,7 @@ export module GeologicalRealismMetrics;
 
 import ITerrainMetric;
 import AnalysisTypes;
+import Core.Threading.JobSystem;
 
 export namespace PlanetGen::Generation::Analysis {
 
@@ -229,7 +230,104 @@ private:
         ElevationDistributionAnalysis distribution;
         HydrologyAnalysis hydrology;
     };
-    
+
+    // NEW: Fused single-pass accumulation state
+    //
+    // Evolutionary optimization evaluates these metrics once per candidate
+    // per generation, so the component analyses are combined into a single
+    // blocked traversal: one visit per cell gathers the mass-conservation,
+    // gradient, elevation-distribution, and hydrology partials, and the
+    // gradient stencil is evaluated once per cell and shared between the
+    // gradient and hydrology components. Blocks accumulate independently and
+    // merge in index order (the coastline crossing count carries scan state
+    // across block boundaries).
+    struct FusedGeologicalAccumulator {
+        // Mass conservation (paired before/after cells)
+        double massSumBefore = 0.0;
+        double massSumAfter = 0.0;
+        uint32_t validBefore = 0;
+        uint32_t validAfter = 0;
+        double erosionVolume = 0.0;
+        double depositionVolume = 0.0;
+
+        // Gradient statistics (raw sums; variance derived at finalize)
+        float maxGradientBefore = 0.0f;
+        float maxGradientAfter = 0.0f;
+        double gradientSumBefore = 0.0;
+        double gradientSumAfter = 0.0;
+        double gradientSqSumBefore = 0.0;
+        double gradientSqSumAfter = 0.0;
+        uint32_t impossibleGradientCount = 0;
+
+        // Elevation distribution (after data)
+        uint32_t belowSeaLevel = 0;
+        uint32_t aboveMountains = 0;
+        uint32_t inPlains = 0;
+        uint32_t validElevation = 0;
+        float minElevation = std::numeric_limits<float>::max();
+        float maxElevation = std::numeric_limits<float>::lowest();
+
+        // Raw power sums for the bimodality coefficient
+        double elevationSum = 0.0;
+        double elevationSqSum = 0.0;
+        double elevationCubeSum = 0.0;
+        double elevationQuadSum = 0.0;
+
+        // Coastline zero-crossing scan state (merged across blocks in order)
+        uint32_t coastlineCrossings = 0;
+        bool coastInitialized = false;
+        bool coastFirstAbove = false;
+        bool coastLastAbove = false;
+
+        // Hydrology ponding
+        uint32_t localMinima = 0;
+
+        void Merge(const FusedGeologicalAccumulator& other) {
+            massSumBefore += other.massSumBefore;
+            massSumAfter += other.massSumAfter;
+            validBefore += other.validBefore;
+            validAfter += other.validAfter;
+            erosionVolume += other.erosionVolume;
+            depositionVolume += other.depositionVolume;
+
+            maxGradientBefore = std::max(maxGradientBefore, other.maxGradientBefore);
+            maxGradientAfter = std::max(maxGradientAfter, other.maxGradientAfter);
+            gradientSumBefore += other.gradientSumBefore;
+            gradientSumAfter += other.gradientSumAfter;
+            gradientSqSumBefore += other.gradientSqSumBefore;
+            gradientSqSumAfter += other.gradientSqSumAfter;
+            impossibleGradientCount += other.impossibleGradientCount;
+
+            belowSeaLevel += other.belowSeaLevel;
+            aboveMountains += other.aboveMountains;
+            inPlains += other.inPlains;
+            validElevation += other.validElevation;
+            minElevation = std::min(minElevation, other.minElevation);
+            maxElevation = std::max(maxElevation, other.maxElevation);
+
+            elevationSum += other.elevationSum;
+            elevationSqSum += other.elevationSqSum;
+            elevationCubeSum += other.elevationCubeSum;
+            elevationQuadSum += other.elevationQuadSum;
+
+            if (other.coastInitialized) {
+                if (!coastInitialized) {
+                    coastInitialized = true;
+                    coastFirstAbove = other.coastFirstAbove;
+                    coastlineCrossings = other.coastlineCrossings;
+                } else {
+                    if (coastLastAbove != other.coastFirstAbove) {
+                        coastlineCrossings++;
+                    }
+                    coastlineCrossings += other.coastlineCrossings;
+                }
+                coastLastAbove = other.coastLastAbove;
+            }
+
+            localMinima += other.localMinima;
+        }
+    };
+
     GeologicalAnalysis PerformGeologicalAnalysis(
         const std::vector<float>& beforeData,
         const std::vector<float>& afterData,
@@ -242,11 +340,15 @@ private:
         uint32_t width = gridSize;
         uint32_t height = gridSize;
         
-        // Perform individual analyses
-        analysis.massConservation = AnalyzeMassConservation(beforeData, afterData);
-        analysis.gradients = AnalyzeGradients(beforeData, afterData, width, height);
-        analysis.distribution = AnalyzeElevationDistribution(afterData);
-        analysis.hydrology = AnalyzeHydrology(afterData, width, height);
+        // Perform all component analyses in one fused traversal
+        std::vector<float> afterGradients;
+        FusedGeologicalAccumulator accumulator =
+            RunFusedGeologicalPass(beforeData, afterData, width, height, afterGradients);
+
+        analysis.massConservation = FinalizeMassConservation(accumulator);
+        analysis.gradients = FinalizeGradients(accumulator, afterGradients, width, height);
+        analysis.distribution = FinalizeElevationDistribution(accumulator, afterData.size());
+        analysis.hydrology = FinalizeHydrology(accumulator, width, height);
         
         // Compute overall realism score
         analysis.overallRealismScore = ComputeRealismScore(analysis);
@@ -257,169 +359,305 @@ private:
         return analysis;
     }
     
-    MassConservationAnalysis AnalyzeMassConservation(
-        const std::vector<float>& beforeData,
-        const std::vector<float>& afterData
-    ) const {
-        MassConservationAnalysis analysis{};
-        
-        // Calculate total mass (sum of elevations)
-        analysis.totalMassBefore = 0.0f;
-        analysis.totalMassAfter = 0.0f;
-        
-        uint32_t validBefore = 0, validAfter = 0;
-        
-        for (size_t i = 0; i < beforeData.size() && i < afterData.size(); ++i) {
-            if (std::isfinite(beforeData[i])) {
-                analysis.totalMassBefore += beforeData[i];
-                validBefore++;
+    // NEW: Single-cell gradient stencil shared by the fused pass and the
+    // slope-elevation analysis
+    static float ComputeCellGradient(const std::vector<float>& data,
+                                     uint32_t width, uint32_t height,
+                                     uint32_t x, uint32_t y) {
+        uint32_t idx = y * width + x;
+        if (idx >= data.size() || !std::isfinite(data[idx])) {
+            return 0.0f;
+        }
+
+        float dx = 0.0f, dy = 0.0f;
+
+        // Compute gradients using available neighbors
+        if (x > 0 && x < width - 1) {
+            uint32_t leftIdx = y * width + (x - 1);
+            uint32_t rightIdx = y * width + (x + 1);
+            if (leftIdx < data.size() && rightIdx < data.size() &&
+                std::isfinite(data[leftIdx]) && std::isfinite(data[rightIdx])) {
+                dx = (data[rightIdx] - data[leftIdx]) / 2.0f;
             }
-            if (std::isfinite(afterData[i])) {
-                analysis.totalMassAfter += afterData[i];
-                validAfter++;
+        }
+
+        if (y > 0 && y < height - 1) {
+            uint32_t upIdx = (y - 1) * width + x;
+            uint32_t downIdx = (y + 1) * width + x;
+            if (upIdx < data.size() && downIdx < data.size() &&
+                std::isfinite(data[upIdx]) && std::isfinite(data[downIdx])) {
+                dy = (data[downIdx] - data[upIdx]) / 2.0f;
             }
         }
-        
-        // Normalize by valid count
-        if (validBefore > 0) analysis.totalMassBefore /= validBefore;
-        if (validAfter > 0) analysis.totalMassAfter /= validAfter;
-        
-        analysis.massChange = analysis.totalMassAfter - analysis.totalMassBefore;
-        analysis.massChangePercentage = analysis.totalMassBefore != 0.0f ?
-            (analysis.massChange / analysis.totalMassBefore) * 100.0f : 0.0f;
-        
-        // Calculate erosion and deposition volumes
-        analysis.erosionVolume = 0.0f;
-        analysis.depositionVolume = 0.0f;
-        
-        for (size_t i = 0; i < beforeData.size() && i < afterData.size(); ++i) {
-            if (std::isfinite(beforeData[i]) && std::isfinite(afterData[i])) {
-                float change = afterData[i] - beforeData[i];
-                if (change < 0) {
-                    analysis.erosionVolume += std::abs(change);
+
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    // NEW: Accumulate one linear index range of the fused traversal.
+    // Blocks write disjoint ranges of afterGradients, so this is safe to run
+    // on parallel job workers; neighbor reads are on immutable input data.
+    static void AccumulateFusedRange(
+        const std::vector<float>& beforeData,
+        const std::vector<float>& afterData,
+        uint32_t width,
+        uint32_t height,
+        size_t begin,
+        size_t end,
+        FusedGeologicalAccumulator& acc,
+        std::vector<float>& afterGradients
+    ) {
+        const size_t pairCount = std::min(beforeData.size(), afterData.size());
+        const size_t gridCells = static_cast<size_t>(width) * height;
+        const bool sameField = (&beforeData == &afterData);
+        const float seaLevel = 0.0f;
+        const float mountainThreshold = 1000.0f; // 1km+ is mountainous
+        const float maxReasonableGradient = 2.0f; // 63° slope - very steep but possible
+
+        for (size_t i = begin; i < end; ++i) {
+            // Mass conservation terms (meaningless for complete-terrain
+            // evaluation, where before and after are the same field)
+            if (!sameField && i < pairCount) {
+                if (std::isfinite(beforeData[i])) {
+                    acc.massSumBefore += beforeData[i];
+                    acc.validBefore++;
+                }
+                if (std::isfinite(afterData[i])) {
+                    acc.massSumAfter += afterData[i];
+                    acc.validAfter++;
+                }
+                if (std::isfinite(beforeData[i]) && std::isfinite(afterData[i])) {
+                    float change = afterData[i] - beforeData[i];
+                    if (change < 0) {
+                        acc.erosionVolume += std::abs(change);
+                    } else {
+                        acc.depositionVolume += change;
+                    }
+                }
+            }
+
+            // Elevation distribution, bimodality moments, and coastline
+            // crossings on the after field
+            if (i < afterData.size() && std::isfinite(afterData[i])) {
+                float elevation = afterData[i];
+                acc.validElevation++;
+                acc.minElevation = std::min(acc.minElevation, elevation);
+                acc.maxElevation = std::max(acc.maxElevation, elevation);
+
+                if (elevation < seaLevel) {
+                    acc.belowSeaLevel++;
+                } else if (elevation > mountainThreshold) {
+                    acc.aboveMountains++;
                 } else {
-                    analysis.depositionVolume += change;
+                    acc.inPlains++;
+                }
+
+                double e = elevation;
+                acc.elevationSum += e;
+                acc.elevationSqSum += e * e;
+                acc.elevationCubeSum += e * e * e;
+                acc.elevationQuadSum += e * e * e * e;
+
+                bool isAboveSeaLevel = elevation >= seaLevel;
+                if (!acc.coastInitialized) {
+                    acc.coastInitialized = true;
+                    acc.coastFirstAbove = isAboveSeaLevel;
+                } else if (isAboveSeaLevel != acc.coastLastAbove) {
+                    acc.coastlineCrossings++;
+                }
+                acc.coastLastAbove = isAboveSeaLevel;
+            }
+
+            // Grid-stencil terms: the gradient is evaluated once here and
+            // shared between the gradient and hydrology components
+            if (i < gridCells) {
+                uint32_t x = static_cast<uint32_t>(i % width);
+                uint32_t y = static_cast<uint32_t>(i / width);
+
+                float gradientAfter = ComputeCellGradient(afterData, width, height, x, y);
+                afterGradients[i] = gradientAfter;
+
+                acc.maxGradientAfter = std::max(acc.maxGradientAfter, gradientAfter);
+                acc.gradientSumAfter += gradientAfter;
+                acc.gradientSqSumAfter += static_cast<double>(gradientAfter) * gradientAfter;
+                if (gradientAfter > maxReasonableGradient) {
+                    acc.impossibleGradientCount++;
+                }
+
+                float gradientBefore = sameField ? gradientAfter
+                    : ComputeCellGradient(beforeData, width, height, x, y);
+                acc.maxGradientBefore = std::max(acc.maxGradientBefore, gradientBefore);
+                acc.gradientSumBefore += gradientBefore;
+                acc.gradientSqSumBefore += static_cast<double>(gradientBefore) * gradientBefore;
+
+                // Ponding: strict local minima in the 8-neighborhood
+                if (x >= 1 && x + 1 < width && y >= 1 && y + 1 < height &&
+                    i < afterData.size() && std::isfinite(afterData[i])) {
+                    bool isLocalMinimum = true;
+                    float centerValue = afterData[i];
+
+                    for (int dy = -1; dy <= 1 && isLocalMinimum; ++dy) {
+                        for (int dx = -1; dx <= 1 && isLocalMinimum; ++dx) {
+                            if (dx == 0 && dy == 0) continue;
+
+                            size_t nidx = static_cast<size_t>(y + dy) * width + (x + dx);
+                            if (nidx < afterData.size() && std::isfinite(afterData[nidx])) {
+                                if (afterData[nidx] <= centerValue) {
+                                    isLocalMinimum = false;
+                                }
+                            }
+                        }
+                    }
+
+                    if (isLocalMinimum) {
+                        acc.localMinima++;
+                    }
                 }
             }
         }
-        
+    }
+
+    // NEW: Blocked, parallel driver for the fused traversal
+    FusedGeologicalAccumulator RunFusedGeologicalPass(
+        const std::vector<float>& beforeData,
+        const std::vector<float>& afterData,
+        uint32_t width,
+        uint32_t height,
+        std::vector<float>& afterGradients
+    ) const {
+        const size_t gridCells = static_cast<size_t>(width) * height;
+        const size_t totalCells = std::max(afterData.size(), gridCells);
+        afterGradients.assign(gridCells, 0.0f);
+
+        constexpr size_t kBlockSize = 65536;
+
+        thread_local static bool inParallelExecution = false;
+        if (totalCells <= kBlockSize * 2 || inParallelExecution) {
+            // Small terrains (or re-entrant calls from inside a job, which
+            // would deadlock the JobSystem) run the single-threaded pass
+            FusedGeologicalAccumulator acc;
+            AccumulateFusedRange(beforeData, afterData, width, height, 0, totalCells, acc, afterGradients);
+            return acc;
+        }
+        inParallelExecution = true;
+
+        // Per-block partials computed in parallel, merged in index order so
+        // the coastline scan state carries across block boundaries correctly
+        const size_t blockCount = (totalCells + kBlockSize - 1) / kBlockSize;
+        std::vector<PlanetGen::Core::Threading::TypedJob<FusedGeologicalAccumulator>*> jobs;
+        jobs.reserve(blockCount);
+
+        for (size_t block = 0; block < blockCount; ++block) {
+            const size_t begin = block * kBlockSize;
+            const size_t end = std::min(begin + kBlockSize, totalCells);
+
+            auto* job = PlanetGen::Core::Threading::JobSystem::Instance().CreateJob<FusedGeologicalAccumulator>(
+                [&beforeData, &afterData, width, height, begin, end, &afterGradients]() -> FusedGeologicalAccumulator {
+                    FusedGeologicalAccumulator partial;
+                    AccumulateFusedRange(beforeData, afterData, width, height, begin, end, partial, afterGradients);
+                    return partial;
+                },
+                "GeologicalFusedBlock"
+            );
+            PlanetGen::Core::Threading::JobSystem::Instance().Schedule(job);
+            jobs.push_back(job);
+        }
+
+        FusedGeologicalAccumulator acc;
+        for (auto* job : jobs) {
+            acc.Merge(job->GetResult());
+            delete job;
+        }
+
+        inParallelExecution = false;
+        return acc;
+    }
+
+    MassConservationAnalysis FinalizeMassConservation(const FusedGeologicalAccumulator& acc) const {
+        MassConservationAnalysis analysis{};
+
+        // Total mass normalized by valid count
+        analysis.totalMassBefore = acc.validBefore > 0 ?
+            static_cast<float>(acc.massSumBefore / acc.validBefore) : 0.0f;
+        analysis.totalMassAfter = acc.validAfter > 0 ?
+            static_cast<float>(acc.massSumAfter / acc.validAfter) : 0.0f;
+
+        analysis.massChange = analysis.totalMassAfter - analysis.totalMassBefore;
+        analysis.massChangePercentage = analysis.totalMassBefore != 0.0f ?
+            (analysis.massChange / analysis.totalMassBefore) * 100.0f : 0.0f;
+
+        analysis.erosionVolume = static_cast<float>(acc.erosionVolume);
+        analysis.depositionVolume = static_cast<float>(acc.depositionVolume);
         analysis.netVolumeChange = analysis.depositionVolume - analysis.erosionVolume;
-        
+
         // Mass conservation check (allow small tolerance for numerical precision)
         float tolerance = 5.0f; // 5% tolerance
         analysis.massConserved = std::abs(analysis.massChangePercentage) <= tolerance;
-        
+
         if (!analysis.massConserved) {
             if (analysis.massChangePercentage > tolerance) {
-                analysis.conservationIssue = "Mass increase of " + 
+                analysis.conservationIssue = "Mass increase of " +
                     std::to_string(analysis.massChangePercentage) + "% - material created from nothing";
             } else {
-                analysis.conservationIssue = "Mass loss of " + 
+                analysis.conservationIssue = "Mass loss of " +
                     std::to_string(std::abs(analysis.massChangePercentage)) + "% - material disappeared";
             }
         }
-        
+
         return analysis;
     }
-    
-    GradientAnalysis AnalyzeGradients(const std::vector<float>& beforeData,
-                                    const std::vector<float>& afterData,
-                                    uint32_t width, uint32_t height) const {
+
+    GradientAnalysis FinalizeGradients(const FusedGeologicalAccumulator& acc,
+                                       const std::vector<float>& afterGradients,
+                                       uint32_t width, uint32_t height) const {
         GradientAnalysis analysis{};
-        
-        auto gradientsBefore = ComputeGradients(beforeData, width, height);
-        auto gradientsAfter = ComputeGradients(afterData, width, height);
-        
-        if (!gradientsBefore.empty()) {
-            analysis.maxGradientBefore = *std::max_element(gradientsBefore.begin(), gradientsBefore.end());
-            analysis.averageGradientBefore = std::accumulate(gradientsBefore.begin(), gradientsBefore.end(), 0.0f) / gradientsBefore.size();
-            analysis.gradientVarianceBefore = ComputeVariance(gradientsBefore);
-        }
-        
-        if (!gradientsAfter.empty()) {
-            analysis.maxGradientAfter = *std::max_element(gradientsAfter.begin(), gradientsAfter.end());
-            analysis.averageGradientAfter = std::accumulate(gradientsAfter.begin(), gradientsAfter.end(), 0.0f) / gradientsAfter.size();
-            analysis.gradientVarianceAfter = ComputeVariance(gradientsAfter);
+
+        const size_t gradientCount = static_cast<size_t>(width) * height;
+        if (gradientCount > 0) {
+            const double n = static_cast<double>(gradientCount);
+            const double meanBefore = acc.gradientSumBefore / n;
+            const double meanAfter = acc.gradientSumAfter / n;
+
+            analysis.maxGradientBefore = acc.maxGradientBefore;
+            analysis.averageGradientBefore = static_cast<float>(meanBefore);
+            analysis.gradientVarianceBefore = static_cast<float>(
+                std::max(0.0, acc.gradientSqSumBefore / n - meanBefore * meanBefore));
+
+            analysis.maxGradientAfter = acc.maxGradientAfter;
+            analysis.averageGradientAfter = static_cast<float>(meanAfter);
+            analysis.gradientVarianceAfter = static_cast<float>(
+                std::max(0.0, acc.gradientSqSumAfter / n - meanAfter * meanAfter));
         }
-        
+
         // Check for impossible gradients (assume 1m/pixel, so gradient > 1.0 = 45°+ slope)
         float maxReasonableGradient = 2.0f; // 63° slope - very steep but possible
-        analysis.impossibleGradientCount = 0;
-        
-        for (float gradient : gradientsAfter) {
-            if (gradient > maxReasonableGradient) {
-                analysis.impossibleGradientCount++;
-            }
-        }
-        
-        analysis.hasUnrealisticCliffs = analysis.impossibleGradientCount > gradientsAfter.size() * 0.01f; // More than 1% impossible gradients
-        
+        analysis.impossibleGradientCount = static_cast<float>(acc.impossibleGradientCount);
+
+        analysis.hasUnrealisticCliffs = analysis.impossibleGradientCount > gradientCount * 0.01f; // More than 1% impossible gradients
+
         if (analysis.hasUnrealisticCliffs) {
-            analysis.gradientIssues = "Found " + std::to_string(static_cast<uint32_t>(analysis.impossibleGradientCount)) + 
+            analysis.gradientIssues = "Found " + std::to_string(static_cast<uint32_t>(analysis.impossibleGradientCount)) +
                                     " impossible gradients (>" + std::to_string(maxReasonableGradient) + ")";
         }
-        
+
         // Create gradient distribution histogram
-        analysis.gradientDistribution = CreateGradientHistogram(gradientsAfter);
-        
+        analysis.gradientDistribution = CreateGradientHistogram(afterGradients);
+
         return analysis;
     }
     
     std::vector<float> ComputeGradients(const std::vector<float>& data, uint32_t width, uint32_t height) const {
         std::vector<float> gradients;
         gradients.reserve(data.size());
-        
+
         for (uint32_t y = 0; y < height; ++y) {
             for (uint32_t x = 0; x < width; ++x) {
-                uint32_t idx = y * width + x;
-                if (idx >= data.size() || !std::isfinite(data[idx])) {
-                    gradients.push_back(0.0f);
-                    continue;
-                }
-                
-                float dx = 0.0f, dy = 0.0f;
-                
-                // Compute gradients using available neighbors
-                if (x > 0 && x < width - 1) {
-                    uint32_t leftIdx = y * width + (x - 1);
-                    uint32_t rightIdx = y * width + (x + 1);
-                    if (leftIdx < data.size() && rightIdx < data.size() &&
-                        std::isfinite(data[leftIdx]) && std::isfinite(data[rightIdx])) {
-                        dx = (data[rightIdx] - data[leftIdx]) / 2.0f;
-                    }
-                }
-                
-                if (y > 0 && y < height - 1) {
-                    uint32_t upIdx = (y - 1) * width + x;
-                    uint32_t downIdx = (y + 1) * width + x;
-                    if (upIdx < data.size() && downIdx < data.size() &&
-                        std::isfinite(data[upIdx]) && std::isfinite(data[downIdx])) {
-                        dy = (data[downIdx] - data[upIdx]) / 2.0f;
-                    }
-                }
-                
-                float gradient = std::sqrt(dx * dx + dy * dy);
-                gradients.push_back(gradient);
+                gradients.push_back(ComputeCellGradient(data, width, height, x, y));
             }
         }
-        
+
         return gradients;
     }
-    
-    float ComputeVariance(const std::vector<float>& data) const {
-        if (data.empty()) return 0.0f;
-        
-        float mean = std::accumulate(data.begin(), data.end(), 0.0f) / data.size();
-        float variance = 0.0f;
-        
-        for (float value : data) {
-            float diff = value - mean;
-            variance += diff * diff;
-        }
-        
-        return variance / data.size();
-    }
-    
+
     std::vector<float> CreateGradientHistogram(const std::vector<float>& gradients) const {
         const size_t numBins = 20;
         std::vector<float> histogram(numBins, 0.0f);
@@ -447,174 +685,96 @@ private:
         return histogram;
     }
     
-    ElevationDistributionAnalysis AnalyzeElevationDistribution(const std::vector<float>& data) const {
+    ElevationDistributionAnalysis FinalizeElevationDistribution(
+        const FusedGeologicalAccumulator& acc,
+        size_t dataSize
+    ) const {
         ElevationDistributionAnalysis analysis{};
-        
-        if (data.empty()) return analysis;
-        
-        // Define thresholds (in meters, assuming data is in meters)
-        float seaLevel = 0.0f;
-        float mountainThreshold = 1000.0f; // 1km+ is mountainous
-        
-        uint32_t belowSeaLevel = 0;
-        uint32_t aboveMountains = 0;
-        uint32_t inPlains = 0;
-        uint32_t validCount = 0;
-        
-        float minElevation = std::numeric_limits<float>::max();
-        float maxElevation = std::numeric_limits<float>::lowest();
-        
-        for (float elevation : data) {
-            if (std::isfinite(elevation)) {
-                validCount++;
-                minElevation = std::min(minElevation, elevation);
-                maxElevation = std::max(maxElevation, elevation);
-                
-                if (elevation < seaLevel) {
-                    belowSeaLevel++;
-                } else if (elevation > mountainThreshold) {
-                    aboveMountains++;
-                } else {
-                    inPlains++;
-                }
-            }
-        }
-        
-        if (validCount > 0) {
-            analysis.seaLevelPercentage = (static_cast<float>(belowSeaLevel) / validCount) * 100.0f;
-            analysis.mountainPercentage = (static_cast<float>(aboveMountains) / validCount) * 100.0f;
-            analysis.plainsPercentage = (static_cast<float>(inPlains) / validCount) * 100.0f;
+
+        if (dataSize == 0) return analysis;
+
+        if (acc.validElevation > 0) {
+            analysis.seaLevelPercentage = (static_cast<float>(acc.belowSeaLevel) / acc.validElevation) * 100.0f;
+            analysis.mountainPercentage = (static_cast<float>(acc.aboveMountains) / acc.validElevation) * 100.0f;
+            analysis.plainsPercentage = (static_cast<float>(acc.inPlains) / acc.validElevation) * 100.0f;
         }
-        
+
         // Check for realistic distribution (Earth-like: ~70% ocean, ~15% mountains)
         bool hasReasonableOceans = analysis.seaLevelPercentage >= 50.0f && analysis.seaLevelPercentage <= 85.0f;
         bool hasReasonableMountains = analysis.mountainPercentage >= 5.0f && analysis.mountainPercentage <= 30.0f;
         analysis.hasRealisticDistribution = hasReasonableOceans && hasReasonableMountains;
-        
+
         if (!analysis.hasRealisticDistribution) {
             analysis.distributionIssues = "Unrealistic elevation distribution: " +
                 std::to_string(analysis.seaLevelPercentage) + "% ocean, " +
                 std::to_string(analysis.mountainPercentage) + "% mountains";
         }
-        
+
         // Compute bimodality (separation between ocean and land)
-        analysis.elevationBimodality = ComputeBimodality(data);
-        
-        // Coastline complexity (simplified)
-        analysis.coastlineComplexity = EstimateCoastlineComplexity(data);
-        
+        analysis.elevationBimodality = FinalizeBimodality(acc, dataSize);
+
+        // Coastline complexity: zero-crossings around sea level gathered
+        // during the fused scan
+        analysis.coastlineComplexity = static_cast<float>(acc.coastlineCrossings) / dataSize;
+
         return analysis;
     }
-    
-    float ComputeBimodality(const std::vector<float>& data) const {
-        // Simplified bimodality coefficient
-        if (data.size() < 10) return 0.0f;
-        
-        // Compute skewness and kurtosis
-        float mean = std::accumulate(data.begin(), data.end(), 0.0f) / data.size();
-        float variance = 0.0f;
-        float skewnessSum = 0.0f;
-        float kurtosisSum = 0.0f;
-        
-        for (float value : data) {
-            if (std::isfinite(value)) {
-                float diff = value - mean;
-                variance += diff * diff;
-                skewnessSum += diff * diff * diff;
-                kurtosisSum += diff * diff * diff * diff;
-            }
-        }
-        
-        variance /= data.size();
-        float stdDev = std::sqrt(variance);
-        
-        if (stdDev == 0.0f) return 0.0f;
-        
-        float skewness = skewnessSum / (data.size() * stdDev * stdDev * stdDev);
-        float kurtosis = kurtosisSum / (data.size() * variance * variance);
-        
+
+    float FinalizeBimodality(const FusedGeologicalAccumulator& acc, size_t dataSize) const {
+        // Simplified bimodality coefficient; the central moments are
+        // recovered from the raw power sums gathered in the fused pass
+        if (dataSize < 10) return 0.0f;
+
+        double n = static_cast<double>(dataSize);
+        double cnt = static_cast<double>(acc.validElevation);
+        double mean = acc.elevationSum / n;
+
+        double m2 = acc.elevationSqSum - 2.0 * mean * acc.elevationSum + cnt * mean * mean;
+        double m3 = acc.elevationCubeSum - 3.0 * mean * acc.elevationSqSum
+                  + 3.0 * mean * mean * acc.elevationSum - cnt * mean * mean * mean;
+        double m4 = acc.elevationQuadSum - 4.0 * mean * acc.elevationCubeSum
+                  + 6.0 * mean * mean * acc.elevationSqSum
+                  - 4.0 * mean * mean * mean * acc.elevationSum
+                  + cnt * mean * mean * mean * mean;
+
+        double variance = std::max(0.0, m2 / n);
+        double stdDev = std::sqrt(variance);
+
+        if (stdDev == 0.0) return 0.0f;
+
+        double skewness = m3 / (n * stdDev * stdDev * stdDev);
+        double kurtosis = m4 / (n * variance * variance);
+
         // Bimodality coefficient
-        float bimodality = (skewness * skewness + 1.0f) / (kurtosis + 3.0f * (data.size() - 1.0f) * (data.size() - 1.0f) / ((data.size() - 2.0f) * (data.size() - 3.0f)));
-        
-        return bimodality;
-    }
-    
-    float EstimateCoastlineComplexity(const std::vector<float>& data) const {
-        // Simplified coastline complexity based on zero-crossings around sea level
-        if (data.empty()) return 0.0f;
-        
-        float seaLevel = 0.0f;
-        uint32_t crossings = 0;
-        bool wasAboveSeaLevel = false;
-        bool initialized = false;
-        
-        for (float elevation : data) {
-            if (std::isfinite(elevation)) {
-                bool isAboveSeaLevel = elevation >= seaLevel;
-                
-                if (initialized && isAboveSeaLevel != wasAboveSeaLevel) {
-                    crossings++;
-                }
-                
-                wasAboveSeaLevel = isAboveSeaLevel;
-                initialized = true;
-            }
-        }
-        
-        return static_cast<float>(crossings) / data.size();
+        double bimodality = (skewness * skewness + 1.0) /
+            (kurtosis + 3.0 * (n - 1.0) * (n - 1.0) / ((n - 2.0) * (n - 3.0)));
+
+        return static_cast<float>(bimodality);
     }
-    
-    HydrologyAnalysis AnalyzeHydrology(const std::vector<float>& data, uint32_t width, uint32_t height) const {
+
+    HydrologyAnalysis FinalizeHydrology(const FusedGeologicalAccumulator& acc,
+                                        uint32_t width, uint32_t height) const {
         HydrologyAnalysis analysis{};
-        
-        // Simplified hydrology analysis
-        auto gradients = ComputeGradients(data, width, height);
-        
-        if (!gradients.empty()) {
-            analysis.averageSlope = std::accumulate(gradients.begin(), gradients.end(), 0.0f) / gradients.size();
-            
+
+        const size_t gradientCount = static_cast<size_t>(width) * height;
+        if (gradientCount > 0) {
+            // Average slope reuses the gradient stencil sums from the fused
+            // pass instead of recomputing gradients over the whole field
+            analysis.averageSlope = static_cast<float>(
+                acc.gradientSumAfter / static_cast<double>(gradientCount));
+
             // Check for adequate drainage (average slope should be > 0.001 for drainage)
             analysis.hasValidDrainage = analysis.averageSlope > 0.001f;
-            
+
             if (!analysis.hasValidDrainage) {
                 analysis.hydrologyIssues = "Insufficient slope for natural drainage (avg slope: " +
                     std::to_string(analysis.averageSlope) + ")";
             }
         }
-        
-        // Count potential ponding areas (local minima)
-        uint32_t localMinima = 0;
-        for (uint32_t y = 1; y < height - 1; ++y) {
-            for (uint32_t x = 1; x < width - 1; ++x) {
-                uint32_t idx = y * width + x;
-                if (idx >= data.size() || !std::isfinite(data[idx])) continue;
-                
-                bool isLocalMinimum = true;
-                float centerValue = data[idx];
-                
-                // Check 8-neighborhood
-                for (int dy = -1; dy <= 1 && isLocalMinimum; ++dy) {
-                    for (int dx = -1; dx <= 1 && isLocalMinimum; ++dx) {
-                        if (dx == 0 && dy == 0) continue;
-                        
-                        uint32_t nidx = (y + dy) * width + (x + dx);
-                        if (nidx < data.size() && std::isfinite(data[nidx])) {
-                            if (data[nidx] <= centerValue) {
-                                isLocalMinimum = false;
-                            }
-                        }
-                    }
-                }
-                
-                if (isLocalMinimum) {
-                    localMinima++;
-                }
-            }
-        }
-        
-        analysis.ponding = static_cast<float>(localMinima) / (width * height);
+
+        analysis.ponding = static_cast<float>(acc.localMinima) / (width * height);
         analysis.drainageDensity = 1.0f - analysis.ponding; // Simplified metric
-        
+
         return analysis;
     }
     
@@ -733,16 +893,18 @@ private:
         uint32_t height
     ) const {
         PhysicalCharacteristics characteristics;
-        
-        // Gradient analysis
-        characteristics.gradients = AnalyzeGradients(elevationData, elevationData, width, height);
-        
-        // Elevation distribution
-        characteristics.distribution = AnalyzeElevationDistribution(elevationData);
-        
-        // Hydrology
-        characteristics.hydrology = AnalyzeHydrology(elevationData, width, height);
-        
+
+        // One fused traversal covers the gradient, distribution, and
+        // hydrology components; the gradient stencil is evaluated once per
+        // cell and shared between them
+        std::vector<float> gradients;
+        FusedGeologicalAccumulator accumulator =
+            RunFusedGeologicalPass(elevationData, elevationData, width, height, gradients);
+
+        characteristics.gradients = FinalizeGradients(accumulator, gradients, width, height);
+        characteristics.distribution = FinalizeElevationDistribution(accumulator, elevationData.size());
+        characteristics.hydrology = FinalizeHydrology(accumulator, width, height);
+
         return characteristics;
     }
     
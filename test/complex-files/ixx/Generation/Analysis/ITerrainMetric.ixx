@@ -3,6 +3,7 @@ module;
 #include <vector>
 #include <string>
 #include <memory>
+#include <cstdint>
 
 #include <functional>
 #include <utility>
@@ -13,9 +14,54 @@ import TerrainDataSnapshot;
 
 export namespace PlanetGen::Generation::Analysis {
 
+/**
+ * @brief Per-sample quantities a fusable metric can request from the executor
+ *
+ * Combined as a bitmask; the executor only computes what some registered
+ * metric actually asked for.
+ */
+enum class SampleQuantity : uint32_t {
+    Value = 1u << 0,        // Before/after sample values
+    Gradient = 1u << 1,     // Central-difference gradients (0 at grid borders)
+    Neighborhood = 1u << 2, // 3x3 neighborhood mean and variance
+};
+
+/**
+ * @brief Shared intermediates handed to fused accumulators for one sample
+ *
+ * Only the fields covered by the combined quantity mask are populated.
+ */
+struct FusedSample {
+    size_t index = 0;
+    float before = 0.0f;
+    float after = 0.0f;
+    float beforeGradX = 0.0f;
+    float beforeGradY = 0.0f;
+    float afterGradX = 0.0f;
+    float afterGradY = 0.0f;
+    float beforeNeighborhoodMean = 0.0f;
+    float beforeNeighborhoodVariance = 0.0f;
+    float afterNeighborhoodMean = 0.0f;
+    float afterNeighborhoodVariance = 0.0f;
+};
+
+/**
+ * @brief Per-metric accumulator fed by the fused execution pass
+ *
+ * Created fresh for each transition analysis, so implementations can hold
+ * running state without making the metric itself stateful.
+ */
+class IFusedMetricAccumulator {
+public:
+    virtual ~IFusedMetricAccumulator() = default;
+
+    virtual void Accumulate(const FusedSample& sample) = 0;
+    virtual TerrainMetricResult Finalize() = 0;
+};
+
 /**
  * @brief Interface for terrain quality metrics
- * 
+ *
  * Extensible framework for implementing different types of terrain analysis metrics.
  * Each metric can analyze transitions between pipeline stages and detect specific
  * types of data degradation or improvement.
@@ -63,6 +109,36 @@ public:
     // Self-diagnostics
     virtual bool SelfTest() const = 0;
     virtual std::vector<std::string> GetDependencies() const = 0;
+
+    // Fused execution (optional). Metrics that can express their analysis as
+    // per-sample accumulation return the quantities they need plus a fresh
+    // accumulator, and the executor feeds every opted-in metric from one
+    // blocked traversal instead of one full pass per metric. Metrics that
+    // return nullptr keep the AnalyzeTransition path.
+    virtual uint32_t GetRequiredSampleQuantities() const { return 0; }
+    virtual std::unique_ptr<IFusedMetricAccumulator> CreateFusedAccumulator(
+        const TerrainDataSnapshot& beforeSnapshot,
+        const TerrainDataSnapshot& afterSnapshot) const {
+        return nullptr;
+    }
+};
+
+/**
+ * @brief Single-traversal execution engine for terrain metrics
+ *
+ * Runs a set of metrics over one stage transition. Metrics that provide a
+ * fused accumulator share one blocked pass over the elevation grids - shared
+ * intermediates (values, gradients, neighborhood statistics) are computed
+ * once per sample and fed to every accumulator - while the remaining metrics
+ * fall back to their own AnalyzeTransition traversal. Results come back in
+ * the order the metrics were given.
+ */
+class FusedMetricExecutor {
+public:
+    static std::vector<TerrainMetricResult> Run(
+        const std::vector<ITerrainMetric*>& metrics,
+        const TerrainDataSnapshot& beforeSnapshot,
+        const TerrainDataSnapshot& afterSnapshot);
 };
 
 /**
@@ -13,9 +13,36 @@ import TerrainAnalysisTypes;
 
 export namespace PlanetGen::Generation::Analysis {
 
+/**
+ * @brief Min/max elevation mip chain for coarse-to-fine terrain analysis
+ *
+ * Each level halves the previous level's resolution; a texel stores the
+ * minimum and maximum elevation of its full-resolution footprint, so coarse
+ * tests can conservatively rule regions out (a footprint whose max is below
+ * a peak threshold cannot contain a peak, and a footprint with zero relief
+ * cannot contain a strict local minimum). Built once per terrain and
+ * shareable between analyzers.
+ */
+struct ElevationPyramid {
+    struct Level {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<float> minData;
+        std::vector<float> maxData;
+    };
+
+    uint32_t sourceWidth = 0;
+    uint32_t sourceHeight = 0;
+    const void* sourceData = nullptr; // Identity of the source buffer, for cache validation
+    std::vector<Level> levels;        // levels[0] is half resolution
+
+    static std::shared_ptr<const ElevationPyramid> Build(
+        const std::vector<float>& elevation, uint32_t width, uint32_t height);
+};
+
 /**
  * @brief Advanced mountain structure and tectonic analysis for realistic terrain evaluation
- * 
+ *
  * This class provides sophisticated analysis of mountain formations, tectonic patterns,
  * and erosion processes to determine how realistic generated terrain appears compared
  * to real-world geological processes.
@@ -66,7 +93,22 @@ public:
     float CalculateOverallMountainRealism(const TectonicActivity& tectonic, const ErosionAnalysis& erosion) const {
         return (tectonic.overallRealism * 0.6f + erosion.overallErosionRealism * 0.4f);
     }
-    
+
+    /**
+     * @brief Enable coarse-to-fine analysis over the elevation pyramid
+     *
+     * Candidate peak and valley regions are detected on coarse mip levels and
+     * only those regions are refined at full resolution. The coarse tests are
+     * conservative, so the detected structures are identical to a full scan.
+     */
+    void EnablePyramidMode(bool enable = true) { m_usePyramid = enable; }
+
+    /**
+     * @brief Share a pyramid built elsewhere (rebuilt internally on mismatch)
+     */
+    void SetSharedPyramid(std::shared_ptr<const ElevationPyramid> pyramid) { m_pyramid = std::move(pyramid); }
+    std::shared_ptr<const ElevationPyramid> GetPyramid() const { return m_pyramid; }
+
 private:
     // Internal analysis methods
     std::vector<MountainChain> DetectMountainChains(const PlanetaryData& data);
@@ -84,6 +126,11 @@ private:
     float AnalyzeWaterErosionPatterns(const PlanetaryData& data);
     float AnalyzeWindErosionPatterns(const PlanetaryData& data);
     float AnalyzeGlacialErosionPatterns(const PlanetaryData& data);
+
+    // Pyramid-mode state
+    const ElevationPyramid* EnsurePyramid(const PlanetaryData& data);
+    bool m_usePyramid = true;
+    std::shared_ptr<const ElevationPyramid> m_pyramid;
 };
 
 /**
@@ -7,6 +7,11 @@ module;
 #include <functional>
 #include <mutex>
 #include <chrono>
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <thread>
 
 #include <utility>
 export module PipelineIntegration;
@@ -62,7 +67,15 @@ public:
     // Real-time monitoring
     void EnableRealTimeMonitoring(bool enable = true);
     bool IsRealTimeMonitoringEnabled() const;
-    
+
+    // Asynchronous capture: captures enqueue into a bounded ring serviced by
+    // a dedicated analysis thread, so statistics and transition analysis run
+    // concurrently with the next generation stage. The producer only blocks
+    // when the ring is full (backpressure).
+    void EnableAsyncCapture(bool enable = true);
+    bool IsAsyncCaptureEnabled() const { return m_asyncCaptureEnabled; }
+    void FlushPendingCaptures(); // Blocks until all queued captures finalized
+
     // Alert system integration
     using AlertCallback = std::function<void(const PipelineAnalysisResult&, const std::string&)>;
     void SetAlertCallback(AlertCallback callback);
@@ -104,7 +117,23 @@ private:
     // Snapshot storage
     std::vector<std::unique_ptr<ConcreteTerrainDataSnapshot>> m_snapshots;
     std::unordered_map<std::string, size_t> m_snapshotIndices; // stage name -> snapshot index
-    
+
+    // Copy-on-write block reuse: remembers the last captured block per
+    // modality so a buffer the pipeline did not mutate between stages is
+    // shared instead of re-copied (a hash pass is far cheaper than an
+    // allocate-and-copy of the same bytes)
+    struct CachedModalityBlock {
+        uint64_t fingerprint = 0;
+        size_t size = 0;
+        ConcreteTerrainDataSnapshot::SharedDataBlock block;
+    };
+    std::unordered_map<std::string, CachedModalityBlock> m_modalityBlockCache;
+
+    // Coordinates depend only on resolution; one immutable block per resolution
+    std::unordered_map<uint32_t, ConcreteTerrainDataSnapshot::SharedCoordinateBlock> m_coordinateBlockCache;
+
+    static uint64_t FingerprintModalityData(const std::vector<float>& data);
+
     // Configuration
     DifferentialAnalysisConfig m_config;
     std::string m_qualityLevel = "medium";
@@ -116,17 +145,40 @@ private:
     // Statistics
     PipelineStatistics m_statistics;
     
+    // Asynchronous capture pipeline. The critical-path cost of an async
+    // capture is just the copy-on-write block acquisition; statistics,
+    // adapter wiring, and transition analysis happen on the capture thread.
+    struct PendingCapture {
+        std::unique_ptr<ConcreteTerrainDataSnapshot> snapshot;
+        std::string stageName;
+    };
+    static constexpr size_t kCaptureRingCapacity = 8;
+    bool m_asyncCaptureEnabled = false;
+    std::atomic<bool> m_captureThreadRunning{false};
+    std::atomic<uint32_t> m_pendingCaptureCount{0};
+    std::thread m_captureThread;
+    std::deque<PendingCapture> m_captureRing;
+    mutable std::mutex m_captureRingMutex;
+    std::condition_variable m_captureRingNotEmpty;
+    std::condition_variable m_captureRingNotFull;
+    std::condition_variable m_captureRingDrained;
+
+    void SubmitCapture(std::unique_ptr<ConcreteTerrainDataSnapshot> snapshot, const std::string& stageName);
+    void FinalizeCapture(std::unique_ptr<ConcreteTerrainDataSnapshot> snapshot, const std::string& stageName);
+    void CaptureWorkerLoop();
+    static std::string PreviousStageFor(const std::string& stageName);
+
     // Internal methods
     std::unique_ptr<ConcreteTerrainDataSnapshot> CreateSnapshotFromPlanetaryData(
         const PlanetaryData& data,
         const std::string& stageName,
         uint32_t stageId
     );
-    
+
     std::unique_ptr<ConcreteTerrainDataSnapshot> CopySnapshot(const ConcreteTerrainDataSnapshot& source);
-    
+
     void EnsureDeviceSynchronization();
-    void SafeCopyModalityData(const PlanetaryModality& modality, const std::string& modalityType, ConcreteTerrainDataSnapshot* snapshot);
+    void SafeCopyModalityData(const PlanetaryModality& modality, const std::string& modalityType, ConcreteTerrainDataSnapshot* snapshot, bool deferStatistics = false);
     void SafeGenerateCoordinates(uint32_t resolution, ConcreteTerrainDataSnapshot* snapshot);
     void UpdateComponentSnapshots();
     void ProcessPipelineTransition(const std::string& fromStage, const std::string& toStage);
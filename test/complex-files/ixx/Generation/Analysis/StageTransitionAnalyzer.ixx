@@ -68,7 +68,14 @@ public:
     // Performance and configuration
     void SetParallelProcessing(bool enabled) { m_enableParallelProcessing = enabled; }
     bool IsParallelProcessingEnabled() const { return m_enableParallelProcessing; }
-    
+
+    // Tile-granular change detection: compare cached 64x64 block hashes of
+    // the snapshots first and report a zero-delta transition without running
+    // any metric when no block changed (common for stages that only touch a
+    // few percent of samples)
+    void SetBlockDeltaDetection(bool enabled) { m_enableBlockDeltaDetection = enabled; }
+    bool IsBlockDeltaDetectionEnabled() const { return m_enableBlockDeltaDetection; }
+
     void SetAnalysisTimeout(std::chrono::milliseconds timeout) { m_analysisTimeout = timeout; }
     std::chrono::milliseconds GetAnalysisTimeout() const { return m_analysisTimeout; }
     
@@ -92,6 +99,7 @@ private:
     
     // Configuration
     bool m_enableParallelProcessing = true;
+    bool m_enableBlockDeltaDetection = true;
     std::chrono::milliseconds m_analysisTimeout{30000}; // 30 second timeout
     
     // Statistics tracking
@@ -127,6 +135,15 @@ private:
     
     bool ValidateSnapshots(const TerrainDataSnapshot& beforeSnapshot,
                           const TerrainDataSnapshot& afterSnapshot) const;
+
+    // Block-hash comparison across all modalities (see SetBlockDeltaDetection)
+    struct BlockDeltaSummary {
+        bool comparable = false;   // Both snapshots expose block hashes
+        uint32_t totalBlocks = 0;
+        uint32_t changedBlocks = 0;
+    };
+    BlockDeltaSummary ComputeBlockDelta(const TerrainDataSnapshot& beforeSnapshot,
+                                        const TerrainDataSnapshot& afterSnapshot) const;
 };
 
 /**
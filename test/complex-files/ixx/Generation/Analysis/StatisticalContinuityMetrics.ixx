@@ -3,6 +3,9 @@ module;
 #include <vector>
 #include <string>
 #include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <utility>
 export module StatisticalContinuityMetrics;
@@ -48,7 +51,17 @@ public:
     bool SelfTest() const override;
     std::vector<std::string> GetDependencies() const override;
 
+    // Fused execution: statistics and continuity accumulate per sample inside
+    // the shared traversal; only the distribution histograms still need their
+    // own scan (binning requires the data range up front)
+    uint32_t GetRequiredSampleQuantities() const override;
+    std::unique_ptr<IFusedMetricAccumulator> CreateFusedAccumulator(
+        const TerrainDataSnapshot& beforeSnapshot,
+        const TerrainDataSnapshot& afterSnapshot) const override;
+
 private:
+    class FusedAccumulator;
+
     std::string m_metricName;
     std::string m_description;
     float m_warningThreshold = 0.7f;
@@ -77,13 +90,49 @@ private:
         float stdDev = 0.0f;
         float variance = 0.0f;
     };
-    
+
+    // Online (Welford) moments: accumulated in one streaming pass and
+    // mergeable across per-block partials, so per-snapshot statistics are
+    // computed once and cached instead of rescanned for every transition
+    struct StreamingMoments {
+        size_t count = 0;
+        double mean = 0.0;
+        double m2 = 0.0;
+
+        void Add(float value) {
+            ++count;
+            double delta = value - mean;
+            mean += delta / static_cast<double>(count);
+            m2 += delta * (value - mean);
+        }
+
+        // Chan et al. parallel merge of two partials
+        void Merge(const StreamingMoments& other) {
+            if (other.count == 0) return;
+            if (count == 0) { *this = other; return; }
+            size_t total = count + other.count;
+            double delta = other.mean - mean;
+            mean += delta * (static_cast<double>(other.count) / static_cast<double>(total));
+            m2 += other.m2 + delta * delta *
+                (static_cast<double>(count) * static_cast<double>(other.count) / static_cast<double>(total));
+            count = total;
+        }
+
+        BasicStats ToBasicStats() const;
+    };
+
+    // Per-snapshot moment summaries keyed by snapshot identity, so a snapshot
+    // reused across transitions (the "after" of one stage is the "before" of
+    // the next) is only scanned once
+    mutable std::unordered_map<std::string, StreamingMoments> m_momentsCache;
+    mutable std::mutex m_momentsCacheMutex;
+
     // Analysis methods
     StatisticalAnalysis AnalyzeStatisticalProperties(
-        const std::vector<float>& beforeData,
-        const std::vector<float>& afterData
+        const TerrainDataSnapshot& beforeSnapshot,
+        const TerrainDataSnapshot& afterSnapshot
     ) const;
-    
+
     ContinuityAnalysis AnalyzeContinuity(
         const std::vector<float>& beforeData,
         const std::vector<float>& afterData
@@ -94,14 +143,15 @@ private:
         const std::vector<float>& afterData
     ) const;
     
-    // High-performance parallel computation methods
-    std::pair<BasicStats, BasicStats> ComputeStatisticsParallel(
-        const std::vector<float>& beforeData,
-        const std::vector<float>& afterData
-    ) const;
-    
-    BasicStats ComputeStatistics(const std::vector<float>& data) const;
-    
+    // High-performance incremental statistics
+    // Cached per-snapshot summary; computed on first use via block partials
+    StreamingMoments GetSnapshotMoments(const TerrainDataSnapshot& snapshot) const;
+    void StoreSnapshotMoments(const TerrainDataSnapshot& snapshot, const StreamingMoments& moments) const;
+
+    StreamingMoments ComputeMomentsBlocked(const std::vector<float>& data) const;
+    static StreamingMoments ComputeMomentsRange(const float* data, size_t count);
+    static std::string MakeSnapshotCacheKey(const TerrainDataSnapshot& snapshot);
+
     ContinuityAnalysis ComputeContinuityParallel(
         const std::vector<float>& beforeData,
         const std::vector<float>& afterData,
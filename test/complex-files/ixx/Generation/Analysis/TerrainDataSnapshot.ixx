@@ -7,6 +7,7 @@ module;
 #include <chrono>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 
 #include <limits>
 #include <utility>
@@ -20,30 +21,46 @@ export namespace PlanetGen::Generation::Analysis {
 
 /**
  * @brief Concrete implementation of TerrainDataSnapshot
- * 
+ *
  * Efficiently stores and provides access to multi-modal terrain data
- * with cached statistical summaries for performance.
+ * with cached statistical summaries for performance. Data lives in
+ * immutable shared blocks, so snapshots of unchanged buffers share
+ * storage (copy-on-write) instead of deep-copying gigabytes per capture.
  */
 class ConcreteTerrainDataSnapshot : public TerrainDataSnapshot {
 public:
+    // Immutable, reference-counted data block shared between snapshots
+    using SharedDataBlock = std::shared_ptr<const std::vector<float>>;
+    using SharedCoordinateBlock = std::shared_ptr<const std::vector<std::pair<float, float>>>;
+
     ConcreteTerrainDataSnapshot(const SnapshotMetadata& metadata)
         : TerrainDataSnapshot(metadata) {}
-    
+
     ~ConcreteTerrainDataSnapshot() override = default;
-    
+
     // Data presence checks
-    bool HasElevationData() const override { return !m_elevationData.empty(); }
-    bool HasTemperatureData() const override { return !m_temperatureData.empty(); }
-    bool HasPrecipitationData() const override { return !m_precipitationData.empty(); }
-    bool HasVegetationData() const override { return !m_vegetationData.empty(); }
-    
+    bool HasElevationData() const override { return m_elevationData && !m_elevationData->empty(); }
+    bool HasTemperatureData() const override { return m_temperatureData && !m_temperatureData->empty(); }
+    bool HasPrecipitationData() const override { return m_precipitationData && !m_precipitationData->empty(); }
+    bool HasVegetationData() const override { return m_vegetationData && !m_vegetationData->empty(); }
+
     // Data access
-    const std::vector<float>& GetElevationData() const override { return m_elevationData; }
-    const std::vector<float>& GetTemperatureData() const override { return m_temperatureData; }
-    const std::vector<float>& GetPrecipitationData() const override { return m_precipitationData; }
-    const std::vector<float>& GetVegetationData() const override { return m_vegetationData; }
-    
-    const std::vector<std::pair<float, float>>& GetCoordinates() const override { return m_coordinates; }
+    const std::vector<float>& GetElevationData() const override { return Deref(m_elevationData); }
+    const std::vector<float>& GetTemperatureData() const override { return Deref(m_temperatureData); }
+    const std::vector<float>& GetPrecipitationData() const override { return Deref(m_precipitationData); }
+    const std::vector<float>& GetVegetationData() const override { return Deref(m_vegetationData); }
+
+    const std::vector<std::pair<float, float>>& GetCoordinates() const override {
+        static const std::vector<std::pair<float, float>> empty;
+        return m_coordinates ? *m_coordinates : empty;
+    }
+
+    // Block-level access for zero-copy snapshot construction
+    SharedDataBlock GetElevationDataShared() const { return m_elevationData; }
+    SharedDataBlock GetTemperatureDataShared() const { return m_temperatureData; }
+    SharedDataBlock GetPrecipitationDataShared() const { return m_precipitationData; }
+    SharedDataBlock GetVegetationDataShared() const { return m_vegetationData; }
+    SharedCoordinateBlock GetCoordinatesShared() const { return m_coordinates; }
     
     // Statistical summaries (cached for performance)
     float GetDataMin(const std::string& modalityType) const override {
@@ -73,41 +90,128 @@ public:
     
     const std::vector<float>& GetCustomData(const std::string& dataType) const override {
         auto it = m_customData.find(dataType);
-        if (it != m_customData.end()) {
-            return it->second;
+        if (it != m_customData.end() && it->second) {
+            return *it->second;
         }
         static std::vector<float> empty;
         return empty;
     }
-    
-    // Data modification (for snapshot creation)
-    void SetElevationData(const std::vector<float>& data) {
-        m_elevationData = data;
-        ComputeStatistics("elevation", data);
+
+    // Data modification (for snapshot creation); by-value so callers can move
+    void SetElevationData(std::vector<float> data) {
+        m_elevationData = std::make_shared<const std::vector<float>>(std::move(data));
+        ComputeStatistics("elevation", *m_elevationData);
     }
-    
-    void SetTemperatureData(const std::vector<float>& data) {
-        m_temperatureData = data;
-        ComputeStatistics("temperature", data);
+
+    void SetTemperatureData(std::vector<float> data) {
+        m_temperatureData = std::make_shared<const std::vector<float>>(std::move(data));
+        ComputeStatistics("temperature", *m_temperatureData);
     }
-    
-    void SetPrecipitationData(const std::vector<float>& data) {
-        m_precipitationData = data;
-        ComputeStatistics("precipitation", data);
+
+    void SetPrecipitationData(std::vector<float> data) {
+        m_precipitationData = std::make_shared<const std::vector<float>>(std::move(data));
+        ComputeStatistics("precipitation", *m_precipitationData);
     }
-    
-    void SetVegetationData(const std::vector<float>& data) {
-        m_vegetationData = data;
-        ComputeStatistics("vegetation", data);
+
+    void SetVegetationData(std::vector<float> data) {
+        m_vegetationData = std::make_shared<const std::vector<float>>(std::move(data));
+        ComputeStatistics("vegetation", *m_vegetationData);
     }
-    
-    void SetCoordinates(const std::vector<std::pair<float, float>>& coords) {
-        m_coordinates = coords;
+
+    void SetCoordinates(std::vector<std::pair<float, float>> coords) {
+        m_coordinates = std::make_shared<const std::vector<std::pair<float, float>>>(std::move(coords));
     }
-    
-    void SetCustomData(const std::string& dataType, const std::vector<float>& data) {
-        m_customData[dataType] = data;
-        ComputeStatistics(dataType, data);
+
+    void SetCustomData(const std::string& dataType, std::vector<float> data) {
+        auto block = std::make_shared<const std::vector<float>>(std::move(data));
+        ComputeStatistics(dataType, *block);
+        m_customData[dataType] = std::move(block);
+    }
+
+    // Zero-copy modification: adopt an existing immutable block. Statistics
+    // can be deferred (see EnsureStatistics) when capture happens on the
+    // generation critical path.
+    void SetElevationDataShared(SharedDataBlock data, bool computeStatistics = true) {
+        m_elevationData = std::move(data);
+        if (m_elevationData && computeStatistics) ComputeStatistics("elevation", *m_elevationData);
+    }
+
+    void SetTemperatureDataShared(SharedDataBlock data, bool computeStatistics = true) {
+        m_temperatureData = std::move(data);
+        if (m_temperatureData && computeStatistics) ComputeStatistics("temperature", *m_temperatureData);
+    }
+
+    void SetPrecipitationDataShared(SharedDataBlock data, bool computeStatistics = true) {
+        m_precipitationData = std::move(data);
+        if (m_precipitationData && computeStatistics) ComputeStatistics("precipitation", *m_precipitationData);
+    }
+
+    void SetVegetationDataShared(SharedDataBlock data, bool computeStatistics = true) {
+        m_vegetationData = std::move(data);
+        if (m_vegetationData && computeStatistics) ComputeStatistics("vegetation", *m_vegetationData);
+    }
+
+    // Compute any statistics skipped by a deferred capture; entries that are
+    // already cached (including block-shared ones) are not recomputed
+    void EnsureStatistics() const {
+        if (m_elevationData && m_statistics.find("elevation") == m_statistics.end()) {
+            ComputeStatistics("elevation", *m_elevationData);
+        }
+        if (m_temperatureData && m_statistics.find("temperature") == m_statistics.end()) {
+            ComputeStatistics("temperature", *m_temperatureData);
+        }
+        if (m_precipitationData && m_statistics.find("precipitation") == m_statistics.end()) {
+            ComputeStatistics("precipitation", *m_precipitationData);
+        }
+        if (m_vegetationData && m_statistics.find("vegetation") == m_statistics.end()) {
+            ComputeStatistics("vegetation", *m_vegetationData);
+        }
+    }
+
+    void SetCoordinatesShared(SharedCoordinateBlock coords) {
+        m_coordinates = std::move(coords);
+    }
+
+    // Tile-granular change detection: each hash covers one kHashBlockSamples
+    // run of a modality buffer (a 64x64 tile of a row-major grid), so a
+    // downstream comparison only needs to look at the blocks whose hashes
+    // differ. Hashes are cached against the source buffer identity - blocks
+    // shared between snapshots are hashed at most once and can never go stale.
+    static constexpr uint32_t kHashBlockSamples = 64u * 64u;
+
+    const std::vector<uint64_t>& GetBlockHashes(const std::string& modalityType) const {
+        static const std::vector<uint64_t> empty;
+        const auto& data = GetDataByType(modalityType);
+        if (data.empty()) return empty;
+
+        auto& cache = m_blockHashes[modalityType];
+        if (cache.source != static_cast<const void*>(data.data())) {
+            cache.source = data.data();
+            cache.hashes = ComputeBlockHashes(data);
+        }
+        return cache.hashes;
+    }
+
+    // Hash every present modality up front (e.g. right after capture) so a
+    // later transition analysis only compares cached hash tables
+    void EnsureBlockHashes() const {
+        GetBlockHashes("elevation");
+        GetBlockHashes("temperature");
+        GetBlockHashes("precipitation");
+        GetBlockHashes("vegetation");
+    }
+
+    // Share every block (and the already-computed statistics) of another
+    // snapshot - the zero-copy equivalent of a deep snapshot copy
+    void ShareDataFrom(const ConcreteTerrainDataSnapshot& other) {
+        m_elevationData = other.m_elevationData;
+        m_temperatureData = other.m_temperatureData;
+        m_precipitationData = other.m_precipitationData;
+        m_vegetationData = other.m_vegetationData;
+        m_coordinates = other.m_coordinates;
+        m_customData = other.m_customData;
+        m_statistics = other.m_statistics;
+        m_blockHashes = other.m_blockHashes;
     }
     
     // Advanced analysis methods
@@ -236,22 +340,56 @@ public:
     }
 
 private:
-    // Data storage
-    std::vector<float> m_elevationData;
-    std::vector<float> m_temperatureData;
-    std::vector<float> m_precipitationData;
-    std::vector<float> m_vegetationData;
-    std::vector<std::pair<float, float>> m_coordinates;
-    std::unordered_map<std::string, std::vector<float>> m_customData;
-    
+    // Data storage: immutable shared blocks (copy-on-write between snapshots)
+    SharedDataBlock m_elevationData;
+    SharedDataBlock m_temperatureData;
+    SharedDataBlock m_precipitationData;
+    SharedDataBlock m_vegetationData;
+    SharedCoordinateBlock m_coordinates;
+    std::unordered_map<std::string, SharedDataBlock> m_customData;
+
+    static const std::vector<float>& Deref(const SharedDataBlock& block) {
+        static const std::vector<float> empty;
+        return block ? *block : empty;
+    }
+
     // Cached statistics
     struct Statistics {
         float min, max, mean, stdDev, variance;
     };
     mutable std::unordered_map<std::string, Statistics> m_statistics;
-    
-    // Helper methods
-    void ComputeStatistics(const std::string& modalityType, const std::vector<float>& data) {
+
+    // Cached per-block content hashes, keyed by modality and validated
+    // against the source buffer pointer (see GetBlockHashes)
+    struct BlockHashCache {
+        const void* source = nullptr;
+        std::vector<uint64_t> hashes;
+    };
+    mutable std::unordered_map<std::string, BlockHashCache> m_blockHashes;
+
+    static std::vector<uint64_t> ComputeBlockHashes(const std::vector<float>& data) {
+        constexpr uint64_t kFnvOffset = 1469598103934665603ull;
+        constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+        std::vector<uint64_t> hashes((data.size() + kHashBlockSamples - 1) / kHashBlockSamples);
+        for (size_t block = 0; block < hashes.size(); ++block) {
+            size_t begin = block * kHashBlockSamples;
+            size_t end = std::min(begin + static_cast<size_t>(kHashBlockSamples), data.size());
+
+            // FNV-1a over the raw float bits, one sample word at a time
+            uint64_t hash = kFnvOffset;
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t bits;
+                std::memcpy(&bits, &data[i], sizeof(bits));
+                hash = (hash ^ bits) * kFnvPrime;
+            }
+            hashes[block] = hash;
+        }
+        return hashes;
+    }
+
+    // Helper methods (const: only touches the mutable statistics cache)
+    void ComputeStatistics(const std::string& modalityType, const std::vector<float>& data) const {
         if (data.empty()) return;
         
         Statistics stats{};
@@ -285,16 +423,16 @@ private:
     }
     
     const std::vector<float>& GetDataByType(const std::string& modalityType) const {
-        if (modalityType == "elevation") return m_elevationData;
-        if (modalityType == "temperature") return m_temperatureData;
-        if (modalityType == "precipitation") return m_precipitationData;
-        if (modalityType == "vegetation") return m_vegetationData;
-        
+        if (modalityType == "elevation") return Deref(m_elevationData);
+        if (modalityType == "temperature") return Deref(m_temperatureData);
+        if (modalityType == "precipitation") return Deref(m_precipitationData);
+        if (modalityType == "vegetation") return Deref(m_vegetationData);
+
         auto it = m_customData.find(modalityType);
         if (it != m_customData.end()) {
-            return it->second;
+            return Deref(it->second);
         }
-        
+
         static std::vector<float> empty;
         return empty;
     }
@@ -1,11 +1,14 @@
 module;
 
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <vector>
 #include <unordered_map>
 #include <variant>
 #include <iomanip>
+#include <memory>
+#include <cstddef>
 
 export module JsonConfigurationHelpers;
 
@@ -14,6 +17,93 @@ import PlanetaryConfigurationManager;
 
 export namespace PlanetGen::Generation::Configuration {
 
+/**
+ * In-situ JSON parser: parses a caller-owned buffer into string_view-based
+ * nodes backed by a per-document monotonic arena, so parsing makes no
+ * per-token heap allocations (the arena grows in large blocks and is freed
+ * wholesale with the document). Node string views point into the input
+ * buffer - the buffer must outlive the document.
+ */
+class JsonDocument {
+public:
+    enum class NodeType {
+        String,
+        Number,
+        Boolean,
+        Array,
+        Object,
+        Null
+    };
+
+    struct Node;
+
+    struct Member {
+        std::string_view key;
+        Node* value = nullptr;
+    };
+
+    struct Node {
+        NodeType type = NodeType::Null;
+        std::string_view stringValue;
+        double numberValue = 0.0;
+        bool boolValue = false;
+
+        Node* items = nullptr;     // Array elements, contiguous in the arena
+        size_t itemCount = 0;
+        Member* members = nullptr; // Object members, contiguous in the arena
+        size_t memberCount = 0;
+
+        // Preset objects are small; a linear scan beats a hash map here and
+        // allocates nothing
+        const Node* Find(std::string_view key) const {
+            for (size_t i = 0; i < memberCount; ++i) {
+                if (members[i].key == key) return members[i].value;
+            }
+            return nullptr;
+        }
+    };
+
+    JsonDocument() = default;
+
+    // Non-copyable (nodes point into the arena)
+    JsonDocument(const JsonDocument&) = delete;
+    JsonDocument& operator=(const JsonDocument&) = delete;
+
+    // Parse the given buffer; returns false on empty/unparseable input.
+    // Reusing a document for another Parse releases the previous DOM.
+    bool Parse(std::string_view json);
+
+    const Node* Root() const { return m_root; }
+
+private:
+    Node ParseValue(std::string_view json, size_t& pos);
+    Node ParseArray(std::string_view json, size_t& pos);
+    Node ParseObject(std::string_view json, size_t& pos);
+    Node ParseNumber(std::string_view json, size_t& pos);
+    Node ParseBoolean(std::string_view json, size_t& pos);
+    bool ParseStringToken(std::string_view json, size_t& pos, std::string_view& out);
+    static void SkipWhitespace(std::string_view json, size_t& pos);
+
+    // Monotonic bump allocator; blocks are freed with the document
+    void* ArenaAllocate(size_t size, size_t alignment);
+
+    template <typename T>
+    T* ArenaAllocateArray(size_t count) {
+        return static_cast<T*>(ArenaAllocate(count * sizeof(T), alignof(T)));
+    }
+
+    static constexpr size_t kArenaBlockSize = 64 * 1024;
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+    size_t m_blockOffset = 0;
+
+    Node* m_root = nullptr;
+
+    // Sibling collection scratch, reused across containers so allocation
+    // amortizes to a handful of grows per document
+    std::vector<Node> m_nodeScratch;
+    std::vector<Member> m_memberScratch;
+};
+
 // Simple JSON utility class for serialization/deserialization
 class JsonUtil {
 public:
@@ -74,6 +164,17 @@ public:
     static JsonValue SerializePreset(const PlanetaryPreset& preset);
     static PlanetaryPreset DeserializePreset(const JsonValue& value);
 
+    // In-situ counterparts operating on arena-backed JsonDocument nodes;
+    // these are what the file-loading path uses
+    static vec3 DeserializeVec3(const JsonDocument::Node& node);
+    static NoiseLayerConfig DeserializeNoiseLayer(const JsonDocument::Node& node);
+    static BiomeConfig DeserializeBiome(const JsonDocument::Node& node);
+    static AtmosphereConfig DeserializeAtmosphere(const JsonDocument::Node& node);
+    static OceanConfig DeserializeOcean(const JsonDocument::Node& node);
+    static RingSystemConfig DeserializeRingSystem(const JsonDocument::Node& node);
+    static PhysicsConfig DeserializePhysics(const JsonDocument::Node& node);
+    static PlanetaryPreset DeserializePreset(const JsonDocument::Node& node);
+
 private:
     // Internal parsing helpers
     static JsonValue ParseValue(const std::string& json, size_t& pos);
@@ -101,6 +202,7 @@ public:
     
 private:
     // Helper functions for validation
+    static bool ValidatePresetDocument(const JsonDocument::Node& root);
     static bool ValidateNoiseLayerJson(const JsonUtil::JsonValue& json);
     static bool ValidateBiomeJson(const JsonUtil::JsonValue& json);
     static bool ValidateAtmosphereJson(const JsonUtil::JsonValue& json);
@@ -238,6 +238,12 @@ public:
     // Utility methods
     void SetDefaultPreset(const std::string& name);
     std::string GetDefaultPreset() const { return m_defaultPreset; }
+
+    // Binary preset cache: parsed presets are mirrored to an on-disk binary
+    // cache keyed by the source file hash, so warm startups skip JSON
+    // parsing entirely. Enabled by default.
+    void SetBinaryCacheEnabled(bool enabled) { m_binaryCacheEnabled = enabled; }
+    bool IsBinaryCacheEnabled() const { return m_binaryCacheEnabled; }
     
     // Validation
     bool ValidatePreset(const PlanetaryPreset& preset) const;
@@ -251,11 +257,21 @@ private:
     std::string m_defaultPreset = "earth_like";
     std::unique_ptr<IConfigurationSource> m_configSource;
     
-    // Internal preset database
-    std::unordered_map<std::string, PlanetaryPreset> m_presets;
+    // Internal preset database (mutable: file presets materialize lazily
+    // from const accessors)
+    mutable std::unordered_map<std::string, PlanetaryPreset> m_presets;
     std::unordered_map<std::string, PlanetTypeConfig> m_types;
     std::unordered_map<std::string, PlanetInstanceConfig> m_instances;
-    
+
+    // Preset files discovered at Initialize but not yet parsed, keyed by
+    // preset name (file stem by convention). Parsing happens on first use,
+    // through the binary cache when it is valid.
+    mutable std::unordered_map<std::string, std::string> m_pendingPresetFiles;
+    bool m_binaryCacheEnabled = true;
+
+    bool MaterializePreset(const std::string& name) const;
+    void MaterializeAllPresets() const;
+
     // Helper methods
     void LoadBuiltInPresets();
     void MergeConfigurations(PlanetaryPreset& target, const PlanetaryPreset& source) const;
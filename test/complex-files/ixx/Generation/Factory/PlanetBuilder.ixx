@@ -1,6 +1,7 @@
 module;
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -22,6 +23,7 @@ public:
 
     // Builder configuration
     IPlanetBuilder& WithConfiguration(const Configuration::PlanetInstanceConfig& config) override;
+    IPlanetBuilder& WithConfiguration(Configuration::PlanetInstanceConfig&& config) override;
     IPlanetBuilder& WithDependencyContainer(IDependencyContainer* container) override;
     IPlanetBuilder& WithComponent(const std::string& type, std::shared_ptr<IPlanetComponent> component) override;
     
@@ -38,7 +40,8 @@ public:
     IPlanetBuilder& WithTextureResolution(uint32_t resolution) override;
     
     // Build methods
-    std::unique_ptr<PlanetInstance> Build() override;
+    std::unique_ptr<PlanetInstance> Build() & override;
+    std::unique_ptr<PlanetInstance> Build() && override;
     bool Validate() const override;
     std::vector<std::string> GetValidationErrors() const override;
     
@@ -63,7 +66,10 @@ private:
     uint32_t m_textureResolution = 1024;
     
     // Internal helper methods
-    void CreateComponentFromType(const std::string& componentName, const std::string& componentType);
+    std::unique_ptr<PlanetInstance> AssembleInstance(Configuration::PlanetInstanceConfig&& config,
+                                                     std::unordered_map<std::string, std::shared_ptr<IPlanetComponent>>&& components);
+    void CreateComponentFromType(const std::string& componentName, const std::string& componentType,
+                                 std::unordered_map<std::string, std::shared_ptr<IPlanetComponent>>& components);
     bool ValidateComponentConfiguration(const std::string& type) const;
     void ApplyConfigurationToComponents();
     std::shared_ptr<IPlanetComponent> CreateComponent(const std::string& type);
@@ -90,7 +96,11 @@ public:
     // Validation
     bool ValidatePreset(const std::string& presetName) const;
     std::vector<std::string> GetValidationErrors(const std::string& presetName) const;
-    
+
+    // Warm-start support: convert and cache the preset's instance config so
+    // repeat builds of the same preset skip the lookup/conversion work
+    void PrewarmPreset(const std::string& presetName);
+
 private:
     IDependencyContainer* m_container;
     IComponentFactory* m_componentFactory;
@@ -101,7 +111,12 @@ private:
     uint32_t m_textureResolution = 1024;
     bool m_physicsEnabled = false;
     
+    // Converted preset configs keyed by preset name
+    mutable std::unordered_map<std::string, Configuration::PlanetInstanceConfig> m_configCache;
+    mutable std::mutex m_configCacheMutex;
+
     // Helper methods
+    Configuration::PlanetInstanceConfig GetCachedInstanceConfig(const std::string& presetName) const;
     Configuration::PlanetInstanceConfig CreateInstanceConfig(const std::string& presetName) const;
     Configuration::PlanetInstanceConfig CreateInstanceConfigFromType(const std::string& typeName) const;
     void ApplyOverridesToConfig(Configuration::PlanetInstanceConfig& config) const;
@@ -166,12 +181,21 @@ public:
     
     // Template-based creation
     std::unique_ptr<PlanetInstance> CreateFromTemplate(const std::string& templateName);
-    
+
+    // Warm-start support: build and cache every template config up front so
+    // burst requests for the same planet type skip template construction
+    void PrewarmTemplates();
+
 private:
     IDependencyContainer* m_container;
     IComponentFactory* m_componentFactory;
-    
+
+    // Template configs keyed by template name
+    std::unordered_map<std::string, Configuration::PlanetInstanceConfig> m_templateCache;
+    std::mutex m_templateCacheMutex;
+
     // Template creation helpers
+    Configuration::PlanetInstanceConfig GetTemplateConfig(const std::string& templateName);
     Configuration::PlanetInstanceConfig CreateEarthLikeTemplate();
     Configuration::PlanetInstanceConfig CreateMarsLikeTemplate();
     Configuration::PlanetInstanceConfig CreateGasGiantTemplate();
@@ -1,7 +1,9 @@
 module;
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 export module PlanetFactoryIntegration;
@@ -25,10 +27,22 @@ public:
     ~PlanetFactoryIntegration();
     
     // Initialization
-    bool Initialize(void* vulkanRenderSystem, 
+    bool Initialize(void* vulkanRenderSystem,
                    std::shared_ptr<Configuration::PlanetaryConfigurationManager> configManager);
     void Shutdown();
-    
+
+    // Warm-start support. AcquireShared returns an already-initialized stack
+    // for the given render system / configuration manager pair when one
+    // exists, so bursts of requests with identical setup skip the cold
+    // initialization cost entirely.
+    static std::shared_ptr<PlanetFactoryIntegration> AcquireShared(void* vulkanRenderSystem,
+                                                                   std::shared_ptr<Configuration::PlanetaryConfigurationManager> configManager);
+    static void ClearSharedCache();
+
+    // Pre-build template and preset configs so the first real request does
+    // not pay for conversion either
+    void WarmUp();
+
     // Factory access
     PlanetTypeFactory* GetFactory() const { return m_factory.get(); }
     IDependencyContainer* GetContainer() const { return m_container.get(); }
@@ -55,9 +69,14 @@ private:
     std::unique_ptr<DefaultComponentFactory> m_componentFactory;
     std::unique_ptr<PlanetTypeFactory> m_factory;
     std::unique_ptr<BuilderFactory> m_builderFactory;
-    
+    std::unique_ptr<PresetPlanetBuilder> m_presetBuilder;
+
     std::shared_ptr<Configuration::PlanetaryConfigurationManager> m_configManager;
-    
+
+    // Initialized stacks keyed by render system / configuration manager pair
+    static std::unordered_map<std::string, std::shared_ptr<PlanetFactoryIntegration>> s_sharedStacks;
+    static std::mutex s_sharedStacksMutex;
+
     // Quality settings
     uint32_t m_defaultLODLevels = 4;
     uint32_t m_defaultTextureResolution = 1024;
@@ -67,6 +86,7 @@ private:
     // Helper methods
     void RegisterDefaultComponents();
     bool ValidateSetup() const;
+    PresetPlanetBuilder* GetPresetBuilder();
 };
 
 // Simplified interface for applications that just want to create planets
@@ -112,7 +132,7 @@ public:
     std::vector<std::string> GetAvailablePresets() const;
     
 private:
-    std::unique_ptr<PlanetFactoryIntegration> m_integration;
+    std::shared_ptr<PlanetFactoryIntegration> m_integration;
     std::unique_ptr<PlanetInstance> m_currentPlanet;
     
     // Quality settings
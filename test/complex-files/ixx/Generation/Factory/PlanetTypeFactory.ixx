@@ -105,8 +105,10 @@ class IPlanetBuilder {
 public:
     virtual ~IPlanetBuilder() = default;
     
-    // Builder configuration
+    // Builder configuration. The rvalue overload moves the configuration in
+    // - use it for large configs so the payload is never copied.
     virtual IPlanetBuilder& WithConfiguration(const Configuration::PlanetInstanceConfig& config) = 0;
+    virtual IPlanetBuilder& WithConfiguration(Configuration::PlanetInstanceConfig&& config) = 0;
     virtual IPlanetBuilder& WithDependencyContainer(IDependencyContainer* container) = 0;
     virtual IPlanetBuilder& WithComponent(const std::string& type, std::shared_ptr<IPlanetComponent> component) = 0;
     
@@ -122,8 +124,12 @@ public:
     virtual IPlanetBuilder& WithTessellationMode(const std::string& mode) = 0;
     virtual IPlanetBuilder& WithTextureResolution(uint32_t resolution) = 0;
     
-    // Build methods
-    virtual std::unique_ptr<PlanetInstance> Build() = 0;
+    // Build methods. The rvalue-qualified overload consumes the builder:
+    // configuration and components move straight into the instance with no
+    // intermediate copies. The lvalue overload copies the payload once and
+    // leaves the builder reusable.
+    virtual std::unique_ptr<PlanetInstance> Build() & = 0;
+    virtual std::unique_ptr<PlanetInstance> Build() && = 0;
     virtual bool Validate() const = 0;
     virtual std::vector<std::string> GetValidationErrors() const = 0;
     
@@ -135,6 +141,7 @@ public:
 class PlanetInstance {
 public:
     PlanetInstance(const Configuration::PlanetInstanceConfig& config, IDependencyContainer* container);
+    PlanetInstance(Configuration::PlanetInstanceConfig&& config, IDependencyContainer* container);
     ~PlanetInstance();
     
     // Lifecycle management
@@ -211,6 +218,12 @@ public:
     virtual void UnregisterComponentType(const std::string& type) = 0;
 };
 
+// Occupancy of a pooled component type, for capacity tuning
+struct ComponentPoolStats {
+    size_t capacity = 0;
+    size_t inUse = 0;
+};
+
 // Main planet type factory
 class PlanetTypeFactory {
 public:
@@ -260,6 +273,10 @@ public:
     
     FactoryStatistics GetStatistics() const;
     void ResetStatistics();
+
+    // Per-type component pool occupancy, forwarded from the component
+    // factory when it pools (empty for factories that do not)
+    std::unordered_map<std::string, ComponentPoolStats> GetComponentPoolStatistics() const;
     
 private:
     class Impl;
@@ -299,22 +316,28 @@ private:
     std::unique_ptr<Impl> m_impl;
 };
 
-// Default component factory implementation
+// Default component factory implementation. Default component types are
+// recycled through ObjectPool rather than reallocated: returned instances
+// go through a Reset() protocol (drop per-instance state) and their memory
+// is reused for the next CreateComponent of the same type.
 class DefaultComponentFactory : public IComponentFactory {
 public:
     DefaultComponentFactory();
     ~DefaultComponentFactory();
-    
+
     std::shared_ptr<IPlanetComponent> CreateComponent(const std::string& type) const override;
     std::vector<std::string> GetSupportedTypes() const override;
     bool SupportsType(const std::string& type) const override;
-    
-    void RegisterComponentType(const std::string& type, 
+
+    void RegisterComponentType(const std::string& type,
                              std::function<std::shared_ptr<IPlanetComponent>()> factory) override;
     void UnregisterComponentType(const std::string& type) override;
-    
+
     // Register default component types
     void RegisterDefaultComponents();
+
+    // Per-type pool occupancy for capacity tuning
+    std::unordered_map<std::string, ComponentPoolStats> GetPoolStatistics() const;
     
 private:
     class Impl;
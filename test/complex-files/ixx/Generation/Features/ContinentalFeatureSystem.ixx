@@ -64,6 +64,12 @@ public:
         if (params.maxElevation && currentElevation > *params.maxElevation) return false;
         return true;
     }
+
+    // Axis-aligned influence bounds. Returns false when the feature is
+    // global and must be evaluated everywhere.
+    virtual bool GetBounds(float& minX, float& minY, float& maxX, float& maxY) const {
+        return false;
+    }
 };
 
 // Factory for creating continental features
@@ -110,18 +116,54 @@ public:
     
     // Generate combined elevation at a point
     float GenerateElevation(float x, float y, float baseElevation) const;
-    
+
+    // Tile-batch API: resolve the overlapping feature layers once for a tile
+    // region, then evaluate every sample in the tile against that reduced set
+    struct TileFeatureSet {
+        std::vector<const FeatureLayer*> layers;
+    };
+    TileFeatureSet ResolveTile(float minX, float minY, float maxX, float maxY) const;
+    float GenerateElevation(float x, float y, float baseElevation, const TileFeatureSet& tile) const;
+
     // Clear all features
-    void Clear() { m_layers.clear(); }
-    
+    void Clear() {
+        m_layers.clear();
+        m_spatialRoot.reset();
+        m_globalLayers.clear();
+    }
+
     // Get number of features
     size_t GetFeatureCount() const { return m_layers.size(); }
-    
+
 private:
     std::vector<FeatureLayer> m_layers;
-    
+
+    // Spatial index: layers with finite bounds live in a quadtree so each
+    // sample only evaluates overlapping features. Unbounded layers are kept
+    // aside and evaluated everywhere.
+    struct QuadTreeNode {
+        float minX, minY, maxX, maxY;
+        std::vector<uint32_t> layerIndices;
+        std::unique_ptr<QuadTreeNode> children[4];
+    };
+
+    static constexpr int kMaxTreeDepth = 5;
+
+    void RebuildSpatialIndex();
+    void InsertLayer(QuadTreeNode& node, uint32_t layerIndex,
+                     float minX, float minY, float maxX, float maxY, int depth);
+    void QueryPoint(const QuadTreeNode& node, float x, float y, std::vector<uint32_t>& out) const;
+    void QueryRegion(const QuadTreeNode& node, float minX, float minY, float maxX, float maxY,
+                     std::vector<uint32_t>& out) const;
+
+    // Apply a single layer at a point
+    float ApplyLayer(const FeatureLayer& layer, float x, float y, float current) const;
+
     // Apply blending mode
     float ApplyBlendMode(float current, float value, BlendMode mode) const;
+
+    std::unique_ptr<QuadTreeNode> m_spatialRoot;
+    std::vector<uint32_t> m_globalLayers;
 };
 
 // Continental configuration presets
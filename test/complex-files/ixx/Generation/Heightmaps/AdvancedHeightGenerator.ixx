@@ -4,10 +4,12 @@ module;
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <unordered_map>
 #include <any>
 #include <optional>
+#include <variant>
 #include <future>
 
 export module AdvancedHeightGenerator;
@@ -318,6 +320,16 @@ struct HeightGenerationResult {
  */
 using ProgressCallback = std::function<void(float progress, const std::string& stage)>;
 
+/**
+ * @brief Consumer for streamed latitude bands
+ *
+ * Receives each generated band as [firstRow, firstRow + rowCount) of the
+ * full grid. The band buffer is owned by the generator and reused for the
+ * next band, so consumers must copy or flush before returning. Return false
+ * to cancel the remaining bands.
+ */
+using HeightBandConsumer = std::function<bool(uint32_t firstRow, uint32_t rowCount, const std::vector<float>& bandHeights)>;
+
 /**
  * @brief Advanced Height Generator - GPU-accelerated, fully parametric
  * 
@@ -381,6 +393,13 @@ public:
     
     /**
      * @brief Generate height data asynchronously
+     *
+     * Runs the internal stages as a JobSystem graph: base noise and every
+     * additional noise layer generate concurrently into separate buffers,
+     * then blending, feature application and post-processing run as a
+     * dependent JobChain. Latency approaches the critical path rather than
+     * the sum of the stages.
+     *
      * @param params Generation parameters
      * @param progressCallback Optional progress callback
      * @return Future containing height generation result
@@ -400,11 +419,126 @@ public:
         const HeightGenerationParameters& params,
         const std::vector<std::pair<float, float>>& coordinates
     );
-    
+
+    /**
+     * @brief Generate spherical height data in bounded-memory latitude bands
+     *
+     * Streaming variant of GenerateHeightSpherical for resolutions where the
+     * full float grid does not fit in memory (or several variations run
+     * concurrently). Bands of whole rows are generated one at a time and
+     * handed to the consumer; resident memory stays under maxResidentBytes
+     * regardless of total grid size. The returned result carries statistics
+     * and timing but deliberately leaves heightData empty.
+     *
+     * @param params Generation parameters
+     * @param coordinates Spherical coordinates (lat, lon pairs), row-major
+     * @param width Number of samples per latitude row
+     * @param consumer Callback receiving each band; return false to cancel
+     * @param maxResidentBytes Cap on band working-set size (default 256 MB)
+     * @return Result with statistics only; success=false on error or cancel
+     */
+    HeightGenerationResult GenerateHeightSphericalStreaming(
+        const HeightGenerationParameters& params,
+        const std::vector<std::pair<float, float>>& coordinates,
+        uint32_t width,
+        const HeightBandConsumer& consumer,
+        size_t maxResidentBytes = 256ull * 1024 * 1024
+    );
+
     // =============================================================================
-    // PARAMETER MANAGEMENT
+    // INCREMENTAL REGENERATION
     // =============================================================================
-    
+
+    /**
+     * @brief Pipeline stages tracked for incremental regeneration
+     */
+    enum class PipelineStage : uint32_t {
+        BaseNoise = 0,
+        NoiseLayers,
+        PlanetaryFeatures,
+        GeologicalProcesses,
+        ClimateEffects,
+        SphericalCorrection,
+        PostProcess,
+        Count
+    };
+
+    /**
+     * @brief Enable per-stage output caching for incremental regeneration
+     *
+     * When enabled, GenerateHeight keeps a copy of the height grid after each
+     * pipeline stage plus the raw per-layer noise buffers. UpdateParameter
+     * then marks only the earliest affected stage dirty, and
+     * RegenerateIncremental recomputes from that stage forward while reusing
+     * the cached upstream results. Costs roughly PipelineStage::Count extra
+     * grids of resident memory, so leave disabled for batch generation.
+     */
+    void SetIncrementalCacheEnabled(bool enabled);
+    bool IsIncrementalCacheEnabled() const { return m_incrementalCacheEnabled; }
+
+    /**
+     * @brief Regenerate using cached stage outputs where possible
+     *
+     * Recomputes only the stages marked dirty by UpdateParameter since the
+     * last generation. A one-parameter tweak to, say, climate settings reruns
+     * just the climate and downstream stages instead of the whole pipeline.
+     * Falls back to a full GenerateHeight when the cache is cold, the
+     * resolution changed, or a base-noise parameter was touched.
+     */
+    HeightGenerationResult RegenerateIncremental();
+
+    // =============================================================================
+    // TYPED PARAMETER STORE
+    // =============================================================================
+
+    /**
+     * @brief Flat identifiers for every tunable parameter
+     *
+     * The enum-indexed API below is the primary parameter interface: no
+     * string hashing, no std::any heap allocation, suitable for per-frame
+     * tuning UIs. The string/any methods further down remain as a thin
+     * compatibility shim over this store.
+     */
+    enum class HeightParamId : uint32_t {
+        BaseNoiseFrequency = 0,
+        BaseNoiseAmplitude,
+        BaseNoiseOctaves,
+        BaseNoisePersistence,
+        BaseNoiseLacunarity,
+        BaseNoiseSeed,
+        PlanetaryMountainAmplitude,
+        PlanetaryOceanDepth,
+        PerformanceResolution,
+        Count
+    };
+
+    using HeightParamValue = std::variant<float, int, uint32_t>;
+
+    /**
+     * @brief Set a parameter by id; rejects values of the wrong alternative
+     * @return true if the value type matched and the parameter was updated
+     */
+    bool SetParameter(HeightParamId id, HeightParamValue value);
+
+    /**
+     * @brief Read a parameter by id
+     */
+    HeightParamValue GetParameter(HeightParamId id) const;
+
+    /**
+     * @brief Interned display/lookup name for a parameter id
+     */
+    static const char* GetParameterName(HeightParamId id);
+
+    /**
+     * @brief Resolve a legacy string name to its id (used by the any-map shim)
+     */
+    static std::optional<HeightParamId> FindParameterId(std::string_view name);
+
+    // =============================================================================
+    // PARAMETER MANAGEMENT (string/any compatibility shim)
+    // =============================================================================
+
     /**
      * @brief Update a single parameter value
      * @param paramName Parameter name
@@ -523,11 +657,26 @@ private:
     
     // Statistics
     mutable GenerationStats m_stats;
-    
+
+    // Incremental regeneration state
+    struct StageCache {
+        bool valid = false;
+        uint32_t resolution = 0;
+        std::vector<std::vector<float>> stageOutputs;  // indexed by PipelineStage
+        std::vector<std::vector<float>> layerBuffers;  // raw noise, one per layer
+    };
+    bool m_incrementalCacheEnabled = false;
+    StageCache m_stageCache;
+    uint32_t m_earliestDirtyStage = static_cast<uint32_t>(PipelineStage::Count);
+    std::vector<size_t> m_dirtyLayers;
+
     // Internal methods
     bool InitializePresets();
     HeightGenerationResult GenerateHeightInternal(const HeightGenerationParameters& params);
+    // Job-graph variant of GenerateHeightInternal used by the async path
+    HeightGenerationResult GenerateHeightPipelined(const HeightGenerationParameters& params, ProgressCallback progressCallback);
     bool GenerateBaseNoise(const HeightGenerationParameters& params, std::vector<float>& heightData);
+    bool GenerateLayerNoise(const HeightGenerationParameters& params, const AdvancedNoiseLayer& layer, std::vector<float>& layerData);
     bool ApplyNoiseLayers(const HeightGenerationParameters& params, std::vector<float>& heightData);
     bool ApplyPlanetaryFeatures(const HeightGenerationParameters& params, std::vector<float>& heightData);
     bool ApplyGeologicalProcesses(const HeightGenerationParameters& params, std::vector<float>& heightData);
@@ -535,6 +684,15 @@ private:
     bool ApplySphericalCorrection(const HeightGenerationParameters& params, std::vector<float>& heightData);
     bool PostProcessHeight(const HeightGenerationParameters& params, std::vector<float>& heightData);
     
+    // Incremental regeneration helpers
+    void MarkStageDirty(PipelineStage stage);
+    void InvalidateStageCache();
+    void CacheStageOutput(PipelineStage stage, const std::vector<float>& heightData);
+    bool ApplyNoiseLayersCached(const HeightGenerationParameters& params, std::vector<float>& heightData);
+
+    // Layer conversion shared by the spherical generation paths
+    std::vector<PlanetGen::Rendering::Noise::SimpleNoiseLayer> BuildSimpleNoiseLayers(const HeightGenerationParameters& params) const;
+
     // Parameter conversion methods
     std::string HeightParamsToJSON(const HeightGenerationParameters& params) const;
     HeightGenerationParameters JSONToHeightParams(const std::string& jsonString) const;
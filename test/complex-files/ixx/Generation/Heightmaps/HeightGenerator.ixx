@@ -1,5 +1,6 @@
 module;
 
+#include <functional>
 #include <vector>
 #include <memory>
 #include <utility>
@@ -9,6 +10,7 @@ export module HeightGenerator;
 import NoiseTypes;
 import IGPUNoiseAccelerator;
 import GLMModule;
+import ThreadPool;
 
 export namespace PlanetGen::Generation {
 
@@ -24,6 +26,11 @@ public:
     HeightGenerator(std::shared_ptr<IGPUNoiseAccelerator> noiseAccelerator);
     ~HeightGenerator() = default;
 
+    // Optional worker pool; when set, coordinate preparation and the
+    // post-processing sweep are partitioned by row range across its workers.
+    // The pool is borrowed, not owned - it must outlive this generator.
+    void SetThreadPool(Core::Threading::ThreadPool* threadPool) { m_threadPool = threadPool; }
+
     // High-level terrain generation
     bool GenerateHeightmap(
         uint32_t width, 
@@ -53,11 +60,16 @@ public:
 
 private:
     std::shared_ptr<IGPUNoiseAccelerator> m_noiseAccelerator;
-    
+    Core::Threading::ThreadPool* m_threadPool = nullptr;
+
     // Helper methods
     bool ValidateParameters(uint32_t width, uint32_t height, const std::vector<PlanetGen::Rendering::Noise::SimpleNoiseLayer>& layers);
-    void ApplySeaLevel(std::vector<float>& heights, float seaLevel);
-    void ApplyElevationScale(std::vector<float>& heights, float scale);
+    // Single fused sweep replacing the separate sea-level and elevation-scale
+    // passes; runs on the thread pool when one has been attached.
+    void ApplySeaLevelAndScale(std::vector<float>& heights, float seaLevel, float scale);
+    // Runs body(begin, end) over [0, count) - serially without a pool, in
+    // per-worker ranges with one.
+    void ParallelFor(size_t count, const std::function<void(size_t, size_t)>& body);
 };
 
 } // namespace PlanetGen::Generation
\ No newline at end of file
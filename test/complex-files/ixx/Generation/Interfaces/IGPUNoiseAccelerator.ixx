@@ -71,6 +71,17 @@ public:
     virtual bool EndNoiseGeneration(
         const AsyncNoiseHandle& handle,
         float* outData) = 0;
+
+    // Arbitrary-position batch generation: uploads the whole position array
+    // once and evaluates it in a single compute dispatch, paired with
+    // EndNoiseGeneration for the readback. Backends that only support grid
+    // dispatch keep the default and callers fall back to per-sample paths.
+    virtual std::optional<AsyncNoiseHandle> BeginNoiseGenerationAtPositions(
+        const Rendering::Noise::GPUNoiseParameters& /*params*/,
+        const glm::vec3* /*positions*/,
+        uint32_t /*count*/) {
+        return std::nullopt;
+    }
     
     // Planetary-specific generation
     virtual bool GeneratePlanetaryElevation(
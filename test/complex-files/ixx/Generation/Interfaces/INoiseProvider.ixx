@@ -1,6 +1,7 @@
 module;
 
 #include <glm/glm.hpp>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -20,6 +21,14 @@ public:
     
     // Batch operations
     virtual std::vector<float> SampleBatch(const std::vector<glm::vec3>& positions) const = 0;
+
+    // Pointer-based batch sampling so callers can keep their position
+    // scratch in arena-backed storage. The default shim copies into a
+    // vector; implementations should override it alongside the vector
+    // overload to avoid that copy.
+    virtual std::vector<float> SampleBatch(const glm::vec3* positions, size_t count) const {
+        return SampleBatch(std::vector<glm::vec3>(positions, positions + count));
+    }
     
     // Configuration
     virtual void SetSeed(int seed) = 0;
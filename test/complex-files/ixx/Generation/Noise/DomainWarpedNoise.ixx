@@ -1,5 +1,6 @@
 module;
 
+#include <cstddef>
 #include <memory>
 
 export module DomainWarpedNoise;
@@ -74,22 +75,41 @@ public:
     bool IsMultiLevelWarpingEnabled() const { return m_enableMultiLevel; }
     int GetWarpLevels() const { return m_warpLevels; }
 
+    // Fused evaluation: all three warp channels are produced in a single
+    // octave walk that shares the frequency/amplitude ramp (and keeps the
+    // permutation/gradient tables hot) instead of three independent
+    // FractalNoise traversals. Rotation, turbulence and multi-level warping
+    // fall back to the general path.
+    void SetFusedEvaluation(bool enable) { m_fusedEvaluation = enable; }
+    bool IsFusedEvaluationEnabled() const { return m_fusedEvaluation; }
+
+    // Batch variant matching the NoiseProvider SIMD API: the warp channels
+    // run through the vectorized GetNoiseBatch kernels, the warped base
+    // lookup runs per sample.
+    void GetNoiseBatch(const float* xs, const float* ys, const float* zs,
+                       float* out, size_t count);
+
 private:
     // Core warping computations
     vec3 ComputeBasicWarp(float x, float y, float z) const;
     vec3 ComputeRotationalWarp(float x, float y, float z) const;
     vec3 ComputeTurbulenceWarp(float x, float y, float z) const;
     vec3 ApplyMultiLevelWarping(const vec3& pos, int level) const;
-    
+    float GetNoiseFused(float x, float y, float z);
+    bool CanUseFusedPath() const;
+
     // Parameters
     int m_seed;
     float m_frequency;
     int m_octaves;
     WarpParameters m_warpParams;
-    
+
     // Multi-level warping
     bool m_enableMultiLevel;
     int m_warpLevels;
+
+    // Fused single-pass evaluation
+    bool m_fusedEvaluation;
     
     // Base noise function to warp
     std::unique_ptr<INoiseGenerator> m_baseNoise;
@@ -100,6 +120,7 @@ private:
     std::unique_ptr<SimpleNoise::NoiseProvider> m_warpNoiseZ;
     std::unique_ptr<SimpleNoise::NoiseProvider> m_rotationNoise;
     std::unique_ptr<SimpleNoise::NoiseProvider> m_turbulenceNoise;
+    std::unique_ptr<SimpleNoise::NoiseProvider> m_fusedWarpOctave;  // single octave
 };
 
 /**
@@ -0,0 +1,165 @@
+module;
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+export module FractalCombinators;
+
+import GLMModule;
+import NoiseInterface;
+import NoiseTypes;
+import SimpleNoise;
+
+export namespace PlanetGen::Rendering::Noise {
+
+/**
+ * @brief Compile-time fractal composition kernels
+ *
+ * FractalNoise<Kernel, Octaves> bakes the octave count and the per-octave
+ * transform into the type, so the inner loop has a constant trip count and
+ * no virtual dispatch per octave per sample. The factory selects these
+ * instantiations for the common fixed configurations; arbitrary runtime
+ * configurations keep the virtual-interface generators.
+ */
+
+// Plain fractal Brownian motion: accumulate and normalize.
+struct SimplexKernel {
+  struct State {};
+  static float Octave(float signal, State&, const SimplexKernel&) {
+    return signal;
+  }
+  static float Finalize(float result, float maxValue, const SimplexKernel&) {
+    return result / maxValue;
+  }
+  static constexpr NoiseType kType = NoiseType::SimpleNoise;
+};
+
+// Billow: abs over the normalized fractal, remapped to [-1, 1].
+struct BillowKernel {
+  float billowScale = 1.0f;
+  struct State {};
+  static float Octave(float signal, State&, const BillowKernel&) {
+    return signal;
+  }
+  static float Finalize(float result, float maxValue, const BillowKernel& k) {
+    return std::abs(result / maxValue) * k.billowScale * 2.0f - 1.0f;
+  }
+  static constexpr NoiseType kType = NoiseType::BillowNoise;
+};
+
+// Ridged multifractal: inverted absolute signal, sharpened and weighted by
+// the previous octave. Mirrors RidgedNoise::ComputeRidgedNoise.
+struct RidgedKernel {
+  float ridgeOffset = 1.0f;
+  float ridgeGain = 2.0f;
+  float ridgeThreshold = 0.0f;
+  struct State {
+    float weight = 1.0f;
+  };
+  static float Octave(float signal, State& state, const RidgedKernel& k) {
+    signal = k.ridgeOffset - std::abs(signal);
+    if (signal < k.ridgeThreshold) {
+      signal = k.ridgeThreshold;
+    }
+    signal *= signal;
+    signal *= state.weight;
+    state.weight = std::clamp(signal * k.ridgeGain, 0.0f, 1.0f);
+    return signal;
+  }
+  static float Finalize(float result, float /*maxValue*/, const RidgedKernel&) {
+    return std::clamp(result, -1.0f, 1.0f);
+  }
+  static constexpr NoiseType kType = NoiseType::RidgedNoise;
+};
+
+template <typename Kernel, int Octaves>
+class FractalNoise : public INoiseGenerator {
+  static_assert(Octaves >= 1, "Octave count must be at least 1");
+
+ public:
+  FractalNoise(int seed, float frequency, float persistence = 0.5f,
+               float lacunarity = 2.0f)
+      : m_seed(seed),
+        m_frequency(frequency),
+        m_persistence(persistence),
+        m_lacunarity(lacunarity),
+        m_base(persistence, lacunarity, 1) {}
+
+  float GetNoise(float x, float y, float z) override {
+    x *= m_frequency;
+    y *= m_frequency;
+    z *= m_frequency;
+
+    float result = 0.0f;
+    float frequency = 1.0f;
+    float amplitude = 1.0f;
+    float maxValue = 0.0f;
+    typename Kernel::State state{};
+
+    // Constant trip count: fully unrollable, and m_base is a concrete
+    // member so the per-octave noise call devirtualizes and inlines.
+    for (int i = 0; i < Octaves; i++) {
+      float signal =
+          m_base.GetNoise(x * frequency, y * frequency, z * frequency);
+      result += Kernel::Octave(signal, state, m_kernel) * amplitude;
+      maxValue += amplitude;
+      amplitude *= m_persistence;
+      frequency *= m_lacunarity;
+    }
+
+    return Kernel::Finalize(result, maxValue, m_kernel);
+  }
+
+  float GetNoise(const vec3& pos) override {
+    return GetNoise(pos.x, pos.y, pos.z);
+  }
+
+  void SetSeed(int seed) override { m_seed = seed; }
+  void SetFrequency(float freq) override {
+    m_frequency = std::max(0.001f, freq);
+  }
+  // The octave count is part of the type; the factory only hands these out
+  // for configurations fixed at creation, so runtime changes are ignored.
+  void SetOctaves(int /*octaves*/) override {}
+  NoiseType GetNoiseType() const override { return Kernel::kType; }
+
+  Kernel& GetKernel() { return m_kernel; }
+
+ private:
+  int m_seed;
+  float m_frequency;
+  float m_persistence;
+  float m_lacunarity;
+  Kernel m_kernel{};
+  SimpleNoise::NoiseProvider m_base;  // single octave, called concretely
+};
+
+// Dispatch over the baked octave counts; nullptr tells the caller to fall
+// back to the virtual-interface generator.
+template <typename Kernel>
+std::unique_ptr<INoiseGenerator> MakeFixedOctaveFractal(int octaves, int seed,
+                                                        float frequency) {
+  switch (octaves) {
+    case 1:
+      return std::make_unique<FractalNoise<Kernel, 1>>(seed, frequency);
+    case 2:
+      return std::make_unique<FractalNoise<Kernel, 2>>(seed, frequency);
+    case 3:
+      return std::make_unique<FractalNoise<Kernel, 3>>(seed, frequency);
+    case 4:
+      return std::make_unique<FractalNoise<Kernel, 4>>(seed, frequency);
+    case 5:
+      return std::make_unique<FractalNoise<Kernel, 5>>(seed, frequency);
+    case 6:
+      return std::make_unique<FractalNoise<Kernel, 6>>(seed, frequency);
+    case 7:
+      return std::make_unique<FractalNoise<Kernel, 7>>(seed, frequency);
+    case 8:
+      return std::make_unique<FractalNoise<Kernel, 8>>(seed, frequency);
+    default:
+      return nullptr;
+  }
+}
+
+}  // namespace PlanetGen::Rendering::Noise
@@ -33,6 +33,7 @@ public:
     float Sample(const glm::vec3& position) const override { return const_cast<GPUNoiseGenerator*>(this)->GetNoise(position); }
     float Sample2D(const glm::vec2& position) const override { return const_cast<GPUNoiseGenerator*>(this)->GetNoise(glm::vec3(position, 0.0f)); }
     std::vector<float> SampleBatch(const std::vector<glm::vec3>& positions) const override;
+    std::vector<float> SampleBatch(const glm::vec3* positions, size_t count) const override;
     
     // Parameter control (already implemented for INoiseGenerator)
     void SetAmplitude(float amplitude) override { m_params.amplitude = amplitude; }
@@ -20,6 +20,19 @@ import GLMModule;
 
 export namespace PlanetGen::Rendering::Noise {
 
+/**
+ * @brief Memory layout of a tiled noise map
+ *
+ * RowMajor matches the flat GenerateNoiseMap output. TileLinear stores each
+ * tile contiguously (row-major inside the tile, tiles in row-major order);
+ * Morton orders the tiles along a Z-order curve for better 2D locality.
+ */
+enum class NoiseMapLayout {
+  RowMajor,
+  TileLinear,
+  Morton,
+};
+
 /**
  * @brief Interface for bulk noise generation operations
  */
@@ -74,6 +87,17 @@ class GPUNoiseWrapper : public INoiseGenerator, public IBulkNoiseGenerator {
   std::vector<float> GenerateNoiseMap(float startX, float startZ, int width,
                                       int depth, float stepSize) const override;
 
+  // Cache-blocked generation: the map is produced in tileSize x tileSize
+  // blocks so each block stays cache-resident instead of streaming the whole
+  // map through the LLC. For TileLinear/Morton layouts the result is padded
+  // to whole tiles (ceil(width/tileSize) * ceil(depth/tileSize) tiles of
+  // tileSize^2 floats each) so consumers can stream tiles without touching
+  // cold memory; RowMajor scatters the tiles back into a flat width*depth map.
+  std::vector<float> GenerateNoiseMapTiled(
+      float startX, float startZ, int width, int depth, float stepSize,
+      int tileSize = 64,
+      NoiseMapLayout layout = NoiseMapLayout::TileLinear) const;
+
   // Advanced parameter control
   void SetPersistence(float persistence);
   void SetLacunarity(float lacunarity);
@@ -23,6 +23,14 @@ class NoiseFactory {
                                                  float frequency = 0.01f,
                                                  int octaves = 1);
 
+  // Compile-time devirtualized fractal generators for the common fixed
+  // configurations (Simplex/Ridged/Billow, 1-8 octaves). Returns nullptr
+  // when the configuration has no baked instantiation; callers fall back
+  // to the virtual-interface generators.
+  static std::unique_ptr<INoiseGenerator> CreateFixedOctave(
+      NoiseType type, int seed = 1337, float frequency = 0.01f,
+      int octaves = 1);
+
   // Basic noise generators
   static std::unique_ptr<INoiseGenerator> CreateSimpleNoise(
       int seed = 1337, float frequency = 0.01f, int octaves = 1);
@@ -0,0 +1,44 @@
+module;
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+export module NoiseTableRegistry;
+
+export namespace SimpleNoise {
+
+// Seed for the canonical (unshuffled) Perlin permutation table.
+inline constexpr int kCanonicalTableSeed = 0;
+
+/**
+ * @brief Immutable permutation table block shared across noise instances
+ *
+ * Holds the seed-shuffled permutation plus the derived mirrors the scalar
+ * and SIMD kernels need (32-bit gather mirror, folded %12 gradient
+ * selection). Instances never mutate a block after construction; new seeds
+ * get new blocks (copy-on-write via shared_ptr).
+ */
+struct NoiseTables {
+  std::array<uint8_t, 256> perm;
+  std::array<int32_t, 256> perm32;     // 32-bit mirror for gather kernels
+  std::array<int32_t, 256> permMod12;  // folded gradient index selection
+};
+
+/**
+ * @brief Process-wide, seed-keyed registry of shared noise tables
+ *
+ * Batch runs that construct many noise instances per variation (e.g.
+ * TerrainOrchestrator::GeneratePlanetVariations) share one table block per
+ * seed instead of duplicating and reinitializing tables per instance. The
+ * registry holds weak references, so blocks are freed once the last
+ * generator using a seed goes away; the canonical table is kept alive for
+ * the process lifetime.
+ */
+class NoiseTableRegistry {
+ public:
+  // Returns the immutable table block for a seed, building it on first use.
+  static std::shared_ptr<const NoiseTables> Get(int seed);
+};
+
+}  // namespace SimpleNoise
@@ -0,0 +1,95 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+export module NoiseTileCache;
+
+import NoiseTypes;
+
+export namespace PlanetGen::Rendering::Noise {
+
+/**
+ * @brief Identity of a generated noise tile
+ *
+ * Two requests with the same key are guaranteed to produce identical data,
+ * so the generation parameters (type, seed, frequency, octaves, fractal
+ * shape) and the exact world-space tile window all participate in equality.
+ */
+struct NoiseTileKey {
+  NoiseType type = NoiseType::SimpleNoise;
+  int seed = 0;
+  float frequency = 0.0f;
+  int octaves = 0;
+  float persistence = 0.0f;
+  float lacunarity = 0.0f;
+  float amplitude = 0.0f;
+  float startX = 0.0f;
+  float startZ = 0.0f;
+  float stepSize = 0.0f;
+  int width = 0;
+  int depth = 0;
+
+  bool operator==(const NoiseTileKey& other) const = default;
+};
+
+struct NoiseTileKeyHash {
+  size_t operator()(const NoiseTileKey& key) const;
+};
+
+/**
+ * @brief Process-wide LRU cache of generated noise tiles
+ *
+ * Feedback-loop runs regenerate terrain with only a few parameters mutated
+ * per candidate; base noise layers whose parameters did not change hash to
+ * the same key and are served from here instead of being regenerated. Tiles
+ * are immutable (shared_ptr<const vector>) so readers never copy on hit.
+ * Thread-safe; eviction is by total byte footprint, least recently used
+ * tile first.
+ */
+class NoiseTileCache {
+ public:
+  static NoiseTileCache& Instance();
+
+  // Returns the cached tile or nullptr on miss (miss is counted).
+  std::shared_ptr<const std::vector<float>> Get(const NoiseTileKey& key);
+
+  // Inserts or refreshes a tile; evicts LRU tiles beyond the byte budget.
+  void Put(const NoiseTileKey& key,
+           std::shared_ptr<const std::vector<float>> tile);
+
+  void SetCapacityBytes(size_t bytes);
+  void Clear();
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t bytes = 0;
+  };
+  Stats GetStats() const;
+
+ private:
+  NoiseTileCache() = default;
+
+  struct Entry {
+    NoiseTileKey key;
+    std::shared_ptr<const std::vector<float>> data;
+  };
+
+  mutable std::mutex m_mutex;
+  std::list<Entry> m_lru;  // front = most recently used
+  std::unordered_map<NoiseTileKey, std::list<Entry>::iterator,
+                     NoiseTileKeyHash>
+      m_index;
+  size_t m_capacityBytes = 256ull * 1024 * 1024;
+  size_t m_bytes = 0;
+  Stats m_stats;
+};
+
+}  // namespace PlanetGen::Rendering::Noise
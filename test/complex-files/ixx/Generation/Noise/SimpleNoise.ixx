@@ -4,6 +4,7 @@ module;
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <memory>
 #include <random>
 #include <stdexcept>
@@ -13,6 +14,7 @@ export module SimpleNoise;
 
 // Module imports (after module declaration)
 import GLMModule;
+import NoiseTableRegistry;
 
 export namespace SimpleNoise {
 
@@ -22,6 +24,16 @@ class INoiseGenerator {
   virtual ~INoiseGenerator() = default;
   virtual float GetNoise(float x, float y, float z) = 0;
   virtual float GetNoise(const vec3& pos) = 0;
+
+  // Batch evaluation of many points at once. The default implementation
+  // falls back to per-point GetNoise; generators with vectorized kernels
+  // override this.
+  virtual void GetNoiseBatch(const float* xs, const float* ys, const float* zs,
+                             float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = GetNoise(xs[i], ys[i], zs[i]);
+    }
+  }
 };
 
 // Simple noise provider that handles both base and fractal noise
@@ -34,15 +46,26 @@ class NoiseProvider : public INoiseGenerator {
   float GetNoise(float x, float y, float z) override;
   float GetNoise(const vec3& pos) override;
 
+  // Vectorized batch evaluation (AVX2/NEON, 8/4 lanes per iteration) with a
+  // scalar tail. Matches the per-point path bit-for-bit on the scalar tail
+  // and to within interpolation rounding on the SIMD lanes.
+  void GetNoiseBatch(const float* xs, const float* ys, const float* zs,
+                     float* out, size_t count) override;
+
   // Settings
   void SetPersistence(float persistence);
   void SetLacunarity(float lacunarity);
   void SetOctaves(int octaves);
 
+  // Swaps in the shared immutable table block for this seed from the
+  // process-wide registry; instances with the same seed share one block.
+  void SetSeed(int seed);
+
  private:
   float m_persistence;
   float m_lacunarity;
   int m_octaves;
+  std::shared_ptr<const NoiseTables> m_tables;
 
   // Internal noise generation
   float SimplexNoise(float x, float y, float z);
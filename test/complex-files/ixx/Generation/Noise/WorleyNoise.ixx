@@ -1,6 +1,7 @@
 module;
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 
 #include <memory>
@@ -29,10 +30,20 @@ public:
   void SetOctaves(int octaves) override;
   NoiseType GetNoiseType() const override { return NoiseType::Worley; }
 
+  // Row-sweep batch evaluation along +x: out[i] = noise at
+  // (startX + i * stepX, y, z). Carries the 27-cell feature-point window
+  // across x-adjacent samples so only the newly entered cell column is
+  // (re)hashed, instead of all 27 neighbors per sample.
+  void GetNoiseRow(float startX, float y, float z, float stepX, float *out,
+                   size_t count);
+
 private:
   // Core Worley noise implementation
   float WorleyNoise3D(float x, float y, float z) const;
   vec3 GenerateFeaturePoint(int cellX, int cellY, int cellZ) const;
+  vec3 CachedFeaturePoint(int cellX, int cellY, int cellZ) const;
+  void RowSweep(float x0, float y, float z, float dx, float *out, size_t count,
+                float amplitude, bool accumulate) const;
   uint32_t HashCell(int x, int y, int z) const;
 
   // Parameters
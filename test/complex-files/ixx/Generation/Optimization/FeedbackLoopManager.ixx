@@ -1,6 +1,9 @@
 module;
 
+#include <cmath>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -18,6 +21,26 @@ import Core.Logging.Logger;
 
 export namespace PlanetGen::Generation::Optimization {
 
+/**
+ * @brief Hash of a quantized parameter vector for fitness memoization
+ *
+ * Parameters are snapped to quantizationStep before hashing so vectors that
+ * elitism or crossover reproduce near-identically map to the same key.
+ */
+inline uint64_t QuantizedParameterHash(const std::vector<float>& values,
+                                       float quantizationStep = 1e-3f) {
+    uint64_t h = 1469598103934665603ull;  // FNV-1a offset basis
+    for (float v : values) {
+        uint64_t bits = static_cast<uint64_t>(
+            static_cast<int64_t>(std::llround(v / quantizationStep)));
+        for (int shift = 0; shift < 64; shift += 8) {
+            h ^= (bits >> shift) & 0xFFu;
+            h *= 1099511628211ull;  // FNV prime
+        }
+    }
+    return h;
+}
+
 /**
  * @brief Configuration for feedback loop runs
  */
@@ -51,6 +74,8 @@ struct FeedbackLoopConfig {
     
     // Evaluation settings
     int evaluationResolution = 512;     // Resolution for terrain evaluation
+    bool enableFitnessCache = true;     // Memoize fitness by quantized parameter hash
+    size_t maxFitnessCacheEntries = 4096; // Cache resets when it grows past this
     
     // Analysis and tracking
     bool trackParameterEvolution = true;
@@ -77,6 +102,12 @@ struct FeedbackLoopResult {
         float averageFitness = 0.0f;
         float diversity = 0.0f;
         std::chrono::milliseconds evaluationTime{0};
+
+        // Fitness cache effectiveness: every hit skipped a full terrain
+        // generation plus geological evaluation
+        size_t cacheHits = 0;
+        size_t cacheMisses = 0;
+        float cacheHitRate = 0.0f;
     };
     std::vector<GenerationStats> generationHistory;
     
@@ -153,6 +184,61 @@ public:
     void SetProgressCallback(ProgressCallback callback) {
         m_progressCallback = callback;
     }
+
+    /**
+     * @brief Set the fitness cache key function
+     *
+     * The key should be a hash of the candidate's quantized parameter
+     * vector (see QuantizedParameterHash). Once set, evaluations consult
+     * the cache before dispatching generation + evaluation, so candidates
+     * that elitism or crossover reproduce from earlier generations are
+     * scored for free. Without a key function the cache is inert.
+     */
+    void SetFitnessKeyFunction(std::function<uint64_t(const TData&)> keyFunction) {
+        m_fitnessKeyFunction = keyFunction;
+    }
+
+    /**
+     * @brief Evaluate one candidate through the fitness cache
+     *
+     * Thread-safe around the cache itself; the evaluator runs outside the
+     * lock so concurrent misses evaluate in parallel.
+     */
+    template<typename TEvaluator>
+    float EvaluateWithCache(const TData& candidate, TEvaluator&& evaluator) {
+        if (!m_fitnessKeyFunction || !m_cacheEnabled) {
+            return evaluator(candidate);
+        }
+
+        uint64_t key = m_fitnessKeyFunction(candidate);
+        {
+            std::lock_guard<std::mutex> lock(m_fitnessCacheMutex);
+            auto it = m_fitnessCache.find(key);
+            if (it != m_fitnessCache.end()) {
+                m_cacheHits.fetch_add(1, std::memory_order_relaxed);
+                return it->second;
+            }
+        }
+
+        float fitness = evaluator(candidate);
+        m_cacheMisses.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(m_fitnessCacheMutex);
+        if (m_fitnessCache.size() >= m_maxCacheEntries) {
+            LOG_DEBUG("FeedbackLoop", "Fitness cache full ({} entries), resetting", m_fitnessCache.size());
+            m_fitnessCache.clear();
+        }
+        m_fitnessCache.emplace(key, fitness);
+        return fitness;
+    }
+
+    /**
+     * @brief Clear the fitness cache (e.g. between unrelated runs)
+     */
+    void ClearFitnessCache() {
+        std::lock_guard<std::mutex> lock(m_fitnessCacheMutex);
+        m_fitnessCache.clear();
+    }
     
     /**
      * @brief Run comprehensive optimization using CRTP components
@@ -173,6 +259,10 @@ public:
         
         m_isRunning = true;
         m_shouldStop = false;
+        m_cacheEnabled = config.enableFitnessCache;
+        m_maxCacheEntries = config.maxFitnessCacheEntries;
+        m_cacheHits.store(0, std::memory_order_relaxed);
+        m_cacheMisses.store(0, std::memory_order_relaxed);
         auto startTime = std::chrono::high_resolution_clock::now();
         
         FeedbackLoopResult<TData> result;
@@ -350,6 +440,15 @@ private:
     std::atomic<bool> m_isRunning;
     std::atomic<bool> m_shouldStop;
     ProgressCallback m_progressCallback;
+
+    // Fitness memoization (see SetFitnessKeyFunction / EvaluateWithCache)
+    std::function<uint64_t(const TData&)> m_fitnessKeyFunction;
+    std::unordered_map<uint64_t, float> m_fitnessCache;
+    mutable std::mutex m_fitnessCacheMutex;
+    bool m_cacheEnabled = true;
+    size_t m_maxCacheEntries = 4096;
+    std::atomic<size_t> m_cacheHits{0};
+    std::atomic<size_t> m_cacheMisses{0};
     
     // Type-erased function holders for CRTP components
     std::function<FeedbackLoopResult<TData>(std::function<TData()>, const FeedbackLoopConfig&)> m_optimizerFunction;
@@ -384,11 +483,11 @@ private:
         TEvaluator evaluator
     ) {
         std::vector<float> fitness(population.size());
-        
+
         for (size_t i = 0; i < population.size(); ++i) {
-            fitness[i] = evaluator(population[i]);
+            fitness[i] = EvaluateWithCache(population[i], evaluator);
         }
-        
+
         return fitness;
     }
     
@@ -412,7 +511,16 @@ private:
             }
             stats.diversity = std::sqrt(variance / fitness.size());
         }
-        
+
+        // Cache counters accumulate per generation; read-and-reset so each
+        // GenerationStats reports only its own evaluations
+        stats.cacheHits = m_cacheHits.exchange(0, std::memory_order_relaxed);
+        stats.cacheMisses = m_cacheMisses.exchange(0, std::memory_order_relaxed);
+        size_t total = stats.cacheHits + stats.cacheMisses;
+        stats.cacheHitRate = total > 0
+            ? static_cast<float>(stats.cacheHits) / static_cast<float>(total)
+            : 0.0f;
+
         return stats;
     }
     
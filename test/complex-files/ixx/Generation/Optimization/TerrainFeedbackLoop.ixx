@@ -1,6 +1,10 @@
 module;
 
+#include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <memory>
+#include <thread>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -11,11 +15,13 @@ module;
 #include <functional>
 #include <chrono>
 #include <Core/Logging/LoggerMacros.h>
+#include "Core/Memory/BumpArena.h"
 
 #include <exception>
 export module TerrainFeedbackLoop;
 
 import GLMModule;
+import Core.Threading.JobSystem;
 import FeedbackLoopManager;
 import GenerationTypes;
 import Core.Logging.Logger;
@@ -103,7 +109,15 @@ public:
         float crossoverRate = 0.8f;
         float elitePercentage = 0.2f;
         bool enableParallelEvaluation = true;
+        size_t evaluationMemoryBudgetMB = 4096;  // Caps concurrent candidate evaluations
+        size_t maxConcurrentEvaluations = 0;     // 0 = derive from cores and budget
     };
+
+    // Evaluator that gets a per-candidate scratch arena; transient buffers
+    // (flow maps, histograms, spectra) bump-allocate and reclaim wholesale
+    // via Reset between candidates instead of churning the heap
+    using ArenaEvaluator =
+        std::function<float(const DataType&, Core::Memory::BumpArena&)>;
     
     std::string GetOptimizerName() const {
         return "TerrainEvolutionaryOptimizer";
@@ -118,27 +132,37 @@ public:
         std::function<DataType()> generator,
         std::function<float(const DataType&)> evaluator,
         const Config& config
+    ) {
+        // Arena-unaware evaluators simply ignore the scratch arena
+        return Optimize(std::move(generator),
+                        ArenaEvaluator([evaluator = std::move(evaluator)](
+                            const DataType& data, Core::Memory::BumpArena&) {
+                            return evaluator(data);
+                        }),
+                        config);
+    }
+
+    FeedbackLoopResult<DataType> Optimize(
+        std::function<DataType()> generator,
+        ArenaEvaluator evaluator,
+        const Config& config
     ) {
         FeedbackLoopResult<DataType> result;
-        
+
         // Generate initial population
         std::vector<DataType> population;
         population.reserve(config.populationSize);
-        
+
         for (size_t i = 0; i < config.populationSize; ++i) {
             population.push_back(generator());
         }
-        
+
         // Evolution loop
         for (uint32_t gen = 0; gen < config.maxGenerations; ++gen) {
-            // Evaluate fitness
-            std::vector<float> fitness;
-            fitness.reserve(population.size());
-            
-            for (const auto& individual : population) {
-                fitness.push_back(evaluator(individual));
-            }
-            
+            // Evaluate fitness (candidates are independent, so this fans
+            // out across the JobSystem when parallel evaluation is enabled)
+            std::vector<float> fitness = EvaluatePopulation(population, evaluator, config);
+
             // Track best
             auto bestIdx = std::distance(fitness.begin(), 
                                         std::max_element(fitness.begin(), fitness.end()));
@@ -180,6 +204,78 @@ public:
     }
     
 private:
+    // How many candidates may be evaluated at once: starts from the core
+    // count (or the explicit override), then shrinks so that concurrent
+    // candidates' terrain data plus arena scratch fit the memory budget
+    size_t ConcurrencyCap(const std::vector<DataType>& population, const Config& config) const {
+        size_t cap = config.maxConcurrentEvaluations > 0
+            ? config.maxConcurrentEvaluations
+            : std::max<size_t>(1, std::thread::hardware_concurrency());
+
+        size_t perCandidateMB = 0;
+        for (const auto& individual : population) {
+            size_t candidateMB = individual.memoryUsageMB > 0
+                ? individual.memoryUsageMB
+                : (individual.elevationData.size() * sizeof(float)) >> 20;
+            perCandidateMB = std::max(perCandidateMB, candidateMB);
+        }
+        // Arena scratch per in-flight evaluation, on top of the terrain data
+        perCandidateMB += 2;
+
+        if (perCandidateMB > 0 && config.evaluationMemoryBudgetMB > 0) {
+            cap = std::min(cap, std::max<size_t>(1, config.evaluationMemoryBudgetMB / perCandidateMB));
+        }
+        return std::min(cap, population.size());
+    }
+
+    std::vector<float> EvaluatePopulation(
+        const std::vector<DataType>& population,
+        const ArenaEvaluator& evaluator,
+        const Config& config
+    ) {
+        std::vector<float> fitness(population.size(), 0.0f);
+        if (population.empty()) return fitness;
+
+        if (!config.enableParallelEvaluation || population.size() < 2) {
+            Core::Memory::BumpArena arena;
+            for (size_t i = 0; i < population.size(); ++i) {
+                fitness[i] = evaluator(population[i], arena);
+                arena.Reset();
+            }
+            return fitness;
+        }
+
+        // Fan out across the JobSystem: one detached worker per concurrency
+        // slot, each owning a private arena and pulling candidate indices
+        // off a shared ticket so uneven evaluation times self-balance.
+        // Optimize blocks on completion, so capturing locals by reference
+        // from the detached jobs is safe.
+        size_t workerCount = ConcurrencyCap(population, config);
+        auto& jobSystem = Core::Threading::JobSystem::Instance();
+
+        std::atomic<size_t> nextCandidate{0};
+        std::atomic<size_t> workersDone{0};
+
+        for (size_t worker = 0; worker < workerCount; ++worker) {
+            jobSystem.SubmitDetached([&population, &fitness, &evaluator,
+                                      &nextCandidate, &workersDone]() {
+                Core::Memory::BumpArena arena;
+                for (size_t i = nextCandidate.fetch_add(1, std::memory_order_relaxed);
+                     i < population.size();
+                     i = nextCandidate.fetch_add(1, std::memory_order_relaxed)) {
+                    fitness[i] = evaluator(population[i], arena);
+                    arena.Reset();
+                }
+                workersDone.fetch_add(1, std::memory_order_release);
+            });
+        }
+
+        while (workersDone.load(std::memory_order_acquire) < workerCount) {
+            std::this_thread::yield();
+        }
+        return fitness;
+    }
+
     std::vector<DataType> EvolvePopulation(
         const std::vector<DataType>& current,
         const std::vector<float>& fitness,
@@ -597,9 +693,187 @@ public:
             case 2: trial.persistence = mutant.persistence; break;
             case 3: trial.lacunarity = mutant.lacunarity; break;
         }
-        
+
         return trial;
     }
+
+    // ---- Structure-of-arrays population ----
+    //
+    // One contiguous float array ("stripe") per parameter across all
+    // candidates, with noise weights laid out stripe-major. Mutation,
+    // crossover and selection run as tight loops over whole stripes, and
+    // randomness comes from a counter-based RNG, so candidates can be
+    // processed in any order (or in parallel) with bit-identical results.
+    // Evaluation batch-constructs candidates via Extract without any
+    // scatter/gather of per-object state.
+
+    struct PopulationSoA {
+        size_t count = 0;        // Candidates
+        size_t weightCount = 0;  // Noise weight stripes per candidate
+        std::vector<float> scale;
+        std::vector<float> octaves;       // Float-encoded; rounded on Extract
+        std::vector<float> persistence;
+        std::vector<float> lacunarity;
+        std::vector<uint32_t> seeds;
+        std::vector<float> noiseWeights;  // Stripe-major: [w * count + i]
+
+        void Resize(size_t candidates, size_t weights) {
+            count = candidates;
+            weightCount = weights;
+            scale.assign(count, 0.0f);
+            octaves.assign(count, 0.0f);
+            persistence.assign(count, 0.0f);
+            lacunarity.assign(count, 0.0f);
+            seeds.assign(count, 0u);
+            noiseWeights.assign(count * weightCount, 0.0f);
+        }
+
+        void Load(const std::vector<PlanetaryParameters>& individuals) {
+            size_t weights = individuals.empty() ? 0 : individuals.front().noiseWeights.size();
+            Resize(individuals.size(), weights);
+            for (size_t i = 0; i < individuals.size(); ++i) {
+                const auto& p = individuals[i];
+                scale[i] = p.scale;
+                octaves[i] = static_cast<float>(p.octaves);
+                persistence[i] = p.persistence;
+                lacunarity[i] = p.lacunarity;
+                seeds[i] = p.seed;
+                for (size_t w = 0; w < weightCount && w < p.noiseWeights.size(); ++w) {
+                    noiseWeights[w * count + i] = p.noiseWeights[w];
+                }
+            }
+        }
+
+        PlanetaryParameters Extract(size_t i) const {
+            PlanetaryParameters p;
+            p.scale = scale[i];
+            p.octaves = std::max(1, static_cast<int>(std::lround(octaves[i])));
+            p.persistence = persistence[i];
+            p.lacunarity = lacunarity[i];
+            p.seed = seeds[i];
+            p.noiseWeights.resize(weightCount);
+            for (size_t w = 0; w < weightCount; ++w) {
+                p.noiseWeights[w] = noiseWeights[w * count + i];
+            }
+            return p;
+        }
+
+        size_t StripeCount() const { return 4 + weightCount; }
+
+        float* Stripe(size_t s) {
+            switch (s) {
+                case 0: return scale.data();
+                case 1: return octaves.data();
+                case 2: return persistence.data();
+                case 3: return lacunarity.data();
+                default: return noiseWeights.data() + (s - 4) * count;
+            }
+        }
+        const float* Stripe(size_t s) const {
+            return const_cast<PopulationSoA*>(this)->Stripe(s);
+        }
+    };
+
+    // Counter-based RNG (splitmix64 finalizer): every draw is a pure
+    // function of (seed, counter), so there is no generator state to share
+    // or serialize between candidates
+    static uint64_t CounterHash(uint64_t seed, uint64_t counter) {
+        uint64_t x = seed + counter * 0x9E3779B97F4A7C15ull;
+        x ^= x >> 30; x *= 0xBF58476D1CE4E5B9ull;
+        x ^= x >> 27; x *= 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+    static float CounterRand01(uint64_t seed, uint64_t counter) {
+        return static_cast<float>(CounterHash(seed, counter) >> 40) * (1.0f / 16777216.0f);
+    }
+    static uint32_t CounterRandU32(uint64_t seed, uint64_t counter) {
+        return static_cast<uint32_t>(CounterHash(seed, counter) >> 32);
+    }
+
+    /**
+     * One generation's worth of trial vectors.
+     *
+     * Per candidate i: pick donor triple (r1, r2, r3) distinct from i and
+     * each other, build the mutant v = x_r1 + F * (x_r2 - x_r3) stripe by
+     * stripe, binomial-crossover it against the target with probability CR,
+     * and force one randomly chosen stripe to the mutant so no trial equals
+     * its target. Deterministic for a given (seed, generation).
+     */
+    void GenerateTrials(const PopulationSoA& population, uint64_t seed,
+                        uint32_t generation, PopulationSoA& trials) const {
+        const size_t n = population.count;
+        trials.Resize(n, population.weightCount);
+        trials.seeds = population.seeds;
+        if (n < 4) {
+            // DE needs a target plus three distinct donors
+            trials = population;
+            return;
+        }
+
+        std::vector<uint32_t> r1(n), r2(n), r3(n);
+        uint64_t donorCounter = static_cast<uint64_t>(generation) << 32;
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t a, b, c;
+            do { a = CounterRandU32(seed, donorCounter++) % n; } while (a == i);
+            do { b = CounterRandU32(seed, donorCounter++) % n; } while (b == i || b == a);
+            do { c = CounterRandU32(seed, donorCounter++) % n; } while (c == i || c == a || c == b);
+            r1[i] = a; r2[i] = b; r3[i] = c;
+        }
+
+        const size_t stripes = population.StripeCount();
+        for (size_t s = 0; s < stripes; ++s) {
+            const float* x = population.Stripe(s);
+            float* out = trials.Stripe(s);
+
+            // Mutation kernel over the whole stripe
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = x[r1[i]] + m_F * (x[r2[i]] - x[r3[i]]);
+            }
+
+            // Binomial crossover: keep the target value where the draw
+            // misses CR. One counter per (generation, stripe, candidate)
+            uint64_t streamBase =
+                (static_cast<uint64_t>(generation) << 40) | (static_cast<uint64_t>(s) << 28);
+            for (size_t i = 0; i < n; ++i) {
+                if (CounterRand01(seed, streamBase + i) >= m_CR) {
+                    out[i] = x[i];
+                }
+            }
+        }
+
+        // Force one stripe per candidate back to its mutant value
+        uint64_t forcedBase =
+            (static_cast<uint64_t>(generation) << 40) | (1ull << 52);
+        for (size_t i = 0; i < n; ++i) {
+            size_t s = CounterRandU32(seed, forcedBase + i) % stripes;
+            const float* x = population.Stripe(s);
+            trials.Stripe(s)[i] = x[r1[i]] + m_F * (x[r2[i]] - x[r3[i]]);
+        }
+    }
+
+    /**
+     * Greedy DE selection over whole stripes: candidate i keeps its trial
+     * wherever the trial scored at least as well. Fitness is updated after
+     * the stripe sweeps so every stripe sees the same comparison.
+     */
+    void SelectSurvivors(PopulationSoA& population, std::vector<float>& fitness,
+                         const PopulationSoA& trials,
+                         const std::vector<float>& trialFitness) const {
+        const size_t n = population.count;
+        const size_t stripes = population.StripeCount();
+        for (size_t s = 0; s < stripes; ++s) {
+            float* x = population.Stripe(s);
+            const float* t = trials.Stripe(s);
+            for (size_t i = 0; i < n; ++i) {
+                if (trialFitness[i] >= fitness[i]) {
+                    x[i] = t[i];
+                }
+            }
+        }
+        for (size_t i = 0; i < n; ++i) {
+            fitness[i] = std::max(fitness[i], trialFitness[i]);
+        }
+    }
 };
 
 /**
@@ -626,7 +900,23 @@ public:
         };
         
         m_manager->SetEvaluator(evaluatorFunc);
-        
+
+        // Fitness memoization: candidates whose quantized parameter vector
+        // matches one already scored (elites, low-mutation offspring) skip
+        // terrain generation and geological evaluation entirely
+        m_manager->SetFitnessKeyFunction([](const TerrainOptimizationData& data) {
+            const auto& p = data.parameters;
+            std::vector<float> values;
+            values.reserve(5 + p.noiseWeights.size());
+            values.push_back(p.scale);
+            values.push_back(static_cast<float>(p.octaves));
+            values.push_back(p.persistence);
+            values.push_back(p.lacunarity);
+            values.push_back(static_cast<float>(p.seed));
+            values.insert(values.end(), p.noiseWeights.begin(), p.noiseWeights.end());
+            return QuantizedParameterHash(values);
+        });
+
         // Note: SetOptimizer expects specific template signature - will be set up later when needed
     }
     
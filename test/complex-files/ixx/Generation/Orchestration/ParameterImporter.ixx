@@ -12,6 +12,8 @@ module;
 
 export module ParameterImporter;
 
+import Core.Parameters.Registry;
+
 export namespace PlanetGen::Generation::Configuration {
 
 /**
@@ -143,6 +145,20 @@ namespace ParameterUtils {
     // Validation constraint sets
     std::vector<ParameterConstraint> GetTerrainConstraints();
     std::vector<ParameterConstraint> GetPhysicsConstraints();
+
+    // Bulk registry import: stages the whole set off-lock into a
+    // ParameterBatch (constrained where a matching constraint exists)
+    // instead of registering one parameter at a time
+    PlanetGen::Core::Parameters::ParameterBatch BuildParameterBatch(
+        const ParameterSet& params,
+        const std::vector<ParameterConstraint>& constraints = {});
+
+    // Validates against the constraints, then publishes the batch with a
+    // single atomic ImportBatch. Returns false - leaving the registry
+    // untouched - if any constraint is violated
+    bool ApplyToRegistry(const ParameterSet& params,
+                         PlanetGen::Core::Parameters::ParameterRegistry& registry,
+                         const std::vector<ParameterConstraint>& constraints = {});
 }
 
 } // namespace PlanetGen::Generation::Configuration
\ No newline at end of file
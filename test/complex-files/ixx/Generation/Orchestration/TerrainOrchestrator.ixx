@@ -8,6 +8,7 @@ module;
 
 export module TerrainOrchestrator;
 
+import GenerationArena;
 import GenerationTypes;
 import TerrainAnalysisTypes;
 import GLMModule;
@@ -56,23 +57,50 @@ public:
     void Initialize(PlanetGen::Rendering::VulkanBase* vulkanBase, 
                    PlanetGen::Rendering::Pipeline::VulkanPipelineManager* pipelineManager);
                    
-    // Set planetary generator (dependency injection)
+    // Set planetary generator (dependency injection); wires the orchestrator's
+    // buffer arena into the generator so modality grids are recycled across runs
     void SetPlanetaryGenerator(std::shared_ptr<PlanetGen::Generation::PlanetaryGenerator> generator) {
         m_planetaryGenerator = generator;
+        if (m_planetaryGenerator) {
+            m_planetaryGenerator->SetBufferArena(&m_generationArena);
+        }
     }
-    
+
+    // Buffer arena for generation-scoped grid storage; callers that have
+    // consumed an OrchestrationResult can Recycle its data back here
+    PlanetGen::Generation::GenerationArena& GetGenerationArena() { return m_generationArena; }
+
     // Enhanced generation with parameter coordination
     PlanetGen::Generation::OrchestrationResult GeneratePlanetFromParameters(
         const PlanetGen::Generation::PlanetaryDesignTemplate& design,
         const PlanetGen::Generation::PlanetaryData& parameterData,
         uint32_t resolution = 2048);
     
-    // Variation generation - create N planets from same template with controlled variation
+    // Variation generation - create N planets from same template with controlled variation.
+    // Variations run concurrently on the JobSystem in waves, sharing the
+    // immutable base design; see SetVariationConcurrency for the cap.
     std::vector<PlanetGen::Generation::OrchestrationResult> GeneratePlanetVariations(
         const PlanetGen::Generation::PlanetaryDesignTemplate& baseDesign,
         uint32_t numVariations,
         float variationIntensity = 0.3f);
-    
+
+    // Batch variation configuration: the effective concurrency is the
+    // configured limit additionally capped by the memory budget (estimated
+    // per-variation working set at the generation resolution), so large
+    // exploration runs cannot exceed the host memory the caller allows
+    void SetVariationConcurrency(uint32_t maxConcurrent) { m_maxVariationConcurrency = maxConcurrent; }
+    uint32_t GetVariationConcurrency() const { return m_maxVariationConcurrency; }
+
+    void SetVariationMemoryBudgetMB(size_t budgetMB) { m_variationMemoryBudgetMB = budgetMB; }
+    size_t GetVariationMemoryBudgetMB() const { return m_variationMemoryBudgetMB; }
+
+    // Pipelined execution: overlap independent pipeline work instead of
+    // running every stage to completion before the next one starts (e.g.
+    // the CPU-side elevation scan that gates the mountain pass runs
+    // concurrently with the GPU erosion dispatch)
+    void SetPipelinedExecution(bool enabled) { m_pipelinedExecution = enabled; }
+    bool IsPipelinedExecutionEnabled() const { return m_pipelinedExecution; }
+
     // Modern render system integration (replaces SetVulkanResourceManager)
     void SetModernRenderSystem(PlanetGen::Rendering::ModernVulkanRenderSystem* renderSystem);
     
@@ -92,6 +120,9 @@ private:
         const PlanetGen::Generation::FeatureDistribution& distribution,
         uint32_t resolution);
     
+    // Concurrency actually used for a variation batch (memory-budget capped)
+    uint32_t EffectiveVariationConcurrency(uint32_t resolution) const;
+
     // Common pipeline application method (DRY principle)
     void ApplyGenerationPipeline(
         PlanetGen::Generation::PlanetaryData& data,
@@ -110,9 +141,19 @@ private:
     // Configuration
     std::string m_qualityLevel = "medium";
     std::vector<std::string> m_availableTemplates;
+
+    // Batch variation configuration
+    uint32_t m_maxVariationConcurrency = 4;
+    size_t m_variationMemoryBudgetMB = 4096;
+
+    // Stage-overlapped execution (see SetPipelinedExecution)
+    bool m_pipelinedExecution = true;
     
     // GPU acceleration
     PlanetGen::Generation::IGPUNoiseAccelerator* m_gpuAccelerator = nullptr;
+
+    // Recycled grid storage shared with the planetary generator
+    PlanetGen::Generation::GenerationArena m_generationArena;
 };
 
 
@@ -4,10 +4,14 @@ module;
 #include <functional>
 #include <future>
 #include <atomic>
+#include <vector>
+
+#include "Core/Memory/BumpArena.h"
 
 export module PlanetaryGenerator;
 
 import GLMModule;
+import GenerationArena;
 import GenerationTypes;
 import INoiseProvider;
 
@@ -58,9 +62,37 @@ public:
      * @return Future containing complete planetary dataset
      */
     std::future<PlanetaryData> GeneratePlanetAsync(const PlanetaryDesignTemplate& designTemplate,
-                                                  uint32_t resolution, 
+                                                  uint32_t resolution,
                                                   uint32_t seed = 12345);
-    
+
+    /**
+     * Callback invoked after each LOD pass of progressive generation.
+     * @param lodData Complete planetary dataset at the current LOD resolution
+     * @param lodResolution Grid resolution of this pass
+     * @param isFinal True when this is the full-resolution result
+     * @return False to stop refining (the current LOD becomes the result)
+     */
+    using ProgressiveLODCallback = std::function<bool(const PlanetaryData& lodData,
+                                                      uint32_t lodResolution,
+                                                      bool isFinal)>;
+
+    /**
+     * Progressive version: yields a low-resolution preview quickly, then
+     * refines through doubling LODs up to finalResolution. Cancellation is
+     * honoured per row band inside each pass, not just between phases.
+     * @param designTemplate Template containing all generation parameters
+     * @param finalResolution Full grid resolution for the last pass
+     * @param onLODReady Invoked with each intermediate and the final dataset
+     * @param seed Random seed for reproducibility
+     * @param previewResolution Resolution of the first (fastest) pass
+     * @return Future containing the last dataset produced before completion or stop
+     */
+    std::future<PlanetaryData> GeneratePlanetProgressive(const PlanetaryDesignTemplate& designTemplate,
+                                                        uint32_t finalResolution,
+                                                        ProgressiveLODCallback onLODReady,
+                                                        uint32_t seed = 12345,
+                                                        uint32_t previewResolution = 512);
+
     /**
      * Get current generation progress (0.0 to 1.0)
      * @return Progress value between 0.0 and 1.0
@@ -78,14 +110,38 @@ public:
      */
     void CancelGeneration();
 
+    /**
+     * Enable or disable JobSystem-parallel generation (enabled by default).
+     * Modality phases keep their data-dependency order (precipitation reads
+     * temperature, vegetation reads both), but each phase's per-pixel loop is
+     * partitioned into row bands across the JobSystem workers.
+     */
+    void SetParallelGeneration(bool enabled) { m_parallelGeneration = enabled; }
+    bool IsParallelGenerationEnabled() const { return m_parallelGeneration; }
+
+    /**
+     * Attach an optional buffer arena (borrowed, not owned). Modality grids
+     * are then acquired from recycled pool capacity instead of fresh heap
+     * allocations, and scratch buffers are returned to the pool after use.
+     */
+    void SetBufferArena(GenerationArena* arena) { m_arena = arena; }
+
 private:
     // Dependencies (injected, non-owning)
     INoiseProvider* m_noiseProvider;
+    GenerationArena* m_arena = nullptr;
+
+    // Per-run bump arena for transient scratch (position grids and the
+    // like). Reset wholesale once the PlanetaryData result is published, so
+    // steady-state runs perform no scratch allocator calls. unique_ptr keeps
+    // the generator movable.
+    std::unique_ptr<Core::Memory::BumpArena> m_scratchArena;
     
     // Generation state
     std::atomic<float> m_progress{0.0f};
     std::atomic<bool> m_isGenerating{false};
     std::atomic<bool> m_cancellationRequested{false};
+    std::atomic<bool> m_parallelGeneration{true};
     
     // Generation implementation
     PlanetaryData GeneratePlanetImpl(const PlanetaryDesignTemplate& designTemplate,
@@ -115,14 +171,20 @@ private:
     // Utility methods
     void UpdateProgress(float progress);
     bool ShouldCancelGeneration() const;
+    // Runs body(rowBegin, rowEnd) over [0, rowCount) as JobSystem row bands
+    // when parallel generation is enabled, serially otherwise.
+    void ParallelForRows(uint32_t rowCount, const std::function<void(uint32_t, uint32_t)>& body) const;
+    // Arena-backed when one is attached, plain heap allocation otherwise.
+    std::vector<float> AcquireBuffer(size_t count) const;
     void ValidateDesignTemplate(const PlanetaryDesignTemplate& designTemplate) const;
     
-    // Data assembly
+    // Data assembly; modalities are taken by value and moved into the
+    // result so the grids are never copied on their way out.
     PlanetaryData AssemblePlanetaryData(const PlanetaryDesignTemplate& designTemplate,
-                                       const PlanetaryModality& elevation,
-                                       const PlanetaryModality& temperature,
-                                       const PlanetaryModality& precipitation,
-                                       const PlanetaryModality& vegetation) const;
+                                       PlanetaryModality elevation,
+                                       PlanetaryModality temperature,
+                                       PlanetaryModality precipitation,
+                                       PlanetaryModality vegetation) const;
 };
 
 /**
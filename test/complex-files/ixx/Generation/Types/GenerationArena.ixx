@@ -0,0 +1,58 @@
+module;
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+export module GenerationArena;
+
+import GenerationTypes;
+
+export namespace PlanetGen::Generation {
+
+/**
+ * @brief Pool of float buffers reused across generation runs
+ *
+ * Modality grids at 8k resolution are hundreds of MB each; allocating them
+ * fresh for every generation (and every feedback-loop variation) churns the
+ * allocator. The arena recycles capacity instead: Acquire returns a buffer
+ * backed by a previously recycled allocation when one is large enough,
+ * Recycle returns a buffer's storage to the pool once its OrchestrationResult
+ * has been consumed, and Reset frees everything wholesale. Thread-safe.
+ */
+class GenerationArena {
+public:
+    GenerationArena() = default;
+
+    // Non-copyable - the pool owns its allocations exclusively.
+    GenerationArena(const GenerationArena&) = delete;
+    GenerationArena& operator=(const GenerationArena&) = delete;
+
+    /**
+     * @brief Get a buffer of exactly count elements, reusing pooled capacity
+     */
+    std::vector<float> Acquire(size_t count);
+
+    /**
+     * @brief Return a buffer's storage to the pool
+     */
+    void Recycle(std::vector<float>&& buffer);
+
+    /**
+     * @brief Strip every modality buffer out of a consumed data block
+     */
+    void Recycle(PlanetaryData&& data);
+
+    /**
+     * @brief Free all pooled allocations wholesale
+     */
+    void Reset();
+
+    size_t GetPooledBytes() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<std::vector<float>> m_pool;
+};
+
+} // namespace PlanetGen::Generation